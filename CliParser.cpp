@@ -12,6 +12,12 @@
 CliParser::CliParser(QObject *parent) :
     QObject(parent)
 {
+    headless=false;
+}
+
+void CliParser::setHeadless(const bool &headless)
+{
+    this->headless=headless;
 }
 
 /** \brief method to parse the ultracopier arguments
@@ -21,9 +27,17 @@ CliParser::CliParser(QObject *parent) :
 void CliParser::cli(const QStringList &ultracopierArguments,const bool &external,const bool &onlyCheck)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("ultracopierArguments: ")+ultracopierArguments.join(QStringLiteral(";")));
+    //the headless option is only used at the start, drop it to parse the command
+    if(ultracopierArguments.contains(QStringLiteral("--headless")))
+    {
+        QStringList arguments=ultracopierArguments;
+        arguments.removeAll(QStringLiteral("--headless"));
+        cli(arguments,external,onlyCheck);
+        return;
+    }
     if(ultracopierArguments.size()==1)
     {
-        if(external)
+        if(external && !headless)
             QMessageBox::warning(NULL,tr("Warning"),tr("Ultracopier is already running, right click on its system tray icon (near the clock) to use it"));
         // else do nothing, is normal starting without arguements
         return;
@@ -70,7 +84,8 @@ void CliParser::cli(const QStringList &ultracopierArguments,const bool &external
                 if(data.size()<=0)
                 {
                     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("Problem reading file, or file size is 0"));
-                    QMessageBox::warning(NULL,tr("Warning"),tr("Problem reading file, or file size is 0"));
+                    if(!headless)
+                        QMessageBox::warning(NULL,tr("Warning"),tr("Problem reading file, or file size is 0"));
                     transferFile.close();
                     return;
                 }
@@ -83,7 +98,8 @@ void CliParser::cli(const QStringList &ultracopierArguments,const bool &external
                         )
                 {
                     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QString("This file is not supported transfer list"));
-                    QMessageBox::warning(NULL,tr("Warning"),tr("This file is not supported transfer list"));
+                    if(!headless)
+                        QMessageBox::warning(NULL,tr("Warning"),tr("This file is not supported transfer list"));
                     transferFile.close();
                     return;
                 }
@@ -93,7 +109,8 @@ void CliParser::cli(const QStringList &ultracopierArguments,const bool &external
             else
             {
                 ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QString("Unable to open the transfer list file: %1").arg(transferFile.errorString()));
-                QMessageBox::warning(NULL,tr("Warning"),tr("Unable to open the transfer list file"));
+                if(!headless)
+                    QMessageBox::warning(NULL,tr("Warning"),tr("Unable to open the transfer list file"));
                 return;
             }
             return;
@@ -165,6 +182,9 @@ void CliParser::showHelp(const bool &incorrectArguments)
     qDebug() << "Transfer-list [transfer list file] : "+tr("Open transfer list");
     qDebug() << "cp [source [source2]] [destination] : "+tr("To copy sources to destination, separated by space. If destination is \"?\", ultracopier will ask the user");
     qDebug() << "mv [source [source2]] [destination] : "+tr("To move sources to destination, separated by space. If destination is \"?\", ultracopier will ask the user");
+    qDebug() << "--headless : "+tr("To run without interface, the conflicts and the errors are resolved by the copy engine options");
+    if(headless)
+        return;
 
     QString message;
     if(incorrectArguments)
@@ -176,6 +196,7 @@ void CliParser::showHelp(const bool &incorrectArguments)
     message+="<li><b>Transfer-list [transfer list file]</b> : "+tr("Open transfer list")+"</li>\n";
     message+="<li><b>cp [source [source2]] [destination]</b> : "+tr("To copy sources to destination, separated by space. If destination is \"?\", ultracopier will ask the user")+"</li>\n";
     message+="<li><b>mv [source [source2]] [destination]</b> : "+tr("To move sources to destination, separated by space. If destination is \"?\", ultracopier will ask the user")+"</li>\n";
+    message+="<li><b>--headless</b> : "+tr("To run without interface, the conflicts and the errors are resolved by the copy engine options")+"</li>\n";
     message+=+"</ul>";
     if(incorrectArguments)
         QMessageBox::warning(NULL,tr("Warning"),message);
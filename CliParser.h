@@ -19,6 +19,8 @@ class CliParser : public QObject
     Q_OBJECT
 public:
     explicit CliParser(QObject *parent = 0);
+    /// \brief without interface, the messages are only printed
+    void setHeadless(const bool &headless);
 public slots:
     /** \brief method to parse the ultracopier arguments
       \param ultracopierArguments the argument list
@@ -44,6 +46,7 @@ private:
     /** \brief show the help
      *\param incorrectArguments if the help is call because the arguments are wrong */
     void showHelp(const bool &incorrectArguments=true);
+    bool headless;
 };
 
 #endif // CLIPARSER_H
@@ -6,6 +6,7 @@
 \licence GPL3, see the file COPYING */
 
 #include <QMessageBox>
+#include <QVBoxLayout>
 
 #include "CopyEngineManager.h"
 #include "LanguagesManager.h"
@@ -121,7 +122,12 @@ void CopyEngineManager::onePluginAdded(const PluginsAvailable &plugin)
     #endif // ULTRACOPIER_DEBUG
     newItem.options=new LocalPluginOptions(QStringLiteral("CopyEngine-")+newItem.name);
     newItem.factory->setResources(newItem.options,plugin.writablePath,plugin.path,&FacilityEngine::facilityEngine,ULTRACOPIER_VERSION_PORTABLE_BOOL);
-    newItem.optionsWidget=newItem.factory->options();
+    //the options widget of the factory is created only when the page is shown
+    newItem.optionsWidget=new QWidget();
+    QVBoxLayout *optionsLayout=new QVBoxLayout(newItem.optionsWidget);
+    optionsLayout->setContentsMargins(0,0,0,0);
+    newItem.optionsWidget->installEventFilter(this);
+    newItem.optionsWidgetLoaded=false;
     newItem.supportedProtocolsForTheSource=newItem.factory->supportedProtocolsForTheSource();
     newItem.supportedProtocolsForTheDestination=newItem.factory->supportedProtocolsForTheDestination();
     newItem.canDoOnlyCopy=newItem.factory->canDoOnlyCopy();
@@ -381,3 +387,26 @@ bool CopyEngineManager::protocolsSupportedByTheCopyEngine(PluginInterface_CopyEn
     }
     return false;
 }
+
+bool CopyEngineManager::eventFilter(QObject *object,QEvent *event)
+{
+    if(event->type()==QEvent::Show)
+    {
+        int index=0;
+        while(index<pluginList.size())
+        {
+            if(pluginList.at(index).optionsWidget==object && !pluginList.at(index).optionsWidgetLoaded)
+            {
+                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("load the options of: %1").arg(pluginList.at(index).name));
+                pluginList[index].optionsWidgetLoaded=true;
+                pluginList.at(index).optionsWidget->removeEventFilter(this);
+                QWidget *options=pluginList.at(index).factory->options();
+                if(options!=NULL)
+                    pluginList.at(index).optionsWidget->layout()->addWidget(options);
+                break;
+            }
+            index++;
+        }
+    }
+    return QObject::eventFilter(object,event);
+}
@@ -13,6 +13,7 @@
 #include <QList>
 #include <QWidget>
 #include <QString>
+#include <QEvent>
 
 #include "Environment.h"
 #include "LocalPluginOptions.h"
@@ -60,6 +61,9 @@ public:
       \see Core::newMove()
       */
     bool protocolsSupportedByTheCopyEngine(PluginInterface_CopyEngine * engine,const QStringList &protocolsUsedForTheSources,const QString &protocolsUsedForTheDestination);
+protected:
+    /// \brief get the options widget of the copy engine when its page is shown the first time
+    bool eventFilter(QObject *object,QEvent *event);
 private slots:
     void onePluginAdded(const PluginsAvailable &plugin);
     #ifndef ULTRACOPIER_PLUGIN_ALL_IN_ONE
@@ -90,7 +94,8 @@ private:
         Ultracopier::CopyType type;
         Ultracopier::TransferListOperation transferListOperation;
         LocalPluginOptions *options;
-        QWidget *optionsWidget;
+        QWidget *optionsWidget;///< page added to the option dialog, contain the options of the factory once shown
+        bool optionsWidgetLoaded;
     };
     QList<CopyEnginePlugin> pluginList;
     OptionDialog *optionDialog;
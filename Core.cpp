@@ -12,16 +12,33 @@
 #include "Core.h"
 #include "ThemesManager.h"
 
-Core::Core(CopyEngineManager *copyEngineList)
+Core::Core(CopyEngineManager *copyEngineList,const bool &headless)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("start"));
     this->copyEngineList=copyEngineList;
+    this->headless=headless;
     nextId=0;
     forUpateInformation.setInterval(ULTRACOPIER_TIME_INTERFACE_UPDATE);
-    loadInterface();
+    //load the speed learned by the previous session
+    averageSpeedModel=OptionEngine::optionEngine->getOptionValue(QStringLiteral("Ultracopier"),QStringLiteral("averageSpeedModel")).toDouble();
+    const QStringList &model=OptionEngine::optionEngine->getOptionValue(QStringLiteral("Ultracopier"),QStringLiteral("remainingTimeModel")).toStringList();
+    int index=0;
+    while(index<ULTRACOPIER_MAXREMAININGTIMECOL)
+    {
+        if(index<model.size())
+            remainingTimeModel << model.at(index).toDouble();
+        else
+            remainingTimeModel << 0;
+        index++;
+    }
     //connect(&copyEngineList,	&CopyEngineManager::newCanDoOnlyCopy,				this,	&Core::newCanDoOnlyCopy);
-    connect(ThemesManager::themesManager,			&ThemesManager::theThemeNeedBeUnloaded,				this,	&Core::unloadInterface);
-    connect(ThemesManager::themesManager,			&ThemesManager::theThemeIsReloaded,				this,	&Core::loadInterface, Qt::QueuedConnection);
+    //without theme manager, the copy run without interface
+    if(!headless)
+    {
+        loadInterface();
+        connect(ThemesManager::themesManager,			&ThemesManager::theThemeNeedBeUnloaded,				this,	&Core::unloadInterface);
+        connect(ThemesManager::themesManager,			&ThemesManager::theThemeIsReloaded,				this,	&Core::loadInterface, Qt::QueuedConnection);
+    }
     connect(&forUpateInformation,	&QTimer::timeout,						this,	&Core::periodicSynchronization);
 }
 
@@ -30,6 +47,7 @@ Core::~Core()
     int index=0;
     while(index<copyList.size())
     {
+        saveRemainingTimeModel(copyList.at(index));
         copyList[index].engine->cancel();
         delete copyList.at(index).nextConditionalSync;
         delete copyList.at(index).interface;
@@ -44,12 +62,19 @@ void Core::newCopyWithoutDestination(const quint32 &orderId,const QStringList &p
     if(openNewCopyEngineInstance(Ultracopier::Copy,false,protocolsUsedForTheSources)==-1)
     {
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to get a copy engine instance");
-        QMessageBox::critical(NULL,tr("Error"),tr("Unable to get a copy engine instance"));
+        if(!headless)
+            QMessageBox::critical(NULL,tr("Error"),tr("Unable to get a copy engine instance"));
         return;
     }
     copyList.last().orderId<<orderId;
-    copyList.last().engine->newCopy(sources);
-    copyList.last().interface->haveExternalOrder();
+    if(!copyList.last().engine->newCopy(sources) && headless)
+    {
+        //nobody to give the destination, then the empty transfer is removed
+        copyInstanceCanceledByIndex(copyList.size()-1);
+        return;
+    }
+    if(copyList.last().interface!=NULL)
+        copyList.last().interface->haveExternalOrder();
 }
 
 void Core::newTransfer(const Ultracopier::CopyMode &mode,const quint32 &orderId,const QStringList &protocolsUsedForTheSources,const QStringList &sources,const QString &protocolsUsedForTheDestination,const QString &destination)
@@ -90,7 +115,7 @@ void Core::newTransfer(const Ultracopier::CopyMode &mode,const quint32 &orderId,
                     if(copyEngineList->protocolsSupportedByTheCopyEngine(copyList.at(index).engine,protocolsUsedForTheSources,protocolsUsedForTheDestination))
                     {
                         bool confirmed=true;
-                        if(needConfirmation)
+                        if(needConfirmation && !headless)
                         {
                             QMessageBox::StandardButton reply = QMessageBox::question(copyList.at(index).interface,tr("Group window"),tr("Do you want group the transfer with another actual running transfer?"),QMessageBox::Yes|QMessageBox::No,QMessageBox::No);
                             confirmed=(reply==QMessageBox::Yes);
@@ -102,7 +127,8 @@ void Core::newTransfer(const Ultracopier::CopyMode &mode,const quint32 &orderId,
                                 copyList.at(index).engine->newCopy(sources,destination);
                             else
                                 copyList.at(index).engine->newMove(sources,destination);
-                            copyList.at(index).interface->haveExternalOrder();
+                            if(copyList.at(index).interface!=NULL)
+                                copyList.at(index).interface->haveExternalOrder();
                             return;
                         }
                     }
@@ -115,7 +141,8 @@ void Core::newTransfer(const Ultracopier::CopyMode &mode,const quint32 &orderId,
     if(openNewCopyEngineInstance(mode,false,protocolsUsedForTheSources,protocolsUsedForTheDestination)==-1)
     {
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("Unable to get a engine instance"));
-        QMessageBox::critical(NULL,tr("Error"),tr("Unable to get a engine instance"));
+        if(!headless)
+            QMessageBox::critical(NULL,tr("Error"),tr("Unable to get a engine instance"));
         return;
     }
     copyList.last().orderId<<orderId;
@@ -123,7 +150,8 @@ void Core::newTransfer(const Ultracopier::CopyMode &mode,const quint32 &orderId,
         copyList.last().engine->newCopy(sources,destination);
     else
         copyList.last().engine->newMove(sources,destination);
-    copyList.last().interface->haveExternalOrder();
+    if(copyList.last().interface!=NULL)
+        copyList.last().interface->haveExternalOrder();
 }
 
 void Core::newCopy(const quint32 &orderId,const QStringList &protocolsUsedForTheSources,const QStringList &sources,const QString &protocolsUsedForTheDestination,const QString &destination)
@@ -141,12 +169,19 @@ void Core::newMoveWithoutDestination(const quint32 &orderId,const QStringList &p
     if(openNewCopyEngineInstance(Ultracopier::Move,false,protocolsUsedForTheSources)==-1)
     {
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to get a copy engine instance");
-        QMessageBox::critical(NULL,tr("Error"),tr("Unable to get a copy engine instance"));
+        if(!headless)
+            QMessageBox::critical(NULL,tr("Error"),tr("Unable to get a copy engine instance"));
         return;
     }
     copyList.last().orderId<<orderId;
-    copyList.last().engine->newMove(sources);
-    copyList.last().interface->haveExternalOrder();
+    if(!copyList.last().engine->newMove(sources) && headless)
+    {
+        //nobody to give the destination, then the empty transfer is removed
+        copyInstanceCanceledByIndex(copyList.size()-1);
+        return;
+    }
+    if(copyList.last().interface!=NULL)
+        copyList.last().interface->haveExternalOrder();
 }
 
 /// \brief name to open the right copy engine
@@ -156,7 +191,8 @@ void Core::addWindowCopyMove(const Ultracopier::CopyMode &mode,const QString &na
     if(openNewCopyEngineInstance(mode,false,name)==-1)
     {
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to get a copy engine instance");
-        QMessageBox::critical(NULL,tr("Error"),tr("Unable to get a copy engine instance"));
+        if(!headless)
+            QMessageBox::critical(NULL,tr("Error"),tr("Unable to get a copy engine instance"));
         return;
     }
     ActionOnManualOpen ActionOnManualOpen_value=(ActionOnManualOpen)OptionEngine::optionEngine->getOptionValue(QStringLiteral("Ultracopier"),QStringLiteral("ActionOnManualOpen")).toInt();
@@ -176,7 +212,8 @@ void Core::addWindowTransfer(const QString &name)
     if(openNewCopyEngineInstance(Ultracopier::Copy,true,name)==-1)
     {
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to get a copy engine instance");
-        QMessageBox::critical(NULL,tr("Error"),tr("Unable to get a copy engine instance"));
+        if(!headless)
+            QMessageBox::critical(NULL,tr("Error"),tr("Unable to get a copy engine instance"));
         return;
     }
 }
@@ -190,7 +227,8 @@ void Core::newTransferList(QString engine,QString mode,QString file)
         if(openNewCopyEngineInstance(Ultracopier::Copy,true,engine)==-1)
         {
             ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to get a copy engine instance");
-            QMessageBox::critical(NULL,tr("Error"),tr("Unable to get a copy engine instance"));
+            if(!headless)
+                QMessageBox::critical(NULL,tr("Error"),tr("Unable to get a copy engine instance"));
             return;
         }
     }
@@ -199,7 +237,8 @@ void Core::newTransferList(QString engine,QString mode,QString file)
         if(openNewCopyEngineInstance(Ultracopier::Copy,false,engine)==-1)
         {
             ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to get a copy engine instance");
-            QMessageBox::critical(NULL,tr("Error"),tr("Unable to get a copy engine instance"));
+            if(!headless)
+                QMessageBox::critical(NULL,tr("Error"),tr("Unable to get a copy engine instance"));
             return;
         }
     }
@@ -208,14 +247,16 @@ void Core::newTransferList(QString engine,QString mode,QString file)
         if(openNewCopyEngineInstance(Ultracopier::Move,false,engine)==-1)
         {
             ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to get a copy engine instance");
-            QMessageBox::critical(NULL,tr("Error"),tr("Unable to get a copy engine instance"));
+            if(!headless)
+                QMessageBox::critical(NULL,tr("Error"),tr("Unable to get a copy engine instance"));
             return;
         }
     }
     else
     {
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"The argument for the mode is not valid");
-        QMessageBox::critical(NULL,tr("Error"),tr("The argument for the mode is not valid"));
+        if(!headless)
+            QMessageBox::critical(NULL,tr("Error"),tr("The argument for the mode is not valid"));
         return;
     }
     copyList.last().engine->newTransferList(file);
@@ -239,9 +280,10 @@ void Core::loadInterface()
             }
             else
             {
+                interfaceIndex[copyList.at(index).interface]=index;
                 if(!copyList.at(index).ignoreMode)
                     copyList.at(index).interface->forceCopyMode(copyList.at(index).mode);
-                connectInterfaceAndSync(copyList.count()-1);
+                connectInterfaceAndSync(index);
                 copyList.at(index).engine->syncTransferList();
                 index++;
             }
@@ -249,7 +291,8 @@ void Core::loadInterface()
         if(error)
         {
             ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to load the interface, copy aborted");
-            QMessageBox::critical(NULL,tr("Error"),tr("Unable to load the interface, copy aborted"));
+            if(!headless)
+                QMessageBox::critical(NULL,tr("Error"),tr("Unable to load the interface, copy aborted"));
         }
     }
 }
@@ -264,6 +307,7 @@ void Core::unloadInterface()
         if(copyList.at(index).interface!=NULL)
         {
             //disconnectInterface(index);
+            interfaceIndex.remove(copyList.at(index).interface);
             delete copyList.at(index).interface;
             copyList[index].interface=NULL;
             copyList[index].copyEngineIsSync=false;
@@ -325,8 +369,10 @@ int Core::connectCopyEngine(const Ultracopier::CopyMode &mode,bool ignoreMode,co
     newItem.engine=returnInformations.engine;
     if(newItem.engine!=NULL)
     {
-        PluginInterface_Themes *theme=ThemesManager::themesManager->getThemesInstance();
-        if(theme!=NULL)
+        PluginInterface_Themes *theme=NULL;
+        if(!headless)
+            theme=ThemesManager::themesManager->getThemesInstance();
+        if(theme!=NULL || headless)
         {
             newItem.id=incrementId();
             newItem.lastProgression=0;
@@ -371,27 +417,33 @@ int Core::connectCopyEngine(const Ultracopier::CopyMode &mode,bool ignoreMode,co
                     }
                 break;
             }
+            initSpeedDetected(newItem);
 
             if(!ignoreMode)
             {
-                newItem.interface->forceCopyMode(mode);
+                if(newItem.interface!=NULL)
+                    newItem.interface->forceCopyMode(mode);
                 newItem.engine->forceMode(mode);
             }
             if(copyList.size()==0)
                 forUpateInformation.start();
             copyList << newItem;
+            updateSenderIndex(copyList.count()-1);
             connectEngine(copyList.count()-1);
-            connectInterfaceAndSync(copyList.count()-1);
+            if(newItem.interface!=NULL)
+                connectInterfaceAndSync(copyList.count()-1);
             return newItem.id;
         }
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to load the interface, copy aborted");
         delete newItem.engine;
-        QMessageBox::critical(NULL,tr("Error"),tr("Unable to load the interface, copy aborted"));
+        if(!headless)
+            QMessageBox::critical(NULL,tr("Error"),tr("Unable to load the interface, copy aborted"));
     }
     else
     {
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to load the copy engine, copy aborted");
-        QMessageBox::critical(NULL,tr("Error"),tr("Unable to load the copy engine, copy aborted"));
+        if(!headless)
+            QMessageBox::critical(NULL,tr("Error"),tr("Unable to load the copy engine, copy aborted"));
     }
     return -1;
 }
@@ -420,7 +472,6 @@ void Core::resetSpeedDetected(const int &index)
             int sub_index=0;
             while(sub_index<ULTRACOPIER_MAXREMAININGTIMECOL)
             {
-                copyList[index].remainingTimeLogarithmicValue[sub_index].lastProgressionSpeed.clear();
                 copyList[index].remainingTimeLogarithmicValue[sub_index].totalSize=0;
                 copyList[index].remainingTimeLogarithmicValue[sub_index].transferedSize=0;
                 sub_index++;
@@ -428,14 +479,85 @@ void Core::resetSpeedDetected(const int &index)
         }
         default:
         case Ultracopier::RemainingTimeAlgo_Traditional:
-            copyList[index].lastSpeedDetected.clear();
-            copyList[index].lastSpeedTime.clear();
-            copyList[index].lastAverageSpeedDetected.clear();
-            copyList[index].lastAverageSpeedTime.clear();
+            initSpeedDetected(copyList[index]);
         break;
     }
 }
 
+void Core::initSpeedDetected(CopyInstance &copyInstance)
+{
+    copyInstance.instantSpeed.speed=0;
+    copyInstance.instantSpeed.count=0;
+    //considered as enough sample to be used, the new sample correct it
+    if(averageSpeedModel>0)
+    {
+        copyInstance.averageSpeed.speed=averageSpeedModel;
+        copyInstance.averageSpeed.count=ULTRACOPIER_MINVALUESPEEDTOREMAININGTIME;
+    }
+    else
+    {
+        copyInstance.averageSpeed.speed=0;
+        copyInstance.averageSpeed.count=0;
+    }
+    int index=0;
+    while(index<copyInstance.remainingTimeLogarithmicValue.size())
+    {
+        SpeedAverage &speed=copyInstance.remainingTimeLogarithmicValue[index].speed;
+        if(index<remainingTimeModel.size() && remainingTimeModel.at(index)>0)
+        {
+            speed.speed=remainingTimeModel.at(index);
+            speed.count=ULTRACOPIER_MINVALUESPEED;
+        }
+        else
+        {
+            speed.speed=0;
+            speed.count=0;
+        }
+        index++;
+    }
+}
+
+void Core::saveRemainingTimeModel(const CopyInstance &copyInstance)
+{
+    bool changed=false;
+    if(copyInstance.averageSpeed.count>ULTRACOPIER_MINVALUESPEEDTOREMAININGTIME && copyInstance.averageSpeed.speed>0)
+    {
+        averageSpeedModel=copyInstance.averageSpeed.speed;
+        changed=true;
+    }
+    int index=0;
+    while(index<copyInstance.remainingTimeLogarithmicValue.size() && index<remainingTimeModel.size())
+    {
+        const SpeedAverage &speed=copyInstance.remainingTimeLogarithmicValue.at(index).speed;
+        if(speed.count>ULTRACOPIER_MINVALUESPEED && speed.speed>0)
+        {
+            remainingTimeModel[index]=speed.speed;
+            changed=true;
+        }
+        index++;
+    }
+    if(!changed)
+        return;
+    QStringList model;
+    index=0;
+    while(index<remainingTimeModel.size())
+    {
+        model << QString::number(remainingTimeModel.at(index));
+        index++;
+    }
+    OptionEngine::optionEngine->setOptionValue(QStringLiteral("Ultracopier"),QStringLiteral("averageSpeedModel"),averageSpeedModel);
+    OptionEngine::optionEngine->setOptionValue(QStringLiteral("Ultracopier"),QStringLiteral("remainingTimeModel"),model);
+}
+
+void Core::updateSpeedAverage(SpeedAverage &average,const double &speed,const double &weight)
+{
+    if(average.count==0)
+        average.speed=speed;
+    else
+        average.speed+=weight*(speed-average.speed);
+    average.count++;
+}
+
 void Core::doneTime(const QList<QPair<quint64,quint32> > &timeList)
 {
     int index=indexCopySenderCopyEngine();
@@ -461,12 +583,9 @@ void Core::doneTime(const QList<QPair<quint64,quint32> > &timeList)
                     }
                     else
                     {
+                        //the time is in ms
                         if(timeUnit.second>0)
-                        {
-                            copyList[index].remainingTimeLogarithmicValue[col].lastProgressionSpeed << timeUnit.first/timeUnit.second;
-                            if(copyList[index].remainingTimeLogarithmicValue[col].lastProgressionSpeed.size()>ULTRACOPIER_MAXVALUESPEEDSTORED)
-                                copyList[index].remainingTimeLogarithmicValue[col].lastProgressionSpeed.removeFirst();
-                        }
+                            updateSpeedAverage(copyList[index].remainingTimeLogarithmicValue[col].speed,(double)timeUnit.first*1000/timeUnit.second,ULTRACOPIER_REMAININGTIME_FILEWEIGHT);
                     }
                     sub_index++;
                 }
@@ -519,6 +638,9 @@ void Core::actionInProgess(const Ultracopier::EngineActionInProgress &action)
             }
             copyList[index].orderId.clear();
             resetSpeedDetected(index);
+            //no interface to close it, then the finished transfer is removed here
+            if(copyList.at(index).interface==NULL)
+                copyInstanceCanceledByIndex(index);
         }
     }
     else
@@ -531,7 +653,8 @@ void Core::newFolderListing(const QString &path)
     if(index!=-1)
     {
         copyList[index].folderListing=path;
-        copyList.at(index).interface->newFolderListing(path);
+        if(copyList.at(index).interface!=NULL)
+            copyList.at(index).interface->newFolderListing(path);
     }
 }
 
@@ -543,7 +666,26 @@ void Core::isInPause(const bool &isPaused)
         if(!isPaused)
             resetSpeedDetected(index);
         copyList[index].isPaused=isPaused;
-        copyList.at(index).interface->isInPause(isPaused);
+        if(copyList.at(index).interface!=NULL)
+            copyList.at(index).interface->isInPause(isPaused);
+        //without interface nobody can press start, then start when the engine wait for it
+        else if(isPaused)
+            copyList.at(index).engine->resume();
+    }
+}
+
+void Core::updateSenderIndex(const int &fromIndex)
+{
+    int index=fromIndex;
+    const int &loop_size=copyList.size();
+    while(index<loop_size)
+    {
+        const CopyInstance &copyInstance=copyList.at(index);
+        if(copyInstance.engine!=NULL)
+            engineIndex[copyInstance.engine]=index;
+        if(copyInstance.interface!=NULL)
+            interfaceIndex[copyInstance.interface]=index;
+        index++;
     }
 }
 
@@ -557,14 +699,9 @@ int Core::indexCopySenderCopyEngine()
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Qt sender() NULL");
         return -1;
     }
-    int index=0;
-    const int &loop_size=copyList.size();
-    while(index<loop_size)
-    {
-        if(copyList.at(index).engine==senderObject)
-            return index;
-        index++;
-    }
+    const QHash<const QObject *,int>::const_iterator i=engineIndex.constFind(senderObject);
+    if(i!=engineIndex.constEnd())
+        return i.value();
     //QMessageBox::critical(NULL,tr("Internal error"),tr("A communication error occured between the interface and the copy plugin. Please report this bug."));
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Sender not located in the list");
     return -1;
@@ -573,36 +710,17 @@ int Core::indexCopySenderCopyEngine()
 /// \brief get the right copy instance (copy engine + interface), by signal emited from interface
 int Core::indexCopySenderInterface()
 {
-    QObject * senderObject=sender();
+    const QObject * senderObject=sender();
     if(senderObject==NULL)
     {
         //QMessageBox::critical(NULL,tr("Internal error"),tr("A communication error occured between the interface and the copy plugin. Please report this bug."));
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Qt sender() NULL");
         return -1;
     }
-    int index=0;
-    const int &loop_size=copyList.size();
-    while(index<loop_size)
-    {
-        if(copyList.at(index).interface==senderObject)
-            return index;
-        index++;
-    }
-    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to locate QObject * sender");
-    PluginInterface_Themes * interface = qobject_cast<PluginInterface_Themes *>(senderObject);
-    if(interface==NULL)
-    {
-        //QMessageBox::critical(NULL,tr("Internal error"),tr("A communication error occured between the interface and the copy plugin. Please report this bug."));
-        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Qt sender themes NULL");
-        return -1;
-    }
-    index=0;
-    while(index<loop_size)
-    {
-        if(copyList.at(index).interface==interface)
-            return index;
-        index++;
-    }
+    //the interface is stored as QObject, then it's the same pointer as sender()
+    const QHash<const QObject *,int>::const_iterator i=interfaceIndex.constFind(senderObject);
+    if(i!=interfaceIndex.constEnd())
+        return i.value();
     //QMessageBox::critical(NULL,tr("Internal error"),tr("A communication error occured between the interface and the copy plugin. Please report this bug."));
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Sender not located in the list");
     return -1;
@@ -634,6 +752,10 @@ void Core::connectEngine(const int &index)
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,QStringLiteral("error at connect, the engine can not work correctly: %1: %2 for syncReady()").arg(index).arg((quint64)sender()));
     if(!connect(currentCopyInstance.engine,&PluginInterface_CopyEngine::doneTime,					this,&Core::doneTime,Qt::QueuedConnection))
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,QStringLiteral("error at connect, the engine can not work correctly: %1: %2 for doneTime()").arg(index).arg((quint64)sender()));
+    if(!connect(currentCopyInstance.engine,&PluginInterface_CopyEngine::newActionOnList,this,&Core::getActionOnList,	Qt::QueuedConnection))
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,QStringLiteral("error at connect, the engine can not work correctly: %1: %2 for newActionOnList()").arg(index).arg((quint64)sender()));
+    if(!connect(currentCopyInstance.engine,&PluginInterface_CopyEngine::pushGeneralProgression,		this,&Core::pushGeneralProgression,		Qt::QueuedConnection))
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,QStringLiteral("error at connect, the engine can not work correctly: %1: %2 for pushGeneralProgression()").arg(index).arg((quint64)sender()));
 }
 
 void Core::connectInterfaceAndSync(const int &index)
@@ -679,15 +801,11 @@ void Core::connectInterfaceAndSync(const int &index)
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,QStringLiteral("error at connect, the interface can not work correctly: %1: %2 for cancel()").arg(index).arg((quint64)sender()));
     if(!connect(currentCopyInstance.interface,&PluginInterface_Themes::urlDropped,			this,&Core::urlDropped,Qt::QueuedConnection))
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,QStringLiteral("error at connect, the interface can not work correctly: %1: %2 for urlDropped()").arg(index).arg((quint64)sender()));
-    if(!connect(currentCopyInstance.engine,&PluginInterface_CopyEngine::newActionOnList,this,&Core::getActionOnList,	Qt::QueuedConnection))
-        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,QStringLiteral("error at connect, the interface can not work correctly: %1: %2 for newActionOnList()").arg(index).arg((quint64)sender()));
 
     if(!connect(currentCopyInstance.engine,&PluginInterface_CopyEngine::pushFileProgression,		currentCopyInstance.interface,&PluginInterface_Themes::setFileProgression,		Qt::QueuedConnection))
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,QStringLiteral("error at connect, the interface can not work correctly: %1: %2 for pushFileProgression()").arg(index).arg((quint64)sender()));
     if(!connect(currentCopyInstance.engine,&PluginInterface_CopyEngine::pushGeneralProgression,		currentCopyInstance.interface,&PluginInterface_Themes::setGeneralProgression,		Qt::QueuedConnection))
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,QStringLiteral("error at connect, the interface can not work correctly: %1: %2 for pushGeneralProgression()").arg(index).arg((quint64)sender()));
-    if(!connect(currentCopyInstance.engine,&PluginInterface_CopyEngine::pushGeneralProgression,		this,&Core::pushGeneralProgression,		Qt::QueuedConnection))
-        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,QStringLiteral("error at connect, the interface can not work correctly: %1: %2 for pushGeneralProgression() for this").arg(index).arg((quint64)sender()));
     if(!connect(currentCopyInstance.engine,&PluginInterface_CopyEngine::errorToRetry,		currentCopyInstance.interface,&PluginInterface_Themes::errorToRetry,		Qt::QueuedConnection))
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,QStringLiteral("error at connect, the interface can not work correctly: %1: %2 for errorToRetry() for this").arg(index).arg((quint64)sender()));
 
@@ -726,11 +844,14 @@ void Core::periodicSynchronization()
 void Core::periodicSynchronizationWithIndex(const int &index)
 {
     CopyInstance& currentCopyInstance=copyList[index];
-    if(currentCopyInstance.engine==NULL || currentCopyInstance.interface==NULL)
+    if(currentCopyInstance.engine==NULL)
     {
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,"some thread is null");
         return;
     }
+    //nothing to display without interface
+    if(currentCopyInstance.interface==NULL)
+        return;
 
     /** ***************** Do time calcul ******************* **/
     if(!currentCopyInstance.isPaused)
@@ -761,107 +882,68 @@ void Core::periodicSynchronizationWithIndex(const int &index)
         {
             if((currentCopyInstance.action==Ultracopier::Copying || currentCopyInstance.action==Ultracopier::CopyingAndListing))
             {
-                currentCopyInstance.lastSpeedTime << lastProgressionTime.elapsed();
-                currentCopyInstance.lastSpeedDetected << diffCopiedSize;
-                currentCopyInstance.lastAverageSpeedTime << lastProgressionTime.elapsed();
-                currentCopyInstance.lastAverageSpeedDetected << diffCopiedSize;
-                while(currentCopyInstance.lastSpeedTime.size()>ULTRACOPIER_MAXVALUESPEEDSTORED)
-                    currentCopyInstance.lastSpeedTime.removeFirst();
-                while(currentCopyInstance.lastSpeedDetected.size()>ULTRACOPIER_MAXVALUESPEEDSTORED)
-                    currentCopyInstance.lastSpeedDetected.removeFirst();
-                while(currentCopyInstance.lastAverageSpeedTime.size()>ULTRACOPIER_MAXVALUESPEEDSTOREDTOREMAININGTIME)
-                    currentCopyInstance.lastAverageSpeedTime.removeFirst();
-                while(currentCopyInstance.lastAverageSpeedDetected.size()>ULTRACOPIER_MAXVALUESPEEDSTOREDTOREMAININGTIME)
-                    currentCopyInstance.lastAverageSpeedDetected.removeFirst();
-                double totTime=0,totAverageTime=0;
-                double totSpeed=0,totAverageSpeed=0;
-
-                //current speed
-                int index_sub_loop=0;
-                int loop_size=currentCopyInstance.lastSpeedDetected.size();
-                while(index_sub_loop<loop_size)
+                //the weight of the new value is by the elapsed time, then the timer precision don't change the average
+                const int elapsed=lastProgressionTime.elapsed();
+                if(elapsed>0)
                 {
-                    totTime+=currentCopyInstance.lastSpeedTime.at(index_sub_loop);
-                    totSpeed+=currentCopyInstance.lastSpeedDetected.at(index_sub_loop);
-                    index_sub_loop++;
+                    const double speed=(double)diffCopiedSize*1000/elapsed;
+                    updateSpeedAverage(currentCopyInstance.instantSpeed,speed,1-exp(-(double)elapsed/ULTRACOPIER_SPEEDTIMECONSTANT));
+                    updateSpeedAverage(currentCopyInstance.averageSpeed,speed,1-exp(-(double)elapsed/ULTRACOPIER_SPEEDTIMECONSTANTTOREMAININGTIME));
                 }
-                totTime/=1000;
+                const double &averageSpeed=currentCopyInstance.averageSpeed.speed;
 
-                //speed to calculate the remaining time
-                index_sub_loop=0;
-                loop_size=currentCopyInstance.lastAverageSpeedDetected.size();
-                while(index_sub_loop<loop_size)
-                {
-                    totAverageTime+=currentCopyInstance.lastAverageSpeedTime.at(index_sub_loop);
-                    totAverageSpeed+=currentCopyInstance.lastAverageSpeedDetected.at(index_sub_loop);
-                    index_sub_loop++;
-                }
-                totAverageTime/=1000;
-
-                if(totTime>0)
-                    if(loop_size>=ULTRACOPIER_MINVALUESPEED)
-                        currentCopyInstance.interface->detectedSpeed(totSpeed/totTime);
+                if(currentCopyInstance.instantSpeed.count>=ULTRACOPIER_MINVALUESPEED)
+                    currentCopyInstance.interface->detectedSpeed(currentCopyInstance.instantSpeed.speed);
 
-                if(totAverageTime>0)
-                    if(loop_size>=ULTRACOPIER_MINVALUESPEEDTOREMAININGTIME)
+                if(currentCopyInstance.averageSpeed.count>=ULTRACOPIER_MINVALUESPEEDTOREMAININGTIME)
+                {
+                    if(currentCopyInstance.remainingTimeAlgo==Ultracopier::RemainingTimeAlgo_Traditional)
                     {
-                        if(currentCopyInstance.remainingTimeAlgo==Ultracopier::RemainingTimeAlgo_Traditional)
+                        if(averageSpeed>0)
                         {
-                            if(totSpeed>0)
-                            {
-                                //remaining time: (total byte - lastProgression)/byte per ms since the start
-                                if(currentCopyInstance.totalProgression==0 || currentCopyInstance.currentProgression==0)
-                                    currentCopyInstance.interface->remainingTime(-1);
-                                else if((currentCopyInstance.totalProgression-currentCopyInstance.currentProgression)>1024)
-                                    currentCopyInstance.interface->remainingTime((currentCopyInstance.totalProgression-currentCopyInstance.currentProgression)/(totAverageSpeed/totAverageTime));
-                            }
-                            else
+                            //remaining time: (total byte - lastProgression)/byte per s
+                            if(currentCopyInstance.totalProgression==0 || currentCopyInstance.currentProgression==0)
                                 currentCopyInstance.interface->remainingTime(-1);
+                            else if((currentCopyInstance.totalProgression-currentCopyInstance.currentProgression)>1024)
+                                currentCopyInstance.interface->remainingTime((currentCopyInstance.totalProgression-currentCopyInstance.currentProgression)/averageSpeed);
                         }
-                        else if(currentCopyInstance.remainingTimeAlgo==Ultracopier::RemainingTimeAlgo_Logarithmic)
+                        else
+                            currentCopyInstance.interface->remainingTime(-1);
+                    }
+                    else if(currentCopyInstance.remainingTimeAlgo==Ultracopier::RemainingTimeAlgo_Logarithmic)
+                    {
+                        double remainingTimeValue=0;
+                        //calculate for each file class
+                        int index_sub_loop=0;
+                        const int &loop_size=currentCopyInstance.remainingTimeLogarithmicValue.size();
+                        while(index_sub_loop<loop_size)
                         {
-                            int remainingTimeValue=0;
-                            //calculate for each file class
-                            index_sub_loop=0;
-                            loop_size=currentCopyInstance.remainingTimeLogarithmicValue.size();
-                            while(index_sub_loop<loop_size)
+                            const RemainingTimeLogarithmicColumn &remainingTimeLogarithmicColumn=currentCopyInstance.remainingTimeLogarithmicValue.at(index_sub_loop);
+                            //normal detect
+                            const quint64 &remainingSize=remainingTimeLogarithmicColumn.totalSize-remainingTimeLogarithmicColumn.transferedSize;
+                            if(remainingTimeLogarithmicColumn.speed.count>=ULTRACOPIER_MINVALUESPEED && remainingTimeLogarithmicColumn.speed.speed>0)
+                                remainingTimeValue+=remainingSize/remainingTimeLogarithmicColumn.speed.speed;
+                            //fallback
+                            else
                             {
-                                const RemainingTimeLogarithmicColumn &remainingTimeLogarithmicColumn=currentCopyInstance.remainingTimeLogarithmicValue.at(index_sub_loop);
-                                //normal detect
-                                const quint64 &remainingSize=remainingTimeLogarithmicColumn.totalSize-remainingTimeLogarithmicColumn.transferedSize;
-                                if(remainingTimeLogarithmicColumn.lastProgressionSpeed.size()>=ULTRACOPIER_MINVALUESPEED)
+                                if(averageSpeed>0)
                                 {
-                                    int average_speed=0;
-                                    int temp_loop_index=0;
-                                    while(temp_loop_index<remainingTimeLogarithmicColumn.lastProgressionSpeed.size())
-                                    {
-                                        average_speed+=remainingTimeLogarithmicColumn.lastProgressionSpeed.at(temp_loop_index);
-                                        temp_loop_index++;
-                                    }
-                                    average_speed/=remainingTimeLogarithmicColumn.lastProgressionSpeed.size();
-                                    remainingTimeValue+=remainingSize/average_speed;
-                                }
-                                //fallback
-                                else
-                                {
-                                    if(totSpeed>0)
-                                    {
-                                        //remaining time: (total byte - lastProgression)/byte per ms since the start
-                                        if(currentCopyInstance.totalProgression==0 || currentCopyInstance.currentProgression==0)
-                                            remainingTimeValue+=1;
-                                        else if((currentCopyInstance.totalProgression-currentCopyInstance.currentProgression)>1024)
-                                            remainingTimeValue+=remainingSize/totAverageSpeed;
-                                    }
-                                    else
+                                    //remaining time: (total byte - lastProgression)/byte per s
+                                    if(currentCopyInstance.totalProgression==0 || currentCopyInstance.currentProgression==0)
                                         remainingTimeValue+=1;
+                                    else if((currentCopyInstance.totalProgression-currentCopyInstance.currentProgression)>1024)
+                                        remainingTimeValue+=remainingSize/averageSpeed;
                                 }
-                                index_sub_loop++;
+                                else
+                                    remainingTimeValue+=1;
                             }
-                            currentCopyInstance.interface->remainingTime(remainingTimeValue);
+                            index_sub_loop++;
                         }
-                        else
-                        {}//error case
+                        currentCopyInstance.interface->remainingTime(remainingTimeValue);
                     }
+                    else
+                    {}//error case
+                }
             }
             lastProgressionTime.restart();
         }
@@ -919,7 +1001,12 @@ void Core::copyInstanceCanceledByIndex(const int &index)
         index_sub_loop++;
     }
     currentCopyInstance.orderId.clear();
+    saveRemainingTimeModel(currentCopyInstance);
+    engineIndex.remove(currentCopyInstance.engine);
+    interfaceIndex.remove(currentCopyInstance.interface);
     copyList.removeAt(index);
+    //the next instances are moved by one
+    updateSenderIndex(index);
     if(copyList.size()==0)
         forUpateInformation.stop();
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"copyList.size(): "+QString::number(copyList.size()));
@@ -955,7 +1042,8 @@ void Core::error(const QString &path,const quint64 &size,const QDateTime &mtime,
     if(index!=-1)
     {
         copyList[index].haveError=true;
-        copyList.at(index).interface->errorDetected();
+        if(copyList.at(index).interface!=NULL)
+            copyList.at(index).interface->errorDetected();
     }
     else
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"unable to locate the copy engine sender");
@@ -982,7 +1070,7 @@ void Core::syncReady()
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"unable to locate the copy engine sender");
 }
 
-void Core::getActionOnList(const QList<Ultracopier::ReturnActionOnCopyList> &actionList)
+void Core::getActionOnList(const Ultracopier::CopyListEvents &actionList)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("start"));
     //send the the interface
@@ -990,8 +1078,8 @@ void Core::getActionOnList(const QList<Ultracopier::ReturnActionOnCopyList> &act
     if(index!=-1)
     {
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("start2"));
-        if(copyList.at(index).copyEngineIsSync)
-            copyList.at(index).interface->getActionOnList(actionList);
+        if(copyList.at(index).copyEngineIsSync && copyList.at(index).interface!=NULL)
+            copyList.at(index).interface->getCopyListEvents(actionList);
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("start3"));
         //log to the file and compute the remaining time
         if(log.logTransfer() || copyList.at(index).remainingTimeAlgo==Ultracopier::RemainingTimeAlgo_Logarithmic)
@@ -1004,28 +1092,28 @@ void Core::getActionOnList(const QList<Ultracopier::ReturnActionOnCopyList> &act
                 ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("start5"));
                 while(sub_index<size)
                 {
-                    const Ultracopier::ReturnActionOnCopyList &returnAction=actionList.at(sub_index);
+                    const Ultracopier::CopyListEvent &returnAction=actionList.at(sub_index);
                     switch(returnAction.type)
                     {
                         case Ultracopier::PreOperation:
-                            log.newTransferStart(returnAction.addAction);
+                            log.newTransferStart(actionList.item(returnAction));
                         break;
                         case Ultracopier::RemoveItem:
-                            if(returnAction.userAction.moveAt==0)
-                                log.newTransferStop(returnAction.addAction);
+                            if(returnAction.moveAt==0)
+                                log.newTransferStop(actionList.item(returnAction));
                             else
-                                log.transferSkip(returnAction.addAction);
+                                log.transferSkip(actionList.item(returnAction));
                             if(copyList.at(index).remainingTimeAlgo==Ultracopier::RemainingTimeAlgo_Logarithmic)
                             {
-                                const quint8 &col=fileCatNumber(returnAction.addAction.size);
-                                copyList[index].remainingTimeLogarithmicValue[col].transferedSize+=returnAction.addAction.size;
+                                const quint8 &col=fileCatNumber(returnAction.size);
+                                copyList[index].remainingTimeLogarithmicValue[col].transferedSize+=returnAction.size;
                             }
                         break;
                         case Ultracopier::AddingItem:
                             if(copyList.at(index).remainingTimeAlgo==Ultracopier::RemainingTimeAlgo_Logarithmic)
                             {
-                                const quint8 &col=fileCatNumber(returnAction.addAction.size);
-                                copyList[index].remainingTimeLogarithmicValue[col].totalSize+=returnAction.addAction.size;
+                                const quint8 &col=fileCatNumber(returnAction.size);
+                                copyList[index].remainingTimeLogarithmicValue[col].totalSize+=returnAction.size;
                             }
                         break;
                         default:
@@ -1039,21 +1127,21 @@ void Core::getActionOnList(const QList<Ultracopier::ReturnActionOnCopyList> &act
                 ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("start6"));
                 while(sub_index<size)
                 {
-                    const Ultracopier::ReturnActionOnCopyList &returnAction=actionList.at(sub_index);
+                    const Ultracopier::CopyListEvent &returnAction=actionList.at(sub_index);
                     switch(returnAction.type)
                     {
                         case Ultracopier::PreOperation:
-                            log.newTransferStart(returnAction.addAction);
+                            log.newTransferStart(actionList.item(returnAction));
                         break;
                         case Ultracopier::RemoveItem:
-                            if(returnAction.userAction.moveAt==0)
-                                log.newTransferStop(returnAction.addAction);
+                            if(returnAction.moveAt==0)
+                                log.newTransferStop(actionList.item(returnAction));
                             else
-                                log.transferSkip(returnAction.addAction);
+                                log.transferSkip(actionList.item(returnAction));
                             if(copyList.at(index).remainingTimeAlgo==Ultracopier::RemainingTimeAlgo_Logarithmic)
                             {
-                                const quint8 &col=fileCatNumber(returnAction.addAction.size);
-                                copyList[index].remainingTimeLogarithmicValue[col].transferedSize+=returnAction.addAction.size;
+                                const quint8 &col=fileCatNumber(returnAction.size);
+                                copyList[index].remainingTimeLogarithmicValue[col].transferedSize+=returnAction.size;
                             }
                         break;
                         default:
@@ -1067,21 +1155,21 @@ void Core::getActionOnList(const QList<Ultracopier::ReturnActionOnCopyList> &act
                 ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("start7"));
                 while(sub_index<size)
                 {
-                    const Ultracopier::ReturnActionOnCopyList &returnAction=actionList.at(sub_index);
+                    const Ultracopier::CopyListEvent &returnAction=actionList.at(sub_index);
                     switch(returnAction.type)
                     {
                         case Ultracopier::RemoveItem:
                             if(copyList.at(index).remainingTimeAlgo==Ultracopier::RemainingTimeAlgo_Logarithmic)
                             {
-                                const quint8 &col=fileCatNumber(returnAction.addAction.size);
-                                copyList[index].remainingTimeLogarithmicValue[col].transferedSize+=returnAction.addAction.size;
+                                const quint8 &col=fileCatNumber(returnAction.size);
+                                copyList[index].remainingTimeLogarithmicValue[col].transferedSize+=returnAction.size;
                             }
                         break;
                         case Ultracopier::AddingItem:
                             if(copyList.at(index).remainingTimeAlgo==Ultracopier::RemainingTimeAlgo_Logarithmic)
                             {
-                                const quint8 &col=fileCatNumber(returnAction.addAction.size);
-                                copyList[index].remainingTimeLogarithmicValue[col].totalSize+=returnAction.addAction.size;
+                                const quint8 &col=fileCatNumber(returnAction.size);
+                                copyList[index].remainingTimeLogarithmicValue[col].totalSize+=returnAction.size;
                             }
                         break;
                         default:
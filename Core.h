@@ -10,6 +10,7 @@
 #include <QStringList>
 #include <QString>
 #include <QList>
+#include <QHash>
 #include <QTimer>
 #include <QTime>
 #include <QFile>
@@ -30,18 +31,26 @@ class Core : public QObject
     Q_OBJECT
     public:
         /// \brief Initate the core of one copy or move window, dispatch the event specific at this window
-        Core(CopyEngineManager *copyEngineList);
+        /// \param headless true to run the copy without theme, the engine resolve the conflicts by its policies
+        Core(CopyEngineManager *copyEngineList,const bool &headless=false);
         ~Core();
     private:
         CopyEngineManager *copyEngineList;
+        bool headless;
         struct RunningTransfer
         {
             Ultracopier::ItemOfCopyList item;
             bool progression;
         };
+        /// \brief exponentially weighted moving average of a speed, updated in O(1)
+        struct SpeedAverage
+        {
+            double speed;///< in bytes per second
+            quint32 count;///< number of sample, to know when the value is usable
+        };
         struct RemainingTimeLogarithmicColumn
         {
-            QList<int> lastProgressionSpeed;
+            SpeedAverage speed;///< speed of the finished files of this size class
             quint64 totalSize;
             quint64 transferedSize;
         };
@@ -77,16 +86,19 @@ class Core : public QObject
 
             /** for RemainingTimeAlgo_Traditional **/
             //this speed is for instant speed
-            QList<quint64> lastSpeedDetected;//stored in bytes
-            QList<double> lastSpeedTime;//stored in ms
+            SpeedAverage instantSpeed;
             //this speed is average speed on more time to calculate the remaining time
-            QList<quint64> lastAverageSpeedDetected;//stored in bytes
-            QList<double> lastAverageSpeedTime;//stored in ms
+            SpeedAverage averageSpeed;
 
             /** for RemainingTimeAlgo_Logarithmic **/
             QList<RemainingTimeLogarithmicColumn> remainingTimeLogarithmicValue;
         };
         QList<CopyInstance> copyList;
+        /// \brief index into copyList of each copy engine and each interface, to locate the sender of a signal without scan the list
+        QHash<const QObject *,int> engineIndex;
+        QHash<const QObject *,int> interfaceIndex;
+        /// \brief update the sender index of the copy instances from this index to the end of the list
+        void updateSenderIndex(const int &fromIndex);
         /** open with specific source/destination
         \param move Copy or move
         \param ignoreMode if need ignore the mode
@@ -131,6 +143,14 @@ class Core : public QObject
         quint64 realByteTransfered;
 
         static quint8 fileCatNumber(quint64 size);
+        /// \brief add a sample to the average, weight into ]0,1] is the part of the new value
+        static void updateSpeedAverage(SpeedAverage &average,const double &speed,const double &weight);
+        /// \brief init the speed with the model learned by the previous copy, to have the remaining time at the start
+        void initSpeedDetected(CopyInstance &copyInstance);
+        /// \brief learn from the copy instance, and save the model into the options
+        void saveRemainingTimeModel(const CopyInstance &copyInstance);
+        QList<double> remainingTimeModel;///< speed in bytes per second by size class, learned across the sessions
+        double averageSpeedModel;///< average speed in bytes per second, learned across the sessions
     signals:
         void copyFinished(const quint32 & orderId,bool withError) const;
         void copyCanceled(const quint32 & orderId) const;
@@ -189,7 +209,7 @@ class Core : public QObject
         void syncReady();
         void doneTime(const QList<QPair<quint64,quint32> > &timeList);
 
-        void getActionOnList(const QList<Ultracopier::ReturnActionOnCopyList> & actionList);
+        void getActionOnList(const Ultracopier::CopyListEvents &actionList);
         void pushGeneralProgression(const quint64 &current,const quint64 &total);
 };
 
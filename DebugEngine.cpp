@@ -37,6 +37,9 @@ DebugEngine::DebugEngine()
     if(ultracopierArguments.size()==2)
         if(ultracopierArguments.last()=="quit")
             quit=true;
+    //headless, nobody to answer the question about the previous report
+    if(ultracopierArguments.contains(QStringLiteral("--headless")))
+        quit=true;
     addDebugInformationCallNumber=0;
     //Load the first content
     debugHtmlContent+="<!DOCTYPE html PUBLIC \"-//W3C//DTD XHTML 1.0 Strict//EN\" \"http://www.w3.org/TR/xhtml1/DTD/xhtml1-strict.dtd\">";
@@ -207,13 +210,15 @@ void DebugEngine::saveBugReport()
             }
             if(!errorFound)
             {
-                //Open the destination as write
-                if(!logFile.copy(fileName))
+                //Open the destination as write, with the trace events dumped
+                QFile bugReport(fileName);
+                if(!bugReport.open(QIODevice::WriteOnly) || bugReport.write(getTheDebugHtml().toUtf8())==-1)
                 {
                     errorFound=true;
-                    puts(qPrintable(fileName+" unable to open it as write: "+logFile.errorString()));
-                    QMessageBox::critical(NULL,"Error","Unable to save the bug report"+logFile.errorString());
+                    puts(qPrintable(fileName+" unable to open it as write: "+bugReport.errorString()));
+                    QMessageBox::critical(NULL,"Error","Unable to save the bug report"+bugReport.errorString());
                 }
+                bugReport.close();
             }
         }
     } while(errorFound!=false);
@@ -258,9 +263,32 @@ void DebugEngine::addDebugInformationStatic(const Ultracopier::DebugLevel &level
         default:
             tempLevel=DebugLevel_custom_Notice;
     }
+    //the notice are only stored into the trace ring, formated at the dump
+    if(tempLevel==DebugLevel_custom_Notice)
+    {
+        const char *functionString,*fileString,*locationString;
+        DebugTrace::internLocation(function,file,ligne,location,functionString,fileString,locationString);
+        DebugTrace::addEvent(DebugEngine::debugEngine->startTime.elapsed(),tempLevel,functionString,text,fileString,ligne,locationString);
+        return;
+    }
     DebugEngine::debugEngine->addDebugInformation(tempLevel,function,text,file,ligne,location);
 }
 
+void DebugEngine::addDebugTraceStatic(const Ultracopier::DebugLevel &level,const char *function,const QString& text,const char *file,const int& ligne)
+{
+    if(level!=Ultracopier::DebugLevel_Notice)
+    {
+        addDebugInformationStatic(level,QString::fromLatin1(function),text,QString::fromLatin1(file),ligne);
+        return;
+    }
+    if(DebugEngine::debugEngine==NULL)
+    {
+        qWarning() << QStringLiteral("After close: ") << function << file << ligne;
+        return;
+    }
+    DebugTrace::addEvent(DebugEngine::debugEngine->startTime.elapsed(),DebugLevel_custom_Notice,function,text,file,ligne,"Core");
+}
+
 void DebugEngine::addDebugNote(const QString& text)
 {
     if(DebugEngine::debugEngine==NULL)
@@ -284,29 +312,8 @@ void DebugEngine::addDebugInformation(const DebugLevel_custom &level,const QStri
         addDebugInformation_fileString+=QStringLiteral(":")+addDebugInformation_lignestring;
     //Load the time from start
     QString addDebugInformation_time = QString::number(startTime.elapsed());
-    QString addDebugInformation_htmlFormat;
-    bool important=true;
-    switch(level)
-    {
-        case DebugLevel_custom_Information:
-            addDebugInformation_htmlFormat=QStringLiteral("<tr class=\"Information\"><td class=\"time\">")+addDebugInformation_time+QStringLiteral("</span></td><td>")+addDebugInformation_fileString+QStringLiteral("</td><td class=\"function\">")+function+QStringLiteral("()</td><td class=\"location\">")+location+QStringLiteral("</td><td>")+htmlEntities(text)+QStringLiteral("</td></tr>\n");
-        break;
-        case DebugLevel_custom_Critical:
-            addDebugInformation_htmlFormat=QStringLiteral("<tr class=\"Critical\"><td class=\"time\">")+addDebugInformation_time+QStringLiteral("</span></td><td>")+addDebugInformation_fileString+QStringLiteral("</td><td class=\"function\">")+function+QStringLiteral("()</td><td class=\"location\">")+location+QStringLiteral("</td><td>")+htmlEntities(text)+QStringLiteral("</td></tr>\n");
-        break;
-        case DebugLevel_custom_Warning:
-            addDebugInformation_htmlFormat=QStringLiteral("<tr class=\"Warning\"><td class=\"time\">")+addDebugInformation_time+QStringLiteral("</span></td><td>")+addDebugInformation_fileString+QStringLiteral("</td><td class=\"function\">")+function+QStringLiteral("()</td><td class=\"location\">")+location+QStringLiteral("</td><td>")+htmlEntities(text)+QStringLiteral("</td></tr>\n");
-        break;
-        case DebugLevel_custom_Notice:
-        {
-            addDebugInformation_htmlFormat=QStringLiteral("<tr class=\"Notice\"><td class=\"time\">")+addDebugInformation_time+QStringLiteral("</span></td><td>")+addDebugInformation_fileString+QStringLiteral("</td><td class=\"function\">")+function+QStringLiteral("()</td><td class=\"location\">")+location+QStringLiteral("</td><td>")+htmlEntities(text)+QStringLiteral("</td></tr>\n");
-            important=false;
-        }
-        break;
-        case DebugLevel_custom_UserNote:
-            addDebugInformation_htmlFormat=QStringLiteral("<tr class=\"Note\"><td class=\"time\">")+addDebugInformation_time+QStringLiteral("</span></td><td>")+addDebugInformation_fileString+QStringLiteral("</td><td class=\"function\">")+function+QStringLiteral("()</td><td class=\"location\">")+location+QStringLiteral("</td><td>")+htmlEntities(text)+QStringLiteral("</td></tr>\n");
-        break;
-    }
+    QString addDebugInformation_htmlFormat=htmlFormat(addDebugInformation_time,level,addDebugInformation_fileString,function,location,text);
+    const bool important=(level!=DebugLevel_custom_Notice);
     //To prevent access of string in multi-thread
     {
         //Show the text in console
@@ -341,18 +348,64 @@ void DebugEngine::addDebugInformation(const DebugLevel_custom &level,const QStri
     }
 }
 
+QString DebugEngine::htmlFormat(const QString &time,const DebugLevel_custom &level,const QString &fileString,const QString &function,const QString &location,const QString &text)
+{
+    QString className;
+    switch(level)
+    {
+        case DebugLevel_custom_Information:
+            className=QStringLiteral("Information");
+        break;
+        case DebugLevel_custom_Critical:
+            className=QStringLiteral("Critical");
+        break;
+        case DebugLevel_custom_Warning:
+            className=QStringLiteral("Warning");
+        break;
+        case DebugLevel_custom_Notice:
+            className=QStringLiteral("Notice");
+        break;
+        case DebugLevel_custom_UserNote:
+            className=QStringLiteral("Note");
+        break;
+    }
+    return QStringLiteral("<tr class=\"")+className+QStringLiteral("\"><td class=\"time\">")+time+QStringLiteral("</span></td><td>")+fileString+QStringLiteral("</td><td class=\"function\">")+function+QStringLiteral("()</td><td class=\"location\">")+location+QStringLiteral("</td><td>")+htmlEntities(text)+QStringLiteral("</td></tr>\n");
+}
+
+/// \brief the trace events are added after the important events
+QString DebugEngine::traceHtml()
+{
+    const QList<DebugModel::DebugItem> events=DebugTrace::events();
+    QString html;
+    int index=0;
+    while(index<events.size())
+    {
+        const DebugModel::DebugItem &item=events.at(index);
+        html+=htmlFormat(QString::number(item.time),item.level,QString(item.file).remove(fileNameCleaner),item.function,item.location,item.text);
+        index++;
+    }
+    return html;
+}
+
 /// \brief Get the html text info for re-show it
 QString DebugEngine::getTheDebugHtml()
 {
     if(currentBackend==File)
     {
-        logFile.seek(0);
         if(!logFile.isOpen())
             ULTRACOPIER_DEBUGCONSOLE(DebugLevel_custom_Warning,"The log file is not open");
-        return QString().fromUtf8(logFile.readAll().data())+endOfLogFile;
+        QString content;
+        {
+            QMutexLocker lock_mutex(&mutex);
+            logFile.seek(0);
+            content=QString().fromUtf8(logFile.readAll().data());
+            //continue to append at the end
+            logFile.seek(logFile.size());
+        }
+        return content+traceHtml()+endOfLogFile;
     }
     else
-        return debugHtmlContent+endOfLogFile;
+        return debugHtmlContent+traceHtml()+endOfLogFile;
 }
 
 /// \brief Get the html end
@@ -14,6 +14,11 @@
 #include <QTime>
 #include <QTimer>
 #include <QList>
+#include <QHash>
+#include <QPair>
+#include <QByteArray>
+#include <QAtomicInt>
+#include <QThreadStorage>
 #include <QCoreApplication>
 #include <QAbstractTableModel>
 #include <QRegularExpression>
@@ -51,16 +56,81 @@ public:
     virtual bool setData(const QModelIndex&, const QVariant&, int = Qt::EditRole);
 
     void addDebugInformation(const int &time, const DebugLevel_custom &level, const QString& function, const QString& text, const QString &file="", const int& ligne=-1, const QString& location="Core");
+    /// \brief show the notices of the trace rings with the important events, called when the debug view is shown
+    void loadTrace();
     void setupTheTimer();
     QTimer *updateDisplayTimer;
     bool displayed;
     bool inWaitOfDisplay;
 private:
-    QList<DebugItem> list;
+    QList<DebugItem> list;///< displayed
+    QList<DebugItem> importantList;///< without the notices, which are only into the trace rings
 private slots:
     void updateDisplay();
 };
 
+/** \brief Ring buffer by thread of the debug events
+
+The events are stored as fixed size binary records without lock and without formating,
+they are formated only when the report is dumped. When the ring is full the older events are overwritten.
+\note The string pointers need stay valid, use the literal or internString() */
+class DebugTrace
+{
+public:
+    /// \brief add the event into the ring of the current thread, the text is truncated to ULTRACOPIER_DEBUG_TRACE_TEXT_SIZE
+    static void addEvent(const int &time,const DebugLevel_custom &level,const char *function,const QString &text,const char *file,const int &ligne,const char *location);
+    /// \brief return a copy of the string which stay valid until the application exit
+    static const char *internString(const QString &string);
+    /// \brief the interned strings of a caller, cached by thread and by file and line, then without lock after the first call
+    static void internLocation(const QString &function,const QString &file,const int &ligne,const QString &location,
+                               const char *&functionString,const char *&fileString,const char *&locationString);
+    /// \brief return the events of all the threads sorted by time
+    static QList<DebugModel::DebugItem> events();
+private:
+    struct Event
+    {
+        QAtomicInt sequence;///< odd when the event is in writing, 0 when never written
+        quint32 number;
+        int time;
+        DebugLevel_custom level;
+        const char *function;
+        const char *file;
+        int ligne;
+        const char *location;
+        int textSize;
+        QChar text[ULTRACOPIER_DEBUG_TRACE_TEXT_SIZE];
+    };
+    struct Ring
+    {
+        Event events[ULTRACOPIER_DEBUG_TRACE_RING_SIZE];
+        quint32 next;///< only used by the thread which write into it
+        bool used;
+    };
+    /// \brief keep the ring of the thread, at the thread exit the ring can be reused by other thread
+    struct RingOwner
+    {
+        Ring *ring;
+        RingOwner();
+        ~RingOwner();
+    };
+    static Ring *currentRing();
+    /// \brief deleted at the thread exit, then the ring is released
+    static QThreadStorage<RingOwner *> ringOwner;
+    static QMutex ringsMutex;
+    static QList<Ring *> rings;
+    static QMutex stringsMutex;
+    static QHash<QString,QByteArray> strings;
+    struct CachedLocation
+    {
+        QString location;
+        const char *function;
+        const char *file;
+        const char *locationString;
+    };
+    /// \brief deleted at the thread exit
+    static QThreadStorage<QHash<QPair<QString,int>,CachedLocation> *> locationCache;
+};
+
 /** \brief Define the class for the debug
 
 This class provide all needed for the debug mode of ultracopier */
@@ -89,6 +159,9 @@ class DebugEngine : public QObject
         /** \brief For add message info, this function
         \note This function is reentrant */
         static void addDebugInformationStatic(const Ultracopier::DebugLevel &level,const QString& function,const QString& text,const QString& file="",const int& ligne=-1,const QString& location="Core");
+        /** \brief For the macro, the notice go only into the trace ring, without formating
+        \note This function is reentrant */
+        static void addDebugTraceStatic(const Ultracopier::DebugLevel &level,const char *function,const QString& text,const char *file="",const int& ligne=-1);
         static void addDebugNote(const QString& text);
         static DebugEngine *debugEngine;
     public slots:
@@ -113,6 +186,10 @@ class DebugEngine : public QObject
         QString endOfLogFile;
         /// \brief Drop the html entities
         QString htmlEntities(const QString &text);
+        /// \brief the html row of one event
+        QString htmlFormat(const QString &time,const DebugLevel_custom &level,const QString &fileString,const QString &function,const QString &location,const QString &text);
+        /// \brief the html rows of the trace events
+        QString traceHtml();
         /// \brief To store the debug informations
         QString debugHtmlContent;
         /// \brief The current backend
@@ -10,13 +10,18 @@
 #	define __func__ __FUNCTION__
 #endif
 
-/// \brief Macro for the debug log
+/// \brief Macro for the debug log, the text is evaluated only if the level is compiled
 #ifdef ULTRACOPIER_DEBUG
 #	include "DebugEngine.h"
+#	ifdef ULTRACOPIER_DEBUG_NOTICE
+#		define ULTRACOPIER_DEBUG_LEVEL_ENABLED(a) true
+#	else
+#		define ULTRACOPIER_DEBUG_LEVEL_ENABLED(a) ((a)!=Ultracopier::DebugLevel_Notice)
+#	endif
 #	if defined (__FILE__) && defined (__LINE__)
-#		define ULTRACOPIER_DEBUGCONSOLE(a,b) DebugEngine::addDebugInformationStatic(a,__func__,b,__FILE__,__LINE__)
+#		define ULTRACOPIER_DEBUGCONSOLE(a,b) (ULTRACOPIER_DEBUG_LEVEL_ENABLED(a)?DebugEngine::addDebugTraceStatic(a,__func__,b,__FILE__,__LINE__):void())
 #	else
-#		define ULTRACOPIER_DEBUGCONSOLE(a,b) DebugEngine::addDebugInformationStatic(a,__func__,b)
+#		define ULTRACOPIER_DEBUGCONSOLE(a,b) (ULTRACOPIER_DEBUG_LEVEL_ENABLED(a)?DebugEngine::addDebugTraceStatic(a,__func__,b):void())
 #	endif
 #else // ULTRACOPIER_DEBUG
 #	define ULTRACOPIER_DEBUGCONSOLE(a,b) void()
@@ -127,6 +127,7 @@ void DebugModel::addDebugInformation(const int &time,const DebugLevel_custom &le
     item.file=QStringLiteral("%1:%2").arg(file).arg(ligne);
     item.location=location;
     list << item;
+    importantList << item;
     if(!displayed)
     {
         displayed=true;
@@ -136,6 +137,32 @@ void DebugModel::addDebugInformation(const int &time,const DebugLevel_custom &le
         inWaitOfDisplay=true;
 }
 
+void DebugModel::loadTrace()
+{
+    //the two lists are sorted by time, the important event first at the same time
+    const QList<DebugItem> events=DebugTrace::events();
+    QList<DebugItem> newList;
+    newList.reserve(importantList.size()+events.size());
+    int importantIndex=0;
+    int index=0;
+    while(importantIndex<importantList.size() || index<events.size())
+    {
+        if(index>=events.size() || (importantIndex<importantList.size() && importantList.at(importantIndex).time<=events.at(index).time))
+        {
+            newList << importantList.at(importantIndex);
+            importantIndex++;
+        }
+        else
+        {
+            newList << events.at(index);
+            index++;
+        }
+    }
+    beginResetModel();
+    list=newList;
+    endResetModel();
+}
+
 void DebugModel::setupTheTimer()
 {
     if(updateDisplayTimer!=NULL)
@@ -0,0 +1,168 @@
+/** \file DebugTrace.cpp
+\brief Ring buffer by thread of the debug events
+\author alpha_one_x86
+\licence GPL3, see the file COPYING */
+
+#include <QMutexLocker>
+#include <string.h>
+#include <algorithm>
+
+#include "DebugEngine.h"
+
+#ifdef ULTRACOPIER_DEBUG
+
+QMutex DebugTrace::ringsMutex;
+QList<DebugTrace::Ring *> DebugTrace::rings;
+QMutex DebugTrace::stringsMutex;
+QHash<QString,QByteArray> DebugTrace::strings;
+QThreadStorage<DebugTrace::RingOwner *> DebugTrace::ringOwner;
+QThreadStorage<QHash<QPair<QString,int>,DebugTrace::CachedLocation> *> DebugTrace::locationCache;
+
+DebugTrace::RingOwner::RingOwner()
+{
+    QMutexLocker lock_mutex(&ringsMutex);
+    //reuse the ring of a finished thread, its events are kept until overwritten
+    int index=0;
+    while(index<rings.size())
+    {
+        if(!rings.at(index)->used)
+        {
+            ring=rings.at(index);
+            ring->used=true;
+            return;
+        }
+        index++;
+    }
+    ring=new Ring();
+    ring->next=0;
+    ring->used=true;
+    rings << ring;
+}
+
+DebugTrace::RingOwner::~RingOwner()
+{
+    QMutexLocker lock_mutex(&ringsMutex);
+    ring->used=false;
+}
+
+DebugTrace::Ring *DebugTrace::currentRing()
+{
+    if(!ringOwner.hasLocalData())
+        ringOwner.setLocalData(new RingOwner());
+    return ringOwner.localData()->ring;
+}
+
+void DebugTrace::addEvent(const int &time,const DebugLevel_custom &level,const char *function,const QString &text,const char *file,const int &ligne,const char *location)
+{
+    Ring *ring=currentRing();
+    const quint32 number=ring->next;
+    ring->next++;
+    Event &event=ring->events[number%ULTRACOPIER_DEBUG_TRACE_RING_SIZE];
+    //odd: the dump skip this event while it's written
+    event.sequence.fetchAndAddOrdered(1);
+    event.number=number;
+    event.time=time;
+    event.level=level;
+    event.function=function;
+    event.file=file;
+    event.ligne=ligne;
+    event.location=location;
+    event.textSize=text.size();
+    if(event.textSize>ULTRACOPIER_DEBUG_TRACE_TEXT_SIZE)
+        event.textSize=ULTRACOPIER_DEBUG_TRACE_TEXT_SIZE;
+    memcpy(event.text,text.constData(),event.textSize*sizeof(QChar));
+    event.sequence.fetchAndAddOrdered(1);
+}
+
+const char *DebugTrace::internString(const QString &string)
+{
+    QMutexLocker lock_mutex(&stringsMutex);
+    QHash<QString,QByteArray>::const_iterator i=strings.constFind(string);
+    if(i!=strings.constEnd())
+        return i.value().constData();
+    //the QByteArray is implicitly shared, the data don't move when the hash grow
+    return strings.insert(string,string.toUtf8()).value().constData();
+}
+
+void DebugTrace::internLocation(const QString &function,const QString &file,const int &ligne,const QString &location,
+                                const char *&functionString,const char *&fileString,const char *&locationString)
+{
+    if(!locationCache.hasLocalData())
+        locationCache.setLocalData(new QHash<QPair<QString,int>,CachedLocation>());
+    QHash<QPair<QString,int>,CachedLocation> *cache=locationCache.localData();
+    const QPair<QString,int> key(file,ligne);
+    QHash<QPair<QString,int>,CachedLocation>::const_iterator i=cache->constFind(key);
+    //the same file and line into two plugins have not the same location
+    if(i==cache->constEnd() || i.value().location!=location)
+    {
+        CachedLocation cachedLocation;
+        cachedLocation.location=location;
+        cachedLocation.function=internString(function);
+        cachedLocation.file=internString(file);
+        cachedLocation.locationString=internString(location);
+        i=cache->insert(key,cachedLocation);
+    }
+    functionString=i.value().function;
+    fileString=i.value().file;
+    locationString=i.value().locationString;
+}
+
+QList<DebugModel::DebugItem> DebugTrace::events()
+{
+    struct SortedItem
+    {
+        int time;
+        quint32 number;
+        DebugModel::DebugItem item;
+    };
+    QList<SortedItem> sortedItems;
+    {
+        QMutexLocker lock_mutex(&ringsMutex);
+        int indexRing=0;
+        while(indexRing<rings.size())
+        {
+            const Ring *ring=rings.at(indexRing);
+            int index=0;
+            while(index<ULTRACOPIER_DEBUG_TRACE_RING_SIZE)
+            {
+                Event &event=const_cast<Event &>(ring->events[index]);
+                const int sequence=event.sequence.loadAcquire();
+                //never written or in writing
+                if(sequence!=0 && (sequence%2)==0)
+                {
+                    SortedItem sortedItem;
+                    sortedItem.time=event.time;
+                    sortedItem.number=event.number;
+                    sortedItem.item.time=event.time;
+                    sortedItem.item.level=event.level;
+                    sortedItem.item.function=QString::fromUtf8(event.function);
+                    sortedItem.item.file=QString::fromUtf8(event.file);
+                    if(event.ligne!=-1)
+                        sortedItem.item.file+=QStringLiteral(":")+QString::number(event.ligne);
+                    sortedItem.item.location=QString::fromUtf8(event.location);
+                    sortedItem.item.text=QString(event.text,event.textSize);
+                    //overwritten during the copy, drop it
+                    if(event.sequence.fetchAndAddOrdered(0)==sequence)
+                        sortedItems << sortedItem;
+                }
+                index++;
+            }
+            indexRing++;
+        }
+    }
+    std::stable_sort(sortedItems.begin(),sortedItems.end(),[](const SortedItem &a,const SortedItem &b) {
+        if(a.time!=b.time)
+            return a.time<b.time;
+        return a.number<b.number;
+    });
+    QList<DebugModel::DebugItem> returnList;
+    int index=0;
+    while(index<sortedItems.size())
+    {
+        returnList << sortedItems.at(index).item;
+        index++;
+    }
+    return returnList;
+}
+
+#endif // ULTRACOPIER_DEBUG
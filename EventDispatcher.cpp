@@ -42,9 +42,11 @@
 #endif
 
 /// \brief Initiate the ultracopier event dispatcher and check if no other session is running
-EventDispatcher::EventDispatcher()
+EventDispatcher::EventDispatcher(const bool &headless)
 {
+    this->headless=headless;
     qRegisterMetaType<QList<Ultracopier::ReturnActionOnCopyList> >("QList<Ultracopier::ReturnActionOnCopyList>");
+    qRegisterMetaType<Ultracopier::CopyListEvents>("Ultracopier::CopyListEvents");
     qRegisterMetaType<QList<Ultracopier::ProgressionItem> >("QList<Ultracopier::ProgressionItem>");
     qRegisterMetaType<Ultracopier::EngineActionInProgress>("Ultracopier::EngineActionInProgress");
     qRegisterMetaType<QList<QUrl> >("QList<QUrl>");
@@ -56,7 +58,9 @@ EventDispatcher::EventDispatcher()
 
     copyServer=new CopyListener(&optionDialog);
     connect(&localListener, &LocalListener::cli,                    &cliParser,     &CliParser::cli,Qt::QueuedConnection);
-    connect(ThemesManager::themesManager,         &ThemesManager::newThemeOptions,	&optionDialog,	&OptionDialog::newThemeOptions);
+    if(!headless)
+        connect(ThemesManager::themesManager,         &ThemesManager::newThemeOptions,	&optionDialog,	&OptionDialog::newThemeOptions);
+    cliParser.setHeadless(headless);
     connect(&cliParser,     &CliParser::newCopyWithoutDestination,	copyServer,     &CopyListener::copyWithoutDestination);
     connect(&cliParser,     &CliParser::newCopy,					copyServer,     &CopyListener::copy);
     connect(&cliParser,     &CliParser::newMoveWithoutDestination,	copyServer,     &CopyListener::moveWithoutDestination);
@@ -74,7 +78,7 @@ EventDispatcher::EventDispatcher()
     sessionloader=new SessionLoader(&optionDialog);
     #endif
     copyEngineList=new CopyEngineManager(&optionDialog);
-    core=new Core(copyEngineList);
+    core=new Core(copyEngineList,headless);
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("start"));
     //show the ultracopier information
     #if defined(Q_OS_WIN32) || defined(Q_OS_MAC)
@@ -247,6 +251,18 @@ void EventDispatcher::initFunction()
         return;
     }
     localListener.listenServer();
+    if(headless)
+    {
+        //no systray to catch or uncatch the copy, then the listener is the only way to receive the copy with the cli
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"Headless, no systray and no theme");
+        copyServer->listen();
+        copyEngineList->setIsConnected();
+        connect(QCoreApplication::instance(),&QCoreApplication::aboutToQuit,this,&EventDispatcher::quit,Qt::DirectConnection);
+        #ifdef ULTRACOPIER_DEBUG
+        DebugModel::debugModel->setupTheTimer();
+        #endif
+        return;
+    }
     //load the systray icon
     if(backgroundIcon==NULL)
     {
@@ -38,7 +38,8 @@ class EventDispatcher : public QObject
     Q_OBJECT
     public:
         /// \brief Initiate the ultracopier event dispatcher and check if no other session is running
-        EventDispatcher();
+        /// \param headless true to run without systray and theme, the copy are only driven by the cli and the listener
+        EventDispatcher(const bool &headless=false);
         /// \brief Destroy the ultracopier event dispatcher
         ~EventDispatcher();
         /// \brief return if need be close
@@ -80,6 +81,8 @@ class EventDispatcher : public QObject
         SessionLoader *sessionloader;
         #endif
         bool stopIt;
+        /// \brief no systray, no theme, no dialog
+        bool headless;
         CopyListener *copyServer;
         Core *core;
         OptionDialog optionDialog;
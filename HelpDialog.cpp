@@ -46,6 +46,14 @@ HelpDialog::~HelpDialog()
     delete ui;
 }
 
+#ifdef ULTRACOPIER_DEBUG
+void HelpDialog::showEvent(QShowEvent *event)
+{
+    DebugModel::debugModel->loadTrace();
+    QDialog::showEvent(event);
+}
+#endif // ULTRACOPIER_DEBUG
+
 /// \brief To re-translate the ui
 void HelpDialog::changeEvent(QEvent *e)
 {
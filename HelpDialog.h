@@ -11,6 +11,7 @@
 #include <QTimer>
 #include <QColor>
 #include <QBrush>
+#include <QShowEvent>
 
 #include "ui_HelpDialog.h"
 #include "Environment.h"
@@ -32,6 +33,10 @@ class HelpDialog : public QDialog {
     protected:
         /// \brief To re-translate the ui
         void changeEvent(QEvent *e);
+        #ifdef ULTRACOPIER_DEBUG
+        /// \brief the notices are only into the trace rings, loaded into the debug view when shown
+        void showEvent(QShowEvent *event);
+        #endif // ULTRACOPIER_DEBUG
     private:
         Ui::HelpDialog *ui;
         /// \brief To reload the text value
@@ -109,6 +109,7 @@ void LanguagesManager::setCurrentLanguage(const QString &newLanguage)
             indexTranslator++;
         }
         installedTranslator.clear();
+        themePathTranslated.clear();
     }
     int index=0;
     while(index<LanguagesAvailableList.size())
@@ -130,29 +131,24 @@ void LanguagesManager::setCurrentLanguage(const QString &newLanguage)
                 int indexPluginIndex=0;
                 while(indexPluginIndex<listLoadedPlugins.size())
                 {
-                    if(listLoadedPlugins.at(indexPluginIndex).category!=PluginType_Languages)
+                    const PluginsAvailable &plugin=listLoadedPlugins.at(indexPluginIndex);
+                    //the translation of the theme is loaded only for the theme used
+                    if(plugin.category!=PluginType_Languages && (plugin.category!=PluginType_Themes || plugin.path==themePath))
                     {
-                        QString tempPath=listLoadedPlugins.at(indexPluginIndex).path+QStringLiteral("Languages")+QDir::separator()+LanguagesAvailableList.at(index).mainShortName+QDir::separator()+QStringLiteral("translation.qm");
+                        QString tempPath=plugin.path+QStringLiteral("Languages")+QDir::separator()+LanguagesAvailableList.at(index).mainShortName+QDir::separator()+QStringLiteral("translation.qm");
                         if(QFile::exists(tempPath))
+                        {
                             fileToLoad<<tempPath;
+                            if(plugin.category==PluginType_Themes)
+                                themePathTranslated<<plugin.path;
+                        }
                     }
                     indexPluginIndex++;
                 }
                 int indexTranslationFile=0;
                 while(indexTranslationFile<fileToLoad.size())
                 {
-                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("Translation to load: ")+fileToLoad.at(indexTranslationFile));
-                    temp=new QTranslator();
-                    if(!temp->load(fileToLoad.at(indexTranslationFile)) || temp->isEmpty())
-                    {
-                        delete temp;
-                        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("Unable to load the translation file: ")+fileToLoad.at(indexTranslationFile));
-                    }
-                    else
-                    {
-                        QCoreApplication::installTranslator(temp);
-                        installedTranslator<<temp;
-                    }
+                    installTranslation(fileToLoad.at(indexTranslationFile));
                     indexTranslationFile++;
                 }
                 temp=new QTranslator();
@@ -186,6 +182,38 @@ void LanguagesManager::setCurrentLanguage(const QString &newLanguage)
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"unable to found language: "+newLanguage+", LanguagesAvailableList.size(): "+QString::number(LanguagesAvailableList.size()));
 }
 
+bool LanguagesManager::installTranslation(const QString &file)
+{
+    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("Translation to load: ")+file);
+    QTranslator *temp=new QTranslator();
+    if(!temp->load(file) || temp->isEmpty())
+    {
+        delete temp;
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("Unable to load the translation file: ")+file);
+        return false;
+    }
+    QCoreApplication::installTranslator(temp);
+    installedTranslator<<temp;
+    return true;
+}
+
+void LanguagesManager::setThemePath(const QString &themePath)
+{
+    if(this->themePath==themePath)
+        return;
+    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("theme used: ")+themePath);
+    this->themePath=themePath;
+    //language not loaded yet, or already translated
+    if(currentLanguage.isEmpty() || currentLanguage==QStringLiteral("en") || themePathTranslated.contains(themePath))
+        return;
+    QString tempPath=themePath+QStringLiteral("Languages")+QDir::separator()+currentLanguage+QDir::separator()+QStringLiteral("translation.qm");
+    if(!QFile::exists(tempPath))
+        return;
+    themePathTranslated<<themePath;
+    if(installTranslation(tempPath))
+        emit newLanguageLoaded(currentLanguage);
+}
+
 /// \brief check if short name is found into language
 QString LanguagesManager::getMainShortName(const QString &shortName) const
 {
@@ -36,6 +36,8 @@ class LanguagesManager : public QObject
         LanguagesManager();
         /// \brief Destroy the language manager
         ~LanguagesManager();
+        /// \brief set the theme used, the translation of the other themes are not loaded
+        void setThemePath(const QString &themePath);
     private:
         /** \brief To set the current language
         \param newLanguage Should be short name code found into informations.xml of language file */
@@ -57,6 +59,11 @@ class LanguagesManager : public QObject
         /// \brief list of installed translator
         QList<QTranslator *> installedTranslator;
         QString currentLanguage;
+        QString themePath;
+        /// \brief the themes with the translation installed, to not install it twice
+        QStringList themePathTranslated;
+        /// \brief load and install the translation file, return false if failed
+        bool installTranslation(const QString &file);
         /// \brief load the language selected
         QString getTheRightLanguage() const;
     private slots:
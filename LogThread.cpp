@@ -9,6 +9,12 @@
 #include "ResourcesManager.h"
 #include "OptionEngine.h"
 
+#include <QTimer>
+#include <QDir>
+#include <QFileInfo>
+#include <QJsonObject>
+#include <QJsonDocument>
+
 #ifdef Q_OS_WIN32
     #ifndef NOMINMAX
         #define NOMINMAX
@@ -41,9 +47,39 @@ QString LogThread::text_var_operation=QStringLiteral("%operation%");
 QString LogThread::text_var_rmPath=QStringLiteral("%rmPath%");
 QString LogThread::text_var_mkPath=QStringLiteral("%mkPath%");
 
+QThreadStorage<LogThread::LogRecordCache *> LogThread::recordCache;
+
+LogThread::LogRecordCache::LogRecordCache()
+{
+    first=NULL;
+}
+
+LogThread::LogRecordCache::~LogRecordCache()
+{
+    while(first!=NULL)
+    {
+        LogRecord *next=first->next.load();
+        delete first;
+        first=next;
+    }
+}
+
 LogThread::LogThread()
 {
     sync=false;
+    format=0;
+    rotate_size=0;
+    compress_rotated=false;
+    //the stub node, the tail is always a record already read
+    queueTail=new LogRecord();
+    queueHead.storeRelease(queueTail);
+    queueSize.storeRelease(0);
+    freeRecords.storeRelease(NULL);
+    pooledCount.storeRelease(0);
+    recycledFirst=NULL;
+    recycledLast=NULL;
+    clockStart=QDateTime::currentDateTime();
+    clock.start();
 
     connect(OptionEngine::optionEngine,&OptionEngine::newOptionValue,	this,	&LogThread::newOptionValue);
 
@@ -52,7 +88,7 @@ LogThread::LogThread()
     moveToThread(this);
     start(QThread::IdlePriority);
 
-    connect(this,	&LogThread::newData,		this,&LogThread::realDataWrite,Qt::QueuedConnection);
+    connect(this,	&LogThread::batchReady,		this,&LogThread::writeBatch,Qt::QueuedConnection);
 
     newOptionValue(QStringLiteral("Write_log"),	QStringLiteral("transfer"),			OptionEngine::optionEngine->getOptionValue(QStringLiteral("Write_log"),QStringLiteral("transfer")));
     newOptionValue(QStringLiteral("Write_log"),	QStringLiteral("error"),			OptionEngine::optionEngine->getOptionValue(QStringLiteral("Write_log"),QStringLiteral("error")));
@@ -62,6 +98,9 @@ LogThread::LogThread()
     newOptionValue(QStringLiteral("Write_log"),	QStringLiteral("error_format"),		OptionEngine::optionEngine->getOptionValue(QStringLiteral("Write_log"),QStringLiteral("error_format")));
     newOptionValue(QStringLiteral("Write_log"),	QStringLiteral("folder_format"),	OptionEngine::optionEngine->getOptionValue(QStringLiteral("Write_log"),QStringLiteral("folder_format")));
     newOptionValue(QStringLiteral("Write_log"),	QStringLiteral("sync"),				OptionEngine::optionEngine->getOptionValue(QStringLiteral("Write_log"),QStringLiteral("sync")));
+    newOptionValue(QStringLiteral("Write_log"),	QStringLiteral("format"),			OptionEngine::optionEngine->getOptionValue(QStringLiteral("Write_log"),QStringLiteral("format")));
+    newOptionValue(QStringLiteral("Write_log"),	QStringLiteral("rotate_size"),		OptionEngine::optionEngine->getOptionValue(QStringLiteral("Write_log"),QStringLiteral("rotate_size")));
+    newOptionValue(QStringLiteral("Write_log"),	QStringLiteral("compress_rotated"),	OptionEngine::optionEngine->getOptionValue(QStringLiteral("Write_log"),QStringLiteral("compress_rotated")));
     newOptionValue(QStringLiteral("Write_log"),	QStringLiteral("enabled"),			OptionEngine::optionEngine->getOptionValue(QStringLiteral("Write_log"),QStringLiteral("enabled")));
     #ifdef Q_OS_WIN32
     DWORD size=0;
@@ -89,9 +128,21 @@ LogThread::LogThread()
 
 LogThread::~LogThread()
 {
-    closeLogs();
     quit();
     wait();
+    //the thread is stopped, write the last records from here
+    closeLogs();
+    while(popRecord()!=NULL)
+    {}
+    delete queueTail;
+    publishRecycledRecords();
+    LogRecord *record=freeRecords.fetchAndStoreAcquire(NULL);
+    while(record!=NULL)
+    {
+        LogRecord *next=record->next.load();
+        delete record;
+        record=next;
+    }
 }
 
 bool LogThread::logTransfer() const
@@ -134,26 +185,101 @@ void LogThread::openLogs()
 
 void LogThread::closeLogs()
 {
-    if(log.isOpen() && data.size()>0)
-        log.write(data.toUtf8());
+    writeBatch();
     log.close();
 }
 
+LogThread::LogRecord *LogThread::newRecord(const LogRecordType &type)
+{
+    if(!recordCache.hasLocalData())
+        recordCache.setLocalData(new LogRecordCache());
+    LogRecordCache *cache=recordCache.localData();
+    //take all the recycled records, without compare and swap
+    if(cache->first==NULL)
+        cache->first=freeRecords.fetchAndStoreAcquire(NULL);
+    LogRecord *record;
+    if(cache->first==NULL)
+        record=new LogRecord();
+    else
+    {
+        record=cache->first;
+        cache->first=record->next.load();
+        pooledCount.fetchAndAddRelaxed(-1);
+    }
+    record->type=type;
+    record->time=clock.elapsed();
+    return record;
+}
+
+void LogThread::recycleRecord(LogRecord *record)
+{
+    if(pooledCount.load()>=ULTRACOPIER_LOG_RECORD_POOL)
+    {
+        delete record;
+        return;
+    }
+    pooledCount.fetchAndAddRelaxed(1);
+    record->source.clear();
+    record->destination.clear();
+    record->error.clear();
+    record->mtime=QDateTime();
+    record->next.store(NULL);
+    if(recycledLast==NULL)
+        recycledFirst=record;
+    else
+        recycledLast->next.store(record);
+    recycledLast=record;
+}
+
+void LogThread::publishRecycledRecords()
+{
+    if(recycledFirst==NULL)
+        return;
+    //only this thread push, then the head can't be taken and put back between the load and the swap
+    LogRecord *head;
+    do
+    {
+        head=freeRecords.loadAcquire();
+        recycledLast->next.store(head);
+    } while(!freeRecords.testAndSetRelease(head,recycledFirst));
+    recycledFirst=NULL;
+    recycledLast=NULL;
+}
+
+void LogThread::pushRecord(LogRecord *record)
+{
+    record->next.storeRelease(NULL);
+    LogRecord *previous=queueHead.fetchAndStoreOrdered(record);
+    previous->next.storeRelease(record);
+    const int previousSize=queueSize.fetchAndAddOrdered(1);
+    //wake up the thread before the group commit interval when too many records are waiting, or at once with sync
+    if(previousSize+1==ULTRACOPIER_LOG_GROUP_COMMIT_RECORDS || (sync && previousSize==0))
+        emit batchReady();
+}
+
+LogThread::LogRecord *LogThread::popRecord()
+{
+    LogRecord *next=queueTail->next.loadAcquire();
+    if(next==NULL)
+        return NULL;
+    recycleRecord(queueTail);
+    queueTail=next;
+    return next;
+}
+
 void LogThread::newTransferStart(const Ultracopier::ItemOfCopyList &item)
 {
     if(!logTransfer())
         return;
-    QString text;
+    LogRecord *record;
     if(item.mode==Ultracopier::Copy)
-        text=LogThread::text_header_copy+transfer_format+lineReturn;
+        record=newRecord(LogRecordType_Copy);
     else
-        text=LogThread::text_header_move+transfer_format+lineReturn;
-    text=replaceBaseVar(text);
-    //Variable is %source%, %size%, %destination%
-    text=text.replace(LogThread::text_var_source,item.sourceFullPath);
-    text=text.replace(LogThread::text_var_size,QString::number(item.size));
-    text=text.replace(LogThread::text_var_destination,item.destinationFullPath);
-    emit newData(text);
+        record=newRecord(LogRecordType_Move);
+    record->source=item.sourceFullPath;
+    record->size=item.size;
+    record->destination=item.destinationFullPath;
+    pushRecord(record);
 }
 
 /** method called when new transfer is started */
@@ -161,64 +287,233 @@ void LogThread::transferSkip(const Ultracopier::ItemOfCopyList &item)
 {
     if(!logTransfer())
         return;
-    QString text=LogThread::text_header_skip+transfer_format+lineReturn;
-    text=replaceBaseVar(text);
-    //Variable is %source%, %size%, %destination%
-    text=text.replace(LogThread::text_var_source,item.sourceFullPath);
-    text=text.replace(LogThread::text_var_size,QString::number(item.size));
-    text=text.replace(LogThread::text_var_destination,item.destinationFullPath);
-    emit newData(text);
+    LogRecord *record=newRecord(LogRecordType_Skip);
+    record->source=item.sourceFullPath;
+    record->size=item.size;
+    record->destination=item.destinationFullPath;
+    pushRecord(record);
 }
 
 void LogThread::newTransferStop(const Ultracopier::ItemOfCopyList &item)
 {
     if(!logTransfer())
         return;
-    QString text=LogThread::text_header_stop+transfer_format+lineReturn;
-    text=replaceBaseVar(text);
-    //Variable is %source%, %size%, %destination%
-    text=text.replace(LogThread::text_var_source,item.sourceFullPath);
-    text=text.replace(LogThread::text_var_size,QString::number(item.size));
-    text=text.replace(LogThread::text_var_destination,item.destinationFullPath);
-    emit newData(text);
+    LogRecord *record=newRecord(LogRecordType_Stop);
+    record->source=item.sourceFullPath;
+    record->size=item.size;
+    record->destination=item.destinationFullPath;
+    pushRecord(record);
 }
 
 void LogThread::error(const QString &path,const quint64 &size,const QDateTime &mtime,const QString &error)
 {
     if(!log_enable_error)
         return;
-    QString text=LogThread::text_header_error+error_format+lineReturn;
-    text=replaceBaseVar(text);
-    //Variable is %path%, %size%, %mtime%, %error%
-    text=text.replace(LogThread::text_var_path,path);
-    text=text.replace(LogThread::text_var_size,QString::number(size));
-    text=text.replace(LogThread::text_var_mtime,mtime.toString(Qt::ISODate));
-    text=text.replace(LogThread::text_var_error,error);
-    emit newData(text);
+    LogRecord *record=newRecord(LogRecordType_Error);
+    record->source=path;
+    record->size=size;
+    record->mtime=mtime;
+    record->error=error;
+    pushRecord(record);
 }
 
 void LogThread::run()
 {
+    QTimer groupCommit;
+    groupCommit.setInterval(ULTRACOPIER_LOG_GROUP_COMMIT_INTERVAL);
+    connect(&groupCommit,&QTimer::timeout,this,&LogThread::writeBatch);
+    groupCommit.start();
     exec();
 }
 
-void LogThread::realDataWrite(const QString &text)
+void LogThread::writeBatch()
 {
-    #ifdef ULTRACOPIER_DEBUG
+    QString text;
+    QByteArray data;
+    int count=0;
+    LogRecord *record=popRecord();
+    while(record!=NULL)
+    {
+        if(format==1)
+            formatJson(data,*record);
+        else
+            formatText(text,*record);
+        count++;
+        record=popRecord();
+    }
+    publishRecycledRecords();
+    if(count==0)
+        return;
+    //with sync, the records pushed during this batch are written at once too
+    if(queueSize.fetchAndAddOrdered(-count)>count && sync)
+        emit batchReady();
     if(!log.isOpen())
     {
-        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,"transfer log not open");
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("transfer log not open, %1 records dropped").arg(count));
         return;
     }
-    #endif // ULTRACOPIER_DEBUG
-    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("start"));
-    if(log.write(text.toUtf8())==-1)
+    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("write %1 records").arg(count));
+    if(format!=1)
+        data=text.toUtf8();
+    if(log.write(data)==-1)
     {
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QString("unable to write into transfer log: %1").arg(log.errorString()));
         return;
     }
+    //one flush by batch, not by line
     if(sync)
         log.flush();
+    if(rotate_size>0 && log.size()>=rotate_size)
+        rotateLogs();
+}
+
+void LogThread::formatText(QString &text,const LogRecord &record) const
+{
+    QString line;
+    switch(record.type)
+    {
+        case LogRecordType_Copy:
+            line=LogThread::text_header_copy+transfer_format+lineReturn;
+        break;
+        case LogRecordType_Move:
+            line=LogThread::text_header_move+transfer_format+lineReturn;
+        break;
+        case LogRecordType_Skip:
+            line=LogThread::text_header_skip+transfer_format+lineReturn;
+        break;
+        case LogRecordType_Stop:
+            line=LogThread::text_header_stop+transfer_format+lineReturn;
+        break;
+        case LogRecordType_Error:
+            line=LogThread::text_header_error+error_format+lineReturn;
+        break;
+        case LogRecordType_MkPath:
+            line=LogThread::text_header_MkPath+folder_format+lineReturn;
+        break;
+        case LogRecordType_RmPath:
+            line=LogThread::text_header_RmPath+folder_format+lineReturn;
+        break;
+    }
+    line=replaceBaseVar(line,recordDateTime(record));
+    switch(record.type)
+    {
+        case LogRecordType_Error:
+            //Variable is %path%, %size%, %mtime%, %error%
+            line=line.replace(LogThread::text_var_path,record.source);
+            line=line.replace(LogThread::text_var_size,QString::number(record.size));
+            line=line.replace(LogThread::text_var_mtime,record.mtime.toString(Qt::ISODate));
+            line=line.replace(LogThread::text_var_error,record.error);
+        break;
+        case LogRecordType_MkPath:
+        case LogRecordType_RmPath:
+            //Variable is %operation% %path%
+            line=line.replace(LogThread::text_var_path,record.source);
+            if(record.type==LogRecordType_MkPath)
+                line=line.replace(LogThread::text_var_operation,LogThread::text_var_mkPath);
+            else
+                line=line.replace(LogThread::text_var_operation,LogThread::text_var_rmPath);
+        break;
+        default:
+            //Variable is %source%, %size%, %destination%
+            line=line.replace(LogThread::text_var_source,record.source);
+            line=line.replace(LogThread::text_var_size,QString::number(record.size));
+            line=line.replace(LogThread::text_var_destination,record.destination);
+        break;
+    }
+    text+=line;
+}
+
+void LogThread::formatJson(QByteArray &data,const LogRecord &record) const
+{
+    QJsonObject object;
+    object.insert(QStringLiteral("time"),recordDateTime(record).toString(Qt::ISODate));
+    switch(record.type)
+    {
+        case LogRecordType_Error:
+            object.insert(QStringLiteral("operation"),QStringLiteral("error"));
+            object.insert(QStringLiteral("path"),record.source);
+            object.insert(QStringLiteral("size"),(double)record.size);
+            object.insert(QStringLiteral("mtime"),record.mtime.toString(Qt::ISODate));
+            object.insert(QStringLiteral("error"),record.error);
+        break;
+        case LogRecordType_MkPath:
+        case LogRecordType_RmPath:
+            if(record.type==LogRecordType_MkPath)
+                object.insert(QStringLiteral("operation"),QStringLiteral("mkpath"));
+            else
+                object.insert(QStringLiteral("operation"),QStringLiteral("rmpath"));
+            object.insert(QStringLiteral("path"),record.source);
+        break;
+        default:
+            if(record.type==LogRecordType_Copy)
+                object.insert(QStringLiteral("operation"),QStringLiteral("copy"));
+            else if(record.type==LogRecordType_Move)
+                object.insert(QStringLiteral("operation"),QStringLiteral("move"));
+            else if(record.type==LogRecordType_Skip)
+                object.insert(QStringLiteral("operation"),QStringLiteral("skip"));
+            else
+                object.insert(QStringLiteral("operation"),QStringLiteral("stop"));
+            object.insert(QStringLiteral("source"),record.source);
+            object.insert(QStringLiteral("size"),(double)record.size);
+            object.insert(QStringLiteral("destination"),record.destination);
+        break;
+    }
+    data+=QJsonDocument(object).toJson(QJsonDocument::Compact);
+    data+='\n';
+}
+
+void LogThread::rotateLogs()
+{
+    const QString fileName=log.fileName();
+    log.close();
+    const QString segment=fileName+QStringLiteral(".")+QDateTime::currentDateTime().toString(QStringLiteral("yyyyMMdd-hhmmss-zzz"));
+    if(!QFile::rename(fileName,segment))
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("unable to rotate the transfer log to: %1").arg(segment));
+    else
+    {
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("transfer log rotated to: %1").arg(segment));
+        if(compress_rotated)
+            compressSegment(segment);
+    }
+    //remove the older segments, the name have the date then the name order is the time order
+    QFileInfo fileInfo(fileName);
+    QDir folder=fileInfo.absoluteDir();
+    QStringList segments=folder.entryList(QStringList() << fileInfo.fileName()+QStringLiteral(".*"),QDir::Files,QDir::Name);
+    while(segments.size()>ULTRACOPIER_LOG_ROTATED_SEGMENTS)
+    {
+        if(!folder.remove(segments.first()))
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("unable to remove the old transfer log: %1").arg(segments.first()));
+        segments.removeFirst();
+    }
+    log.setFileName(fileName);
+    QIODevice::OpenMode mode=QIODevice::WriteOnly;
+    if(sync)
+        mode|=QIODevice::Unbuffered;
+    if(!log.open(mode))
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QString("Unable to open the log file, error: %1").arg(log.errorString()));
+}
+
+/// \brief compress the segment with qCompress(), can be read back with qUncompress()
+void LogThread::compressSegment(const QString &path)
+{
+    QFile source(path);
+    if(!source.open(QIODevice::ReadOnly))
+    {
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("unable to open the segment to compress: %1").arg(source.errorString()));
+        return;
+    }
+    const QByteArray compressed=qCompress(source.readAll());
+    source.close();
+    QFile destination(path+QStringLiteral(".z"));
+    if(!destination.open(QIODevice::WriteOnly) || destination.write(compressed)!=compressed.size())
+    {
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("unable to write the compressed segment: %1").arg(destination.errorString()));
+        destination.close();
+        destination.remove();
+        return;
+    }
+    destination.close();
+    source.remove();
 }
 
 void LogThread::newOptionValue(const QString &group,const QString &name,const QVariant &value)
@@ -242,6 +537,12 @@ void LogThread::newOptionValue(const QString &group,const QString &name,const QV
                 log.flush();
         }
     }
+    else if(name==QStringLiteral("format"))
+        format=value.toInt();
+    else if(name==QStringLiteral("rotate_size"))
+        rotate_size=(qint64)value.toUInt()*1024*1024;
+    else if(name==QStringLiteral("compress_rotated"))
+        compress_rotated=value.toBool();
     else if(name==QStringLiteral("transfer"))
         log_enable_transfer=OptionEngine::optionEngine->getOptionValue("Write_log","enabled").toBool() && value.toBool();
     else if(name==QStringLiteral("error"))
@@ -258,9 +559,14 @@ void LogThread::newOptionValue(const QString &group,const QString &name,const QV
     }
 }
 
-QString LogThread::replaceBaseVar(QString text)
+QDateTime LogThread::recordDateTime(const LogRecord &record) const
+{
+    return clockStart.addMSecs(record.time);
+}
+
+QString LogThread::replaceBaseVar(QString text,const QDateTime &time) const
 {
-    text=text.replace(LogThread::text_var_time,QDateTime::currentDateTime().toString(LogThread::text_var_timestring));
+    text=text.replace(LogThread::text_var_time,time.toString(LogThread::text_var_timestring));
     #ifdef Q_OS_WIN32
     text=text.replace(LogThread::text_var_computer,computer);
     text=text.replace(LogThread::text_var_user,user);
@@ -272,22 +578,18 @@ void LogThread::rmPath(const QString &path)
 {
     if(!logTransfer())
         return;
-    QString text=LogThread::text_header_RmPath+folder_format+lineReturn;
-    text=replaceBaseVar(text);
-    //Variable is %operation% %path%
-    text=text.replace(LogThread::text_var_path,path);
-    text=text.replace(LogThread::text_var_operation,LogThread::text_var_rmPath);
-    emit newData(text);
+    LogRecord *record=newRecord(LogRecordType_RmPath);
+    record->source=path;
+    record->size=0;
+    pushRecord(record);
 }
 
 void LogThread::mkPath(const QString &path)
 {
     if(!logTransfer())
         return;
-    QString text=LogThread::text_header_MkPath+folder_format+lineReturn;
-    text=replaceBaseVar(text);
-    //Variable is %operation% %path%
-    text=text.replace(LogThread::text_var_path,path);
-    text=text.replace(LogThread::text_var_operation,LogThread::text_var_mkPath);
-    emit newData(text);
+    LogRecord *record=newRecord(LogRecordType_MkPath);
+    record->source=path;
+    record->size=0;
+    pushRecord(record);
 }
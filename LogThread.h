@@ -11,6 +11,11 @@
 #include <QDateTime>
 #include <QVariant>
 #include <QFile>
+#include <QByteArray>
+#include <QAtomicPointer>
+#include <QAtomicInt>
+#include <QElapsedTimer>
+#include <QThreadStorage>
 
 #include "Environment.h"
 #include "StructEnumDefinition.h"
@@ -18,6 +23,9 @@
 /** \brief Log all the user oriented activity
 
 It use thread based storage to prevent gui thread freeze on log file writing when is out of the disk buffer. That's allow to async the event.
+The callers only push a record into a lock-free queue, the thread format the records and write them by batch (group commit),
+every ULTRACOPIER_LOG_GROUP_COMMIT_INTERVAL ms or when ULTRACOPIER_LOG_GROUP_COMMIT_RECORDS records are waiting, or at once with sync.
+The callers take the record from a pool and only read a monotonic clock, the date is computed into the log thread.
 */
 class LogThread : public QThread
 {
@@ -44,20 +52,78 @@ public slots:
     /** method called when one folder is created */
     void mkPath(const QString &path);
 private slots:
-    /** \to write the data into the file */
-    void realDataWrite(const QString &text);
+    /** \to format and write all the waiting records into the file */
+    void writeBatch();
     /** \to update the options value */
     void newOptionValue(const QString &group,const QString &name,const QVariant &value);
 signals:
-    void newData(const QString &text) const;
+    void batchReady() const;
 private:
-    QString data;
+    enum LogRecordType
+    {
+        LogRecordType_Copy,
+        LogRecordType_Move,
+        LogRecordType_Skip,
+        LogRecordType_Stop,
+        LogRecordType_Error,
+        LogRecordType_MkPath,
+        LogRecordType_RmPath
+    };
+    /// \brief the log entry, formated only into the log thread
+    struct LogRecord
+    {
+        LogRecordType type;
+        qint64 time;///< ms since clockStart
+        QString source;///< the path for the error and the folder
+        QString destination;
+        quint64 size;
+        QDateTime mtime;
+        QString error;
+        QAtomicPointer<LogRecord> next;
+    };
+    /** \brief multi producer single consumer queue, the producers only exchange the head
+     * the consumer keep the tail which is the last record already read */
+    QAtomicPointer<LogRecord> queueHead;
+    LogRecord *queueTail;
+    QAtomicInt queueSize;
+    /// \brief the records of one producer thread, taken from freeRecords when empty
+    struct LogRecordCache
+    {
+        LogRecordCache();
+        ~LogRecordCache();
+        LogRecord *first;
+    };
+    static QThreadStorage<LogRecordCache *> recordCache;
+    /** \brief the recycled records, the log thread push a chain of records, a producer take all the chain
+     * then no ABA problem: only the log thread do compare and swap */
+    QAtomicPointer<LogRecord> freeRecords;
+    QAtomicInt pooledCount;
+    //the records recycled by the current batch, only into the log thread
+    LogRecord *recycledFirst;
+    LogRecord *recycledLast;
+    /// \brief the clock of the record time, the date is clockStart plus the elapsed time
+    QElapsedTimer clock;
+    QDateTime clockStart;
+    /// \brief return a record from the pool or a new one, with its time set
+    LogRecord *newRecord(const LogRecordType &type);
+    void recycleRecord(LogRecord *record);
+    /// \brief give the records recycled by the batch to the producers
+    void publishRecycledRecords();
+    void pushRecord(LogRecord *record);
+    /// \brief return the next record or NULL if empty, only into the log thread
+    LogRecord *popRecord();
+    void formatText(QString &text,const LogRecord &record) const;
+    void formatJson(QByteArray &data,const LogRecord &record) const;
+    /// \brief move the log file to a segment and open a new one
+    void rotateLogs();
+    void compressSegment(const QString &path);
     QString transfer_format;
     QString error_format;
     QString folder_format;
     QFile log;
     QString lineReturn;
-    QString replaceBaseVar(QString text);
+    QString replaceBaseVar(QString text,const QDateTime &time) const;
+    QDateTime recordDateTime(const LogRecord &record) const;
     #ifdef Q_OS_WIN32
     QString computer;
     QString user;
@@ -67,6 +133,9 @@ private:
     bool log_enable_transfer;
     bool log_enable_error;
     bool log_enable_folder;
+    int format;
+    qint64 rotate_size;
+    bool compress_rotated;
 
     static QString text_header_copy;
     static QString text_header_move;
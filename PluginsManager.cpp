@@ -10,6 +10,9 @@
 #include <QFileDialog>
 #include <QFile>
 #include <QFileInfo>
+#include <QSaveFile>
+#include <QDataStream>
+#include <QTextStream>
 
 #include "PluginsManager.h"
 
@@ -95,25 +98,33 @@ void PluginsManager::run()
     readPath << ResourcesManager::resourcesManager->getReadPath();
     pluginsList.clear();
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("pluginsList.size(): ")+QString::number(pluginsList.size()));
-    foreach(QString basePath,readPath)
+    //if nothing have changed since the last start, no xml to parse and no dependencies to check
+    if(!loadPluginCache(readPath))
     {
-        foreach(QString dirSub,englishPluginType)
+        foreach(QString basePath,readPath)
         {
-            QString pluginComposed=basePath+dirSub+QDir::separator();
-            QDir dir(pluginComposed);
-            if(stopIt)
-                return;
-            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("search plugin into: ")+pluginComposed);
-            if(dir.exists())
+            foreach(QString dirSub,englishPluginType)
             {
-                foreach(QString dirName, dir.entryList(QDir::Dirs|QDir::NoDotAndDotDot))
+                QString pluginComposed=basePath+dirSub+QDir::separator();
+                QDir dir(pluginComposed);
+                if(stopIt)
+                    return;
+                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("search plugin into: ")+pluginComposed);
+                if(dir.exists())
                 {
-                    if(stopIt)
-                        return;
-                    loadPluginInformation(pluginComposed+dirName+QDir::separator());
+                    foreach(QString dirName, dir.entryList(QDir::Dirs|QDir::NoDotAndDotDot))
+                    {
+                        if(stopIt)
+                            return;
+                        loadPluginInformation(pluginComposed+dirName+QDir::separator());
+                    }
                 }
             }
         }
+        #ifndef ULTRACOPIER_PLUGIN_ALL_IN_ONE
+        while(checkDependencies()!=0){};
+        #endif
+        savePluginCache(readPath);
     }
     #ifdef ULTRACOPIER_DEBUG
     int index_debug=0;
@@ -125,9 +136,6 @@ void PluginsManager::run()
         index_debug++;
     }
     #endif
-    #ifndef ULTRACOPIER_PLUGIN_ALL_IN_ONE
-    while(checkDependencies()!=0){};
-    #endif
     //QList<PluginsAvailable> list;
     int index=0;
     while(index<pluginsList.size())
@@ -138,6 +146,167 @@ void PluginsManager::run()
     }
 }
 
+/// \brief return the size and the modification time, -1 if not exists, to detect the change without read it
+void PluginsManager::fileState(const QString &path,qint64 &size,qint64 &mtime) const
+{
+    const QFileInfo fileInfo(path);
+    if(!fileInfo.exists())
+    {
+        size=-1;
+        mtime=-1;
+        return;
+    }
+    size=fileInfo.size();
+    mtime=fileInfo.lastModified().toMSecsSinceEpoch();
+}
+
+/** \brief load the plugin list from the cache
+ * The cache is valid if the plugin type folders have the same modification time (no plugin added or removed)
+ * and if the informations.xml have the same size and modification time
+ * \return false if the cache is missing or not valid, then the plugins need be scanned */
+bool PluginsManager::loadPluginCache(const QStringList &readPath)
+{
+    if(ResourcesManager::resourcesManager->getWritablePath().isEmpty())
+        return false;
+    QFile cacheFile(ResourcesManager::resourcesManager->getWritablePath()+QStringLiteral(ULTRACOPIER_PLUGIN_CACHE_FILE));
+    if(!cacheFile.open(QIODevice::ReadOnly))
+    {
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("no plugin cache: ")+cacheFile.fileName());
+        return false;
+    }
+    QDataStream in(&cacheFile);
+    in.setVersion(QDataStream::Qt_5_0);
+    quint32 cacheVersion;
+    in >> cacheVersion;
+    if(in.status()!=QDataStream::Ok || cacheVersion!=ULTRACOPIER_PLUGIN_CACHE_VERSION)
+    {
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("plugin cache with other format"));
+        return false;
+    }
+    QString version,platform;
+    QStringList cacheReadPath;
+    in >> version >> platform >> cacheReadPath;
+    if(in.status()!=QDataStream::Ok || version!=QStringLiteral(ULTRACOPIER_VERSION) || platform!=QStringLiteral(ULTRACOPIER_PLATFORM_CODE) || cacheReadPath!=readPath)
+    {
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("plugin cache for other version or other path"));
+        return false;
+    }
+    qint64 size,mtime,cacheSize,cacheMtime;
+    //the folder modification time change when a plugin is added or removed
+    quint32 folderCount;
+    in >> folderCount;
+    quint32 index=0;
+    while(index<folderCount)
+    {
+        QString path;
+        in >> path >> cacheSize >> cacheMtime;
+        if(in.status()!=QDataStream::Ok)
+            return false;
+        fileState(path,size,mtime);
+        if(size!=cacheSize || mtime!=cacheMtime)
+        {
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("plugin folder changed: ")+path);
+            return false;
+        }
+        index++;
+    }
+    quint32 pluginCount;
+    in >> pluginCount;
+    QList<PluginsAvailable> cacheList;
+    index=0;
+    while(index<pluginCount)
+    {
+        PluginsAvailable tempPlugin;
+        quint8 category;
+        QString categorySpecific;
+        in >> cacheSize >> cacheMtime >> category >> tempPlugin.path >> tempPlugin.name >> tempPlugin.writablePath >> categorySpecific
+           >> tempPlugin.version >> tempPlugin.informations >> tempPlugin.errorString >> tempPlugin.isWritable >> tempPlugin.isAuth;
+        if(in.status()!=QDataStream::Ok)
+            return false;
+        fileState(tempPlugin.path+QStringLiteral("informations.xml"),size,mtime);
+        if(size!=cacheSize || mtime!=cacheMtime)
+        {
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("plugin changed: ")+tempPlugin.path);
+            return false;
+        }
+        tempPlugin.category=(PluginType)category;
+        //only this small part is parsed, it's used by the languages
+        if(!categorySpecific.isEmpty())
+        {
+            QDomDocument domDocument;
+            if(domDocument.setContent(categorySpecific))
+                tempPlugin.categorySpecific=domDocument.documentElement();
+        }
+        cacheList << tempPlugin;
+        index++;
+    }
+    editionSemList.acquire();
+    pluginsList=cacheList;
+    index=0;
+    while(index<(quint32)pluginsList.size())
+    {
+        if(pluginsList.at(index).errorString.isEmpty())
+            pluginsListIndexed.insert(pluginsList.at(index).category,pluginsList.at(index));
+        index++;
+    }
+    editionSemList.release();
+    index=0;
+    while(index<(quint32)pluginsList.size())
+    {
+        if(!pluginsList.at(index).errorString.isEmpty())
+            emit onePluginInErrorAdded(pluginsList.at(index));
+        index++;
+    }
+    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Information,QStringLiteral("plugins loaded from the cache: ")+QString::number(pluginsList.size()));
+    return true;
+}
+
+/// \brief save the plugin list with the state of the scanned folders and files
+void PluginsManager::savePluginCache(const QStringList &readPath)
+{
+    if(ResourcesManager::resourcesManager->getWritablePath().isEmpty())
+        return;
+    //write into temporary file and rename, then the cache is never partially written
+    QSaveFile cacheFile(ResourcesManager::resourcesManager->getWritablePath()+QStringLiteral(ULTRACOPIER_PLUGIN_CACHE_FILE));
+    if(!cacheFile.open(QIODevice::WriteOnly))
+    {
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("unable to write the plugin cache: ")+cacheFile.errorString());
+        return;
+    }
+    QDataStream out(&cacheFile);
+    out.setVersion(QDataStream::Qt_5_0);
+    out << (quint32)ULTRACOPIER_PLUGIN_CACHE_VERSION << QStringLiteral(ULTRACOPIER_VERSION) << QStringLiteral(ULTRACOPIER_PLATFORM_CODE) << readPath;
+    qint64 size,mtime;
+    out << (quint32)(readPath.size()*englishPluginType.size());
+    foreach(QString basePath,readPath)
+    {
+        foreach(QString dirSub,englishPluginType)
+        {
+            const QString &pluginComposed=basePath+dirSub+QDir::separator();
+            fileState(pluginComposed,size,mtime);
+            out << pluginComposed << size << mtime;
+        }
+    }
+    out << (quint32)pluginsList.size();
+    int index=0;
+    while(index<pluginsList.size())
+    {
+        const PluginsAvailable &plugin=pluginsList.at(index);
+        QString categorySpecific;
+        if(!plugin.categorySpecific.isNull())
+        {
+            QTextStream stream(&categorySpecific);
+            plugin.categorySpecific.save(stream,0);
+        }
+        fileState(plugin.path+QStringLiteral("informations.xml"),size,mtime);
+        out << size << mtime << (quint8)plugin.category << plugin.path << plugin.name << plugin.writablePath << categorySpecific
+            << plugin.version << plugin.informations << plugin.errorString << plugin.isWritable << plugin.isAuth;
+        index++;
+    }
+    if(!cacheFile.commit())
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("unable to write the plugin cache: ")+cacheFile.errorString());
+}
+
 QString PluginsManager::categoryToString(const PluginType &category) const
 {
     switch(category)
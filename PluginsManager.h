@@ -103,6 +103,11 @@ class PluginsManager : public QThread
         void loadPluginXml(PluginsAvailable * thePlugin,const QByteArray &xml);
         QStringList readPluginPath;
         bool loadPluginInformation(const QString &path);
+        /// \brief load the plugin list from the cache, return false if it's missing or not valid
+        bool loadPluginCache(const QStringList &readPath);
+        /// \brief save the plugin list with the state of the scanned folders and files
+        void savePluginCache(const QStringList &readPath);
+        void fileState(const QString &path,qint64 &size,qint64 &mtime) const;
         QSemaphore editionSemList;
         bool stopIt;
         bool pluginLoaded;
@@ -6,6 +6,9 @@
 #include <QVariant>
 #include <QString>
 #include <QList>
+#include <QVector>
+#include <QSharedData>
+#include <QSharedDataPointer>
 
 #ifndef STRUCTDEF_H
 #define STRUCTDEF_H
@@ -149,6 +152,142 @@ struct ReturnActionOnCopyList
     ///< used if type != AddingItem
     ActionOnCopyList userAction;
 };
+
+/// \brief compact action on the transfer list, the paths are index into the string table of CopyListEvents
+struct CopyListEvent
+{
+    quint64 id;
+    // if type == CustomOperation, then 0 = without progression, 1 = with progression
+    quint64 size;
+    qint32 position;///< used if type == MoveItem || type == RemoveItem
+    // if type == MoveItem, the new position
+    // if type == RemoveItem, then 0 = normal remove, 1 = skip
+    qint32 moveAt;
+    // used if type == AddingItem || type == PreOperation || type == RemoveItem, else CopyListEvents::noString
+    quint32 sourceFolder;///< folder without the file name: /foo
+    quint32 sourceFileName;///< file name: foo.txt
+    quint32 destinationFolder;///< folder without the file name: /foo
+    quint32 destinationFileName;///< file name: foo.txt
+    quint8 type;///< \see ActionTypeCopyList
+    quint8 mode;///< \see CopyMode
+};
+
+/** \brief batch of action on the transfer list, sent by the copy engine to the interface
+ * The data is implicitly shared and not changed after the send, then the copy between the threads and to each
+ * consumer is only a reference count. The paths are split in folder and file name, a folder is only one time into
+ * the string table of the batch, and the strings are not copied when they are shared with the copy engine list. */
+class CopyListEvents
+{
+public:
+    /// \brief the layout version of CopyListEvent, changed at each incompatible change
+    enum {CurrentVersion=1};
+    /// \brief string index of the event without path
+    static const quint32 noString=0xFFFFFFFF;
+    CopyListEvents() : d(new Data)
+    {
+        d->version=CurrentVersion;
+    }
+    quint8 version() const
+    {
+        return d->version;
+    }
+    int size() const
+    {
+        return d->events.size();
+    }
+    bool isEmpty() const
+    {
+        return d->events.isEmpty();
+    }
+    const CopyListEvent &at(const int &index) const
+    {
+        return d->events.at(index);
+    }
+    const QString &string(const quint32 &index) const
+    {
+        return d->strings.at(index);
+    }
+    QString sourceFullPath(const CopyListEvent &event) const
+    {
+        return fullPath(event.sourceFolder,event.sourceFileName);
+    }
+    QString destinationFullPath(const CopyListEvent &event) const
+    {
+        return fullPath(event.destinationFolder,event.destinationFileName);
+    }
+    /// \brief return the event in the old format, the full path are created here
+    ItemOfCopyList item(const CopyListEvent &event) const
+    {
+        ItemOfCopyList itemOfCopyList;
+        itemOfCopyList.id=event.id;
+        itemOfCopyList.size=event.size;
+        itemOfCopyList.mode=(CopyMode)event.mode;
+        if(event.sourceFileName!=noString)
+        {
+            itemOfCopyList.sourceFullPath=sourceFullPath(event);
+            itemOfCopyList.sourceFileName=d->strings.at(event.sourceFileName);
+        }
+        if(event.destinationFileName!=noString)
+        {
+            itemOfCopyList.destinationFullPath=destinationFullPath(event);
+            itemOfCopyList.destinationFileName=d->strings.at(event.destinationFileName);
+        }
+        return itemOfCopyList;
+    }
+    /// \brief return the batch in the old format
+    QList<ReturnActionOnCopyList> toActionList() const
+    {
+        QList<ReturnActionOnCopyList> actionList;
+        actionList.reserve(d->events.size());
+        int index=0;
+        const int loop_size=d->events.size();
+        while(index<loop_size)
+        {
+            const CopyListEvent &event=d->events.at(index);
+            ReturnActionOnCopyList action;
+            action.type=(ActionTypeCopyList)event.type;
+            action.addAction=item(event);
+            action.userAction.position=event.position;
+            action.userAction.moveAt=event.moveAt;
+            actionList << action;
+            index++;
+        }
+        return actionList;
+    }
+    //used by the copy engine only, before the send
+    void append(const CopyListEvent &event)
+    {
+        d->events << event;
+    }
+    quint32 addString(const QString &string)
+    {
+        d->strings << string;
+        return d->strings.size()-1;
+    }
+    /// \brief drop the reference to the sent data, without copy it
+    void clear()
+    {
+        d=new Data;
+        d->version=CurrentVersion;
+    }
+private:
+    struct Data : public QSharedData
+    {
+        quint8 version;
+        QVector<CopyListEvent> events;
+        QVector<QString> strings;
+    };
+    QSharedDataPointer<Data> d;
+    QString fullPath(const quint32 &folder,const quint32 &fileName) const
+    {
+        if(folder==noString)
+            return d->strings.at(fileName);
+        const QString &folderString=d->strings.at(folder);
+        if(folderString.endsWith(QLatin1Char('/')))
+            return folderString+d->strings.at(fileName);
+        return folderString+QLatin1Char('/')+d->strings.at(fileName);
+    }
+};
 }
 
 #endif // STRUCTDEF_H
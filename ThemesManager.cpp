@@ -228,6 +228,7 @@ void ThemesManager::allPluginIsLoaded()
         if(pluginList.at(index).plugin.name==name)
         {
             currentPluginIndex=index;
+            LanguagesManager::languagesManager->setThemePath(pluginList.at(index).plugin.path);
             emit theThemeIsReloaded();
             return;
         }
@@ -11,6 +11,10 @@
 #define ULTRACOPIER_DEBUG_MAX_GUI_LINE 50000 ///< \brief Max number of ligne show on the GUI
 #define ULTRACOPIER_DEBUG_MAX_ALL_SIZE 128 ///< \brief Max size (in MB) after the console/file output is dropped
 #define ULTRACOPIER_DEBUG_MAX_IMPORTANT_SIZE 150 ///< \brief Max size (in MB) after the console/file important output is dropped
+/// \brief Comment this next line to remove the notice at the compilation, their arguments are not evaluated
+#define ULTRACOPIER_DEBUG_NOTICE
+#define ULTRACOPIER_DEBUG_TRACE_RING_SIZE 4096 ///< \brief Number of notice kept by thread into the trace ring
+#define ULTRACOPIER_DEBUG_TRACE_TEXT_SIZE 120 ///< \brief Max number of char of the notice kept into the trace ring
 /// \brief the version
 #define ULTRACOPIER_VERSION		"1.2.3.4"
 /// \brief the windows version
@@ -27,14 +31,16 @@
 /// \brief define time to update the speed detection update ont the interface (in ms)
 #define ULTRACOPIER_TIME_INTERFACE_UPDATE 500
 
-/** \brief How many value store to calculate the average value
+/** \brief Time constant of the speed average, in ms, the older value have less weight
  * 5*ULTRACOPIER_TIME_INTERFACE_UPDATE = 5*500 to get 2.5s
  * */
 #define ULTRACOPIER_MAXREMAININGTIMECOL 10
-#define ULTRACOPIER_MAXVALUESPEEDSTORED 5
+#define ULTRACOPIER_SPEEDTIMECONSTANT 2500
 #define ULTRACOPIER_MINVALUESPEED 3
-#define ULTRACOPIER_MAXVALUESPEEDSTOREDTOREMAININGTIME 120
+#define ULTRACOPIER_SPEEDTIMECONSTANTTOREMAININGTIME 60000
 #define ULTRACOPIER_MINVALUESPEEDTOREMAININGTIME 10
+/// \brief weight of each finished file into the speed of its size class, like an average on the last 5 files
+#define ULTRACOPIER_REMAININGTIME_FILEWEIGHT 0.2
 #define ULTRACOPIER_REMAININGTIME_BIGFILEMEGABYTEBASE10   100
 
 /// \brief the socket name, to have unique instance of ultracopier, and pass arguments between the instance
@@ -46,6 +52,20 @@
 /// \brief to disable plugin support, import and remove
 #define ULTRACOPIER_PLUGIN_IMPORT_SUPPORT
 
+/// \brief file into the writable path to cache the plugin informations between two start
+#define ULTRACOPIER_PLUGIN_CACHE_FILE "plugins.cache"
+/// \brief change it when the format of the plugin cache change
+#define ULTRACOPIER_PLUGIN_CACHE_VERSION 1
+
+/// \brief interval in ms between two group commit of the transfer log
+#define ULTRACOPIER_LOG_GROUP_COMMIT_INTERVAL 250
+/// \brief wake up the log thread before the interval when this number of records are waiting
+#define ULTRACOPIER_LOG_GROUP_COMMIT_RECORDS 1024
+/// \brief number of rotated segments of the transfer log kept, the older are removed
+#define ULTRACOPIER_LOG_ROTATED_SEGMENTS 8
+/// \brief number of log records kept for reuse, the others are freed
+#define ULTRACOPIER_LOG_RECORD_POOL 4096
+
 #define ULTRACOPIER_UPDATER_URL "http://ultracopier-update.first-world.info:10852/updater.txt"
 
 #endif // VARIABLE_H
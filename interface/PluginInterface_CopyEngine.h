@@ -147,7 +147,7 @@ class PluginInterface_CopyEngine : public QObject
         void newFolderListing(const QString &path) const;
         void isInPause(const bool &isInPause) const;
 
-        void newActionOnList(const QList<Ultracopier::ReturnActionOnCopyList>&) const;///very important, need be temporized to group the modification to do and not flood the interface
+        void newActionOnList(const Ultracopier::CopyListEvents&) const;///very important, need be temporized to group the modification to do and not flood the interface
         void doneTime(const QList<QPair<quint64,quint32> >&) const;
         void syncReady() const;
 
@@ -43,8 +43,10 @@ class PluginInterface_Themes : public QWidget
         virtual void errorToRetry(const QString &source,const QString &destination,const QString &error) = 0;
         /** \brief support speed limitation */
         virtual void setSupportSpeedLimitation(const bool &supportSpeedLimitationBool) = 0;
-        /// \brief get action on the transfer list (add/move/remove)
-        virtual void getActionOnList(const QList<Ultracopier::ReturnActionOnCopyList> &returnActions) = 0;
+        /// \brief get action on the transfer list (add/move/remove), by default converted for getActionOnList()
+        virtual void getCopyListEvents(const Ultracopier::CopyListEvents &events) {getActionOnList(events.toActionList());}
+        /// \brief get action on the transfer list (add/move/remove) in the old format, not needed if getCopyListEvents() is implemented
+        virtual void getActionOnList(const QList<Ultracopier::ReturnActionOnCopyList> &returnActions) {Q_UNUSED(returnActions);}
         /// \brief show the general progression
         virtual void setGeneralProgression(const quint64 &current,const quint64 &total) = 0;
         /// \brief show the file progression
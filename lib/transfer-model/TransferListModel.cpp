@@ -0,0 +1,683 @@
+#include "TransferListModel.h"
+
+#include <QColor>
+
+#define COLUMN_COUNT 3
+//rows by chunk, a chunk is splited when it have two time this size
+#define CHUNK_SIZE 1024
+//over this count of changed icon, the whole column is repainted instead of search the rows
+#define PRECISE_DECORATION_UPDATE_MAX 256
+
+// Model
+
+TransferListModel::TransferListModel(const bool &keepRows)
+{
+    this->keepRows=keepRows;
+    facilityEngine=NULL;
+    currentIndexSearch=0;
+    haveSearchItem=false;
+    searchId=0;
+    searchQueryId=0;
+    searchPending=false;
+    //the search result are sent from the thread of the index
+    qRegisterMetaType<QList<quint64> >("QList<quint64>");
+    connect(&searchIndex,&TransferSearch::searchResult,this,&TransferListModel::searchResult,Qt::QueuedConnection);
+    chunkStartValid=0;
+    itemCount=0;
+    nextChunkSerial=0;
+}
+
+int TransferListModel::chunkOf(const int &row) const
+{
+    //search into the chunks with a known start
+    if(chunkStartValid>0 && row<chunkStart.at(chunkStartValid-1)+chunks.at(chunkStartValid-1).rows.size())
+    {
+        int min=0,max=chunkStartValid-1;
+        while(min<max)
+        {
+            const int middle=(min+max+1)/2;
+            if(chunkStart.at(middle)<=row)
+                min=middle;
+            else
+                max=middle-1;
+        }
+        return min;
+    }
+    //else compute the next start until the row
+    while(chunkStartValid<chunks.size())
+    {
+        if(chunkStartValid==0)
+            chunkStart[0]=0;
+        else
+            chunkStart[chunkStartValid]=chunkStart.at(chunkStartValid-1)+chunks.at(chunkStartValid-1).rows.size();
+        chunkStartValid++;
+        if(row<chunkStart.at(chunkStartValid-1)+chunks.at(chunkStartValid-1).rows.size())
+            return chunkStartValid-1;
+    }
+    return -1;
+}
+
+int TransferListModel::startOfChunk(const int &chunk) const
+{
+    while(chunkStartValid<=chunk)
+    {
+        if(chunkStartValid==0)
+            chunkStart[0]=0;
+        else
+            chunkStart[chunkStartValid]=chunkStart.at(chunkStartValid-1)+chunks.at(chunkStartValid-1).rows.size();
+        chunkStartValid++;
+    }
+    return chunkStart.at(chunk);
+}
+
+void TransferListModel::updateChunkIndex(const int &fromChunk)
+{
+    int index=fromChunk;
+    while(index<chunks.size())
+    {
+        chunkIndex[chunks.at(index).serial]=index;
+        index++;
+    }
+}
+
+const TransferListModel::TransfertItem &TransferListModel::itemAt(const int &row) const
+{
+    const int chunk=chunkOf(row);
+    return chunks.at(chunk).rows.at(row-chunkStart.at(chunk));
+}
+
+TransferListModel::TransfertItem &TransferListModel::itemAt(const int &row)
+{
+    const int chunk=chunkOf(row);
+    return chunks[chunk].rows[row-chunkStart.at(chunk)];
+}
+
+void TransferListModel::appendItem(const TransfertItem &item)
+{
+    if(chunks.isEmpty() || chunks.last().rows.size()>=CHUNK_SIZE)
+    {
+        Chunk chunk;
+        chunk.serial=nextChunkSerial++;
+        chunk.rows.reserve(CHUNK_SIZE);
+        chunks << chunk;
+        chunkStart.resize(chunks.size());
+        chunkIndex[chunk.serial]=chunks.size()-1;
+    }
+    //the start of the last chunk don't change
+    Chunk &last=chunks.last();
+    last.rows << item;
+    idChunk[item.id]=last.serial;
+    itemCount++;
+}
+
+void TransferListModel::insertItem(const int &row,const TransfertItem &item)
+{
+    if(row>=itemCount)
+    {
+        appendItem(item);
+        return;
+    }
+    const int chunk=chunkOf(row);
+    Chunk &current=chunks[chunk];
+    current.rows.insert(row-chunkStart.at(chunk),item);
+    idChunk[item.id]=current.serial;
+    itemCount++;
+    chunkStartValid=qMin(chunkStartValid,chunk+1);
+    if(current.rows.size()>=CHUNK_SIZE*2)
+    {
+        Chunk secondHalf;
+        secondHalf.serial=nextChunkSerial++;
+        secondHalf.rows=current.rows.mid(CHUNK_SIZE);
+        current.rows.resize(CHUNK_SIZE);
+        int index=0;
+        while(index<secondHalf.rows.size())
+        {
+            idChunk[secondHalf.rows.at(index).id]=secondHalf.serial;
+            index++;
+        }
+        chunks.insert(chunk+1,secondHalf);
+        chunkStart.insert(chunk+1,0);
+        updateChunkIndex(chunk+1);
+    }
+}
+
+TransferListModel::TransfertItem TransferListModel::takeItem(const int &row)
+{
+    const int chunk=chunkOf(row);
+    Chunk &current=chunks[chunk];
+    const int indexInChunk=row-chunkStart.at(chunk);
+    const TransfertItem item=current.rows.at(indexInChunk);
+    current.rows.remove(indexInChunk);
+    idChunk.remove(item.id);
+    itemCount--;
+    if(current.rows.isEmpty())
+    {
+        chunkIndex.remove(current.serial);
+        chunks.removeAt(chunk);
+        chunkStart.remove(chunk);
+        chunkStartValid=qMin(chunkStartValid,chunk);
+        updateChunkIndex(chunk);
+    }
+    else
+        chunkStartValid=qMin(chunkStartValid,chunk+1);
+    return item;
+}
+
+int TransferListModel::rowOf(const quint64 &id) const
+{
+    const QHash<quint64,quint32>::const_iterator i=idChunk.constFind(id);
+    if(i==idChunk.constEnd())
+        return -1;
+    const int chunk=chunkIndex.value(i.value(),-1);
+    if(chunk==-1)
+        return -1;
+    //only the rows of one chunk are checked
+    const QVector<TransfertItem> &rows=chunks.at(chunk).rows;
+    int index=0;
+    while(index<rows.size())
+    {
+        if(rows.at(index).id==id)
+            return startOfChunk(chunk)+index;
+        index++;
+    }
+    return -1;
+}
+
+int TransferListModel::columnCount( const QModelIndex& parent ) const
+{
+    return parent == QModelIndex() ? COLUMN_COUNT : 0;
+}
+
+QVariant TransferListModel::data( const QModelIndex& index, int role ) const
+{
+    int row,column;
+    row=index.row();
+    column=index.column();
+    if(index.parent()!=QModelIndex() || row < 0 || row >= itemCount || column < 0 || column >= COLUMN_COUNT)
+        return QVariant();
+
+    const TransfertItem& item = itemAt(row);
+    if(role==Qt::UserRole)
+        return item.id;
+    else if(role==Qt::DisplayRole)
+    {
+        switch(column)
+        {
+            case 0:
+                return item.source;
+            break;
+            case 1:
+                return facilityEngine->sizeToString(item.size);
+            break;
+            case 2:
+                return item.destination;
+            break;
+            default:
+            return QVariant();
+        }
+    }
+    else if(role==Qt::BackgroundRole)
+    {
+        if(!search_text.isEmpty() && searchMatchedId.contains(item.id))
+        {
+            if(haveSearchItem && searchId==item.id)
+                return QColor(255,150,150,100);
+            else
+                return QColor(255,255,0,100);
+        }
+        else
+            return QVariant();
+    }
+    return QVariant();
+}
+
+int TransferListModel::rowCount( const QModelIndex& parent ) const
+{
+    return parent == QModelIndex() ? itemCount : 0;
+}
+
+quint64 TransferListModel::firstId() const
+{
+    if(itemCount>0)
+        return chunks.first().rows.first().id;
+    else
+        return 0;
+}
+
+QVariant TransferListModel::headerData( int section, Qt::Orientation orientation, int role ) const
+{
+    if ( role == Qt::DisplayRole && orientation == Qt::Horizontal && section >= 0 && section < COLUMN_COUNT ) {
+        switch ( section ) {
+            case 0:
+            return facilityEngine->translateText(QStringLiteral("Source"));
+            case 1:
+            return facilityEngine->translateText(QStringLiteral("Size"));
+            case 2:
+            return facilityEngine->translateText(QStringLiteral("Destination"));
+        }
+    }
+
+    return QAbstractTableModel::headerData( section, orientation, role );
+}
+
+bool TransferListModel::setData( const QModelIndex& index, const QVariant& value, int role )
+{
+    int row,column;
+    row=index.row();
+    column=index.column();
+    if(index.parent()!=QModelIndex() || row < 0 || row >= itemCount || column < 0 || column >= COLUMN_COUNT)
+        return false;
+
+    TransfertItem& item = itemAt(row);
+    if(role==Qt::UserRole)
+    {
+        //keep the id index in sync
+        const int chunk=chunkOf(row);
+        idChunk.remove(item.id);
+        item.id=value.toULongLong();
+        idChunk[item.id]=chunks.at(chunk).serial;
+        return true;
+    }
+    else if(role==Qt::DisplayRole)
+    {
+        switch(column)
+        {
+            case 0:
+                item.source=value.toString();
+                emit dataChanged(index,index);
+                return true;
+            break;
+            case 1:
+                item.size=value.toULongLong();
+                emit dataChanged(index,index);
+                return true;
+            break;
+            case 2:
+                item.destination=value.toString();
+                emit dataChanged(index,index);
+                return true;
+            break;
+            default:
+            return false;
+        }
+    }
+    return false;
+}
+
+/*
+  Return[0]: totalFile
+  Return[1]: totalSize
+  Return[2]: currentFile
+  */
+QList<quint64> TransferListModel::synchronizeItems(const Ultracopier::CopyListEvents& events)
+{
+    //the view and the persistent index are updated by precise row notification, the contiguous add/remove are grouped
+    QSet<quint64> decorationChangedId;
+    QList<quint64> addedIds,removedIds;
+    QStringList addedSources,addedDestinations;
+    const int loop_size=events.size();
+    int index_for_loop=0;
+    quint64 totalFile=0,totalSize=0,currentFile=0;
+    while(index_for_loop<loop_size)
+    {
+        const Ultracopier::CopyListEvent& event=events.at(index_for_loop);
+        switch(event.type)
+        {
+            case Ultracopier::AddingItem:
+            {
+                if(!keepRows)
+                {
+                    totalFile++;
+                    totalSize+=event.size;
+                    break;
+                }
+                int lastAdd=index_for_loop;
+                while(lastAdd+1<loop_size && events.at(lastAdd+1).type==Ultracopier::AddingItem)
+                    lastAdd++;
+                beginInsertRows(QModelIndex(),itemCount,itemCount+lastAdd-index_for_loop);
+                while(index_for_loop<=lastAdd)
+                {
+                    const Ultracopier::CopyListEvent& addEvent=events.at(index_for_loop);
+                    TransfertItem newItem;
+                    newItem.id=addEvent.id;
+                    newItem.source=events.sourceFullPath(addEvent);
+                    newItem.size=addEvent.size;
+                    newItem.destination=events.destinationFullPath(addEvent);
+                    appendItem(newItem);
+                    addedIds << newItem.id;
+                    addedSources << newItem.source;
+                    addedDestinations << newItem.destination;
+                    totalFile++;
+                    totalSize+=addEvent.size;
+                    index_for_loop++;
+                }
+                endInsertRows();
+                continue;
+            }
+            break;
+            case Ultracopier::MoveItem:
+            {
+                if(!keepRows)
+                    break;
+                if(event.position<0)
+                {
+                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("id: %1, position is wrong: %2").arg(event.id).arg(event.position));
+                    break;
+                }
+                if(event.position>(itemCount-1))
+                {
+                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("id: %1, position is wrong: %2").arg(event.id).arg(event.position));
+                    break;
+                }
+                if(event.moveAt<0)
+                {
+                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("id: %1, position is wrong: %2").arg(event.id).arg(event.position));
+                    break;
+                }
+                if(event.moveAt>(itemCount-1))
+                {
+                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("id: %1, position is wrong: %2").arg(event.id).arg(event.position));
+                    break;
+                }
+                if(event.position==event.moveAt)
+                {
+                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("id: %1, move at same position: %2").arg(event.id).arg(event.position));
+                    break;
+                }
+                //the destination of beginMoveRows() is the row before which it's inserted, before the remove
+                const int destinationRow=event.moveAt>event.position ? event.moveAt+1 : event.moveAt;
+                if(!beginMoveRows(QModelIndex(),event.position,event.position,QModelIndex(),destinationRow))
+                {
+                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("id: %1, unable to move at: %2").arg(event.id).arg(event.moveAt));
+                    break;
+                }
+                insertItem(event.moveAt,takeItem(event.position));
+                endMoveRows();
+            }
+            break;
+            case Ultracopier::RemoveItem:
+            {
+                if(!keepRows)
+                {
+                    currentFile++;
+                    startId.remove(event.id);
+                    stopId.remove(event.id);
+                    internalRunningOperation.remove(event.id);
+                    break;
+                }
+                if(event.position<0)
+                {
+                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("id: %1, position is wrong: %2").arg(event.id).arg(event.position));
+                    break;
+                }
+                if(event.position>(itemCount-1))
+                {
+                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("id: %1, position is wrong: %2").arg(event.id).arg(event.position));
+                    break;
+                }
+                //the next remove at the same position remove the next rows
+                int lastRemove=index_for_loop;
+                while(lastRemove+1<loop_size && events.at(lastRemove+1).type==Ultracopier::RemoveItem && events.at(lastRemove+1).position==event.position
+                      && event.position+(lastRemove+1-index_for_loop)<itemCount)
+                    lastRemove++;
+                beginRemoveRows(QModelIndex(),event.position,event.position+lastRemove-index_for_loop);
+                while(index_for_loop<=lastRemove)
+                {
+                    const Ultracopier::CopyListEvent& removeEvent=events.at(index_for_loop);
+                    if(currentIndexSearch>0 && removeEvent.position<=currentIndexSearch)
+                        currentIndexSearch--;
+                    takeItem(removeEvent.position);
+                    removedIds << removeEvent.id;
+                    searchMatchedId.remove(removeEvent.id);
+                    decorationChangedId.remove(removeEvent.id);
+                    currentFile++;
+                    startId.remove(removeEvent.id);
+                    stopId.remove(removeEvent.id);
+                    internalRunningOperation.remove(removeEvent.id);
+                    index_for_loop++;
+                }
+                endRemoveRows();
+                continue;
+            }
+            break;
+            case Ultracopier::PreOperation:
+            {
+                ItemOfCopyListWithMoreInformations tempItem;
+                tempItem.currentReadProgression=0;
+                tempItem.currentWriteProgression=0;
+                tempItem.generalData=events.item(event);
+                tempItem.actionType=(Ultracopier::ActionTypeCopyList)event.type;
+                tempItem.custom_with_progression=false;
+                internalRunningOperation[event.id]=tempItem;
+            }
+            break;
+            case Ultracopier::Transfer:
+            {
+                if(!startId.contains(event.id))
+                    startId << event.id;
+                stopId.remove(event.id);
+                decorationChangedId << event.id;
+                const QHash<quint64,ItemOfCopyListWithMoreInformations>::iterator i=internalRunningOperation.find(event.id);
+                if(i!=internalRunningOperation.end())
+                    i.value().actionType=(Ultracopier::ActionTypeCopyList)event.type;
+                else
+                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("unable to found entry for file %1: actionType: Transfer").arg(event.id));
+            }
+            break;
+            case Ultracopier::PostOperation:
+            {
+                if(!stopId.contains(event.id))
+                    stopId << event.id;
+                startId.remove(event.id);
+                decorationChangedId << event.id;
+            }
+            break;
+            case Ultracopier::CustomOperation:
+            {
+                bool custom_with_progression=(event.size==1);
+                decorationChangedId << event.id;
+                //without progression
+                if(custom_with_progression)
+                {
+                    if(startId.remove(event.id))
+                        if(!stopId.contains(event.id))
+                            stopId << event.id;
+                }
+                //with progression
+                else
+                {
+                    stopId.remove(event.id);
+                    if(!startId.contains(event.id))
+                        startId << event.id;
+                }
+                const QHash<quint64,ItemOfCopyListWithMoreInformations>::iterator i=internalRunningOperation.find(event.id);
+                if(i!=internalRunningOperation.end())
+                {
+                    ItemOfCopyListWithMoreInformations &item=i.value();
+                    item.actionType=(Ultracopier::ActionTypeCopyList)event.type;
+                    item.custom_with_progression=custom_with_progression;
+                    item.currentReadProgression=0;
+                    item.currentWriteProgression=0;
+                }
+            }
+            break;
+            default:
+                //unknow code, ignore it
+            break;
+        }
+        index_for_loop++;
+    }
+
+    //update the search index, the current search get the new matched items
+    if(!removedIds.isEmpty())
+        searchIndex.removeItems(removedIds);
+    if(!addedIds.isEmpty())
+        searchIndex.addItems(addedIds,addedSources,addedDestinations);
+    //repaint only the rows with a new icon, the view only repaint the visible rows
+    if(keepRows && !decorationChangedId.isEmpty() && itemCount>0)
+    {
+        if(decorationChangedId.size()>PRECISE_DECORATION_UPDATE_MAX)
+            emit dataChanged(index(0,0),index(itemCount-1,0));
+        else
+        {
+            int firstRow=-1,lastRow=-1;
+            QSet<quint64>::const_iterator i=decorationChangedId.constBegin();
+            while(i!=decorationChangedId.constEnd())
+            {
+                const int row=rowOf(*i);
+                if(row!=-1)
+                {
+                    if(firstRow==-1 || row<firstRow)
+                        firstRow=row;
+                    if(row>lastRow)
+                        lastRow=row;
+                }
+                ++i;
+            }
+            if(firstRow!=-1)
+                emit dataChanged(index(firstRow,0),index(lastRow,0));
+        }
+    }
+    return QList<quint64>() << totalFile << totalSize << currentFile;
+}
+
+void TransferListModel::setFacilityEngine(FacilityInterface * facilityEngine)
+{
+    this->facilityEngine=facilityEngine;
+}
+
+void TransferListModel::setSearchText(const QString &text)
+{
+    if(text==search_text)
+        return;
+    search_text=text;
+    searchMatchedId.clear();
+    haveSearchItem=false;
+    searchQueryId++;
+    searchPending=!text.isEmpty();
+    //the index drop the previous search, and keep the current to send the new matched items
+    searchIndex.search(searchQueryId,text);
+    //only the background change, the view only repaint the visible rows
+    if(itemCount>0)
+        emit dataChanged(index(0,0),index(itemCount-1,COLUMN_COUNT-1));
+}
+
+QString TransferListModel::searchText() const
+{
+    return search_text;
+}
+
+void TransferListModel::searchResult(const quint32 &searchQueryId,const QList<quint64> &ids,const bool &finished)
+{
+    //result of a previous search
+    if(searchQueryId!=this->searchQueryId)
+        return;
+    searchMatchedId.unite(ids.toSet());
+    if(!ids.isEmpty() && itemCount>0)
+        emit dataChanged(index(0,0),index(itemCount-1,COLUMN_COUNT-1));
+    if(finished && searchPending)
+    {
+        searchPending=false;
+        emit searchFinished();
+    }
+}
+
+int TransferListModel::search(bool searchNext)
+{
+    if(itemCount==0 || search_text.isEmpty() || searchMatchedId.isEmpty())
+    {
+        haveSearchItem=false;
+        return -1;
+    }
+    if(currentIndexSearch>=itemCount)
+        currentIndexSearch=0;
+    if(searchNext)
+    {
+        currentIndexSearch++;
+        if(currentIndexSearch>=itemCount)
+            currentIndexSearch=0;
+    }
+    int index_for_loop=0;
+    while(index_for_loop<itemCount)
+    {
+        const quint64 &id=itemAt(currentIndexSearch).id;
+        if(searchMatchedId.contains(id))
+        {
+            haveSearchItem=true;
+            searchId=id;
+            emit dataChanged(index(0,0),index(itemCount-1,COLUMN_COUNT-1));
+            return currentIndexSearch;
+        }
+        currentIndexSearch++;
+        if(currentIndexSearch>=itemCount)
+            currentIndexSearch=0;
+        index_for_loop++;
+    }
+    haveSearchItem=false;
+    return -1;
+}
+
+int TransferListModel::searchPrev()
+{
+    if(itemCount==0 || search_text.isEmpty() || searchMatchedId.isEmpty())
+    {
+        haveSearchItem=false;
+        return -1;
+    }
+    if(currentIndexSearch>=itemCount)
+        currentIndexSearch=0;
+    if(currentIndexSearch==0)
+        currentIndexSearch=itemCount-1;
+    else
+        currentIndexSearch--;
+    int index_for_loop=0;
+    while(index_for_loop<itemCount)
+    {
+        const quint64 &id=itemAt(currentIndexSearch).id;
+        if(searchMatchedId.contains(id))
+        {
+            haveSearchItem=true;
+            searchId=id;
+            emit dataChanged(index(0,0),index(itemCount-1,COLUMN_COUNT-1));
+            return currentIndexSearch;
+        }
+        if(currentIndexSearch==0)
+            currentIndexSearch=itemCount-1;
+        else
+            currentIndexSearch--;
+        index_for_loop++;
+    }
+    haveSearchItem=false;
+    return -1;
+}
+
+void TransferListModel::setFileProgression(const QList<Ultracopier::ProgressionItem> &progressionList)
+{
+    //the progression is not displayed into the rows, then only one hash lookup by item and no repaint
+    #ifdef ULTRACOPIER_PLUGIN_DEBUG
+    int notFound=0;
+    #endif
+    const int loop_size=progressionList.size();
+    int index_for_loop=0;
+    while(index_for_loop<loop_size)
+    {
+        const Ultracopier::ProgressionItem &progression=progressionList.at(index_for_loop);
+        const QHash<quint64,ItemOfCopyListWithMoreInformations>::iterator i=internalRunningOperation.find(progression.id);
+        if(i!=internalRunningOperation.end())
+        {
+            ItemOfCopyListWithMoreInformations &item=i.value();
+            item.generalData.size=progression.total;
+            item.currentReadProgression=progression.currentRead;
+            item.currentWriteProgression=progression.currentWrite;
+        }
+        #ifdef ULTRACOPIER_PLUGIN_DEBUG
+        else
+            notFound++;
+        #endif
+        index_for_loop++;
+    }
+    #ifdef ULTRACOPIER_PLUGIN_DEBUG
+    if(notFound>0)
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("progression remaning items: %1").arg(notFound));
+    #endif
+}
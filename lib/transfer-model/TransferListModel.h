@@ -0,0 +1,126 @@
+/** \file TransferListModel.h
+\brief Model of the transfer list shared by the themes
+\author alpha_one_x86
+\licence GPL3, see the file COPYING */
+
+#ifndef TRANSFERLISTMODEL_H
+#define TRANSFERLISTMODEL_H
+
+#include <QAbstractTableModel>
+#include <QModelIndex>
+#include <QVariant>
+#include <QList>
+#include <QVector>
+#include <QHash>
+#include <QSet>
+#include <QString>
+
+#include "Environment.h"
+#include "TransferSearch.h"
+
+#include "../../interface/FacilityInterface.h"
+
+/** \brief Model of the transfer list shared by the themes
+ * The rows are stored by chunk, the chunk of each id is indexed, the size is formated only when it's displayed
+ * and the view is updated by precise row notification. The theme only add the presentation (icon, current item). */
+class TransferListModel : public QAbstractTableModel
+{
+    Q_OBJECT
+public:
+    /// \brief the transfer item displayed, the size is formated only when it's displayed
+    struct TransfertItem
+    {
+        quint64 id;
+        QString source;
+        quint64 size;
+        QString destination;
+    };
+    /// \brief the transfer item with progression
+    struct ItemOfCopyListWithMoreInformations
+    {
+        quint64 currentReadProgression,currentWriteProgression;
+        Ultracopier::ItemOfCopyList generalData;
+        Ultracopier::ActionTypeCopyList actionType;
+        bool custom_with_progression;
+    };
+
+    /// \param keepRows false to only keep the running items, for the theme without transfer list
+    explicit TransferListModel(const bool &keepRows=true);
+
+    virtual int columnCount(const QModelIndex& parent = QModelIndex()) const;
+    virtual QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const;
+    virtual int rowCount(const QModelIndex& parent = QModelIndex()) const;
+    virtual QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const;
+    virtual bool setData(const QModelIndex& index, const QVariant& value, int role = Qt::EditRole);
+
+    /// \brief apply the events, return the added file count, the added size and the removed file count
+    QList<quint64> synchronizeItems(const Ultracopier::CopyListEvents& events);
+    void setFacilityEngine(FacilityInterface * facilityEngine);
+
+    /// \brief search the text into the worker thread, searchFinished() is emitted when all the result are received
+    void setSearchText(const QString &text);
+    QString searchText() const;
+    /// \brief return the row of the next matched item, -1 if none
+    int search(bool searchNext);
+    int searchPrev();
+
+    /// \brief update the progression, only the rows of the updated items are repainted
+    void setFileProgression(const QList<Ultracopier::ProgressionItem> &progressionList);
+
+    quint64 firstId() const;
+    /// \brief return the row of this id, -1 if not found
+    int rowOf(const quint64 &id) const;
+protected:
+    const TransfertItem &itemAt(const int &row) const;
+    TransfertItem &itemAt(const int &row);
+    QSet<quint64> startId,stopId;///< To show what is started, what is stopped
+    QHash<quint64,ItemOfCopyListWithMoreInformations> internalRunningOperation;///< to have progression and stat
+    FacilityInterface * facilityEngine;
+private:
+    /// \brief the rows of a chunk, the serial don't change when the chunk index change
+    struct Chunk
+    {
+        quint32 serial;
+        QVector<TransfertItem> rows;
+    };
+    /** \brief To have a transfer list for the user, stored by chunk of rows
+     * The insert, remove and move only shift the rows of one chunk, not the whole list */
+    QList<Chunk> chunks;
+    /// \brief first row of each chunk, only the chunkStartValid first values are up to date
+    mutable QVector<int> chunkStart;
+    /// \brief extended only up to the read row, then the remove at the top of the list don't update all the chunks
+    mutable int chunkStartValid;
+    int itemCount;
+    quint32 nextChunkSerial;
+    QHash<quint64,quint32> idChunk;///< id to the serial of its chunk
+    QHash<quint32,int> chunkIndex;///< serial to the index of the chunk
+    bool keepRows;
+    /// \brief return the chunk of this row, row need be valid
+    int chunkOf(const int &row) const;
+    /// \brief return the first row of this chunk, chunk need be valid
+    int startOfChunk(const int &chunk) const;
+    /// \brief update the chunk index from this chunk to the end
+    void updateChunkIndex(const int &fromChunk);
+    void appendItem(const TransfertItem &item);
+    void insertItem(const int &row,const TransfertItem &item);
+    TransfertItem takeItem(const int &row);
+    QString search_text;
+    /// \brief index from start the search, decresed by remove before it
+    int currentIndexSearch;
+    bool haveSearchItem;
+    quint64 searchId;
+    TransferSearch searchIndex;///< index the list into a thread
+    QSet<quint64> searchMatchedId;///< the ids which match the search text
+    quint32 searchQueryId;
+    bool searchPending;
+private slots:
+    void searchResult(const quint32 &searchQueryId,const QList<quint64> &ids,const bool &finished);
+signals:
+    void searchFinished() const;
+    #ifdef ULTRACOPIER_PLUGIN_DEBUG
+    /// \brief To debug source
+    void debugInformation(const Ultracopier::DebugLevel &level,const QString &fonction,const QString &text,const QString &file,const int &ligne) const;
+    #endif
+};
+
+#endif // TRANSFERLISTMODEL_H
@@ -0,0 +1,318 @@
+#include "TransferSearch.h"
+
+QString TransferSearch::text_slash=QStringLiteral("/");
+
+TransferSearch::TransferSearch()
+{
+    currentSearchId=0;
+    lastSearchId=0;
+    FolderNode root;
+    root.parent=0;
+    root.component=0;
+    folders << root;
+    setObjectName(QStringLiteral("TransferSearch"));
+    moveToThread(this);
+    connect(this,&TransferSearch::internalStartAddItems,    this,&TransferSearch::internalAddItems,     Qt::QueuedConnection);
+    connect(this,&TransferSearch::internalStartRemoveItems, this,&TransferSearch::internalRemoveItems,  Qt::QueuedConnection);
+    connect(this,&TransferSearch::internalStartSearch,      this,&TransferSearch::internalSearch,       Qt::QueuedConnection);
+    start();
+}
+
+TransferSearch::~TransferSearch()
+{
+    //drop the running search
+    lastSearchId.fetchAndAddOrdered(1);
+    quit();
+    wait();
+}
+
+void TransferSearch::run()
+{
+    exec();
+}
+
+void TransferSearch::addItems(const QList<quint64> &ids,const QStringList &sources,const QStringList &destinations)
+{
+    emit internalStartAddItems(ids,sources,destinations);
+}
+
+void TransferSearch::removeItems(const QList<quint64> &ids)
+{
+    emit internalStartRemoveItems(ids);
+}
+
+void TransferSearch::search(const quint32 &searchId,const QString &text)
+{
+    lastSearchId.store(searchId);
+    emit internalStartSearch(searchId,text);
+}
+
+quint32 TransferSearch::internComponent(const QString &component)
+{
+    const QHash<QString,quint32>::const_iterator i=componentIndex.constFind(component);
+    if(i!=componentIndex.constEnd())
+        return i.value();
+    const quint32 id=components.size();
+    components << component;
+    componentIndex[component]=id;
+    //index each trigram one time
+    QSet<quint64> trigrams;
+    int index=0;
+    while(index+3<=component.size())
+    {
+        const quint64 trigram=((quint64)component.at(index).unicode()<<32) | ((quint64)component.at(index+1).unicode()<<16) | component.at(index+2).unicode();
+        if(!trigrams.contains(trigram))
+        {
+            trigrams << trigram;
+            trigramIndex[trigram] << id;
+        }
+        index++;
+    }
+    return id;
+}
+
+quint32 TransferSearch::internPath(const QString &path,quint32 &name)
+{
+    const QStringList &parts=path.toLower().split(text_slash);
+    quint32 folder=0;
+    int index=0;
+    while(index<(parts.size()-1))
+    {
+        const quint32 component=internComponent(parts.at(index));
+        const QPair<quint32,quint32> key(folder,component);
+        const QHash<QPair<quint32,quint32>,quint32>::const_iterator i=folderIndex.constFind(key);
+        if(i!=folderIndex.constEnd())
+            folder=i.value();
+        else
+        {
+            FolderNode node;
+            node.parent=folder;
+            node.component=component;
+            const quint32 newFolder=folders.size();
+            folders << node;
+            folders[folder].children << newFolder;
+            folderIndex[key]=newFolder;
+            folder=newFolder;
+        }
+        index++;
+    }
+    name=internComponent(parts.last());
+    return folder;
+}
+
+QString TransferSearch::folderPath(const quint32 &folder) const
+{
+    QStringList parts;
+    quint32 current=folder;
+    while(current!=0)
+    {
+        const FolderNode &node=folders.at(current);
+        parts.prepend(components.at(node.component));
+        current=node.parent;
+    }
+    return parts.join(text_slash);
+}
+
+bool TransferSearch::itemMatch(const Item &item,const QString &text) const
+{
+    QString source=components.at(item.sourceName);
+    if(item.sourceFolder!=0)
+        source=folderPath(item.sourceFolder)+text_slash+source;
+    if(source.contains(text))
+        return true;
+    QString destination=components.at(item.destinationName);
+    if(item.destinationFolder!=0)
+        destination=folderPath(item.destinationFolder)+text_slash+destination;
+    return destination.contains(text);
+}
+
+QList<quint32> TransferSearch::componentsContaining(const QString &text) const
+{
+    QList<quint32> matched;
+    //too short for the trigram, check all the component, they are less than the items
+    if(text.size()<3)
+    {
+        quint32 index=0;
+        while(index<(quint32)components.size())
+        {
+            if(components.at(index).contains(text))
+                matched << index;
+            index++;
+        }
+        return matched;
+    }
+    //check only the component of the less used trigram of the text
+    const QVector<quint32> *candidates=NULL;
+    int index=0;
+    while(index+3<=text.size())
+    {
+        const quint64 trigram=((quint64)text.at(index).unicode()<<32) | ((quint64)text.at(index+1).unicode()<<16) | text.at(index+2).unicode();
+        const QHash<quint64,QVector<quint32> >::const_iterator i=trigramIndex.constFind(trigram);
+        if(i==trigramIndex.constEnd())
+            return matched;
+        if(candidates==NULL || i.value().size()<candidates->size())
+            candidates=&i.value();
+        index++;
+    }
+    index=0;
+    while(index<candidates->size())
+    {
+        const quint32 &component=candidates->at(index);
+        if(components.at(component).contains(text))
+            matched << component;
+        index++;
+    }
+    return matched;
+}
+
+bool TransferSearch::addResult(QList<quint64> &result,const quint32 &searchId,const quint64 &id)
+{
+    result << id;
+    if(result.size()<TRANSFERSEARCH_RESULT_BLOCK)
+        return true;
+    emit searchResult(searchId,result,false);
+    result.clear();
+    return searchId==(quint32)lastSearchId.load();
+}
+
+void TransferSearch::internalAddItems(const QList<quint64> &ids,const QStringList &sources,const QStringList &destinations)
+{
+    QList<quint64> matched;
+    int index=0;
+    while(index<ids.size() && index<sources.size() && index<destinations.size())
+    {
+        const quint64 &id=ids.at(index);
+        if(items.contains(id))
+            internalRemoveItems(QList<quint64>() << id);
+        Item item;
+        item.sourceFolder=internPath(sources.at(index),item.sourceName);
+        item.destinationFolder=internPath(destinations.at(index),item.destinationName);
+        items[id]=item;
+        folders[item.sourceFolder].items << id;
+        folders[item.destinationFolder].items << id;
+        nameItems[item.sourceName] << id;
+        nameItems[item.destinationName] << id;
+        //the current search see the new items
+        if(!currentSearch.isEmpty() && itemMatch(item,currentSearch))
+            matched << id;
+        index++;
+    }
+    if(!matched.isEmpty())
+        emit searchResult(currentSearchId,matched,false);
+}
+
+void TransferSearch::internalRemoveItems(const QList<quint64> &ids)
+{
+    int index=0;
+    while(index<ids.size())
+    {
+        const quint64 &id=ids.at(index);
+        const QHash<quint64,Item>::iterator i=items.find(id);
+        if(i!=items.end())
+        {
+            const Item &item=i.value();
+            folders[item.sourceFolder].items.remove(id);
+            folders[item.destinationFolder].items.remove(id);
+            nameItems[item.sourceName].remove(id);
+            nameItems[item.destinationName].remove(id);
+            items.erase(i);
+        }
+        index++;
+    }
+}
+
+void TransferSearch::internalSearch(const quint32 &searchId,const QString &text)
+{
+    //a newer search is queued
+    if(searchId!=(quint32)lastSearchId.load())
+        return;
+    currentSearchId=searchId;
+    currentSearch=text.toLower();
+    if(currentSearch.isEmpty())
+        return;
+    //the longest part without separator give the component to check, the other parts are checked on the full path
+    const QStringList &parts=currentSearch.split(text_slash);
+    const bool needFullCheck=parts.size()>1;
+    QString longestPart;
+    int index=0;
+    while(index<parts.size())
+    {
+        if(parts.at(index).size()>longestPart.size())
+            longestPart=parts.at(index);
+        index++;
+    }
+    QList<quint64> result;
+    if(longestPart.isEmpty())
+    {
+        QHash<quint64,Item>::const_iterator i=items.constBegin();
+        while(i!=items.constEnd())
+        {
+            if(itemMatch(i.value(),currentSearch))
+                if(!addResult(result,searchId,i.key()))
+                    return;
+            ++i;
+        }
+        emit searchResult(searchId,result,true);
+        return;
+    }
+    const QList<quint32> &matchedComponents=componentsContaining(longestPart);
+    const QSet<quint32> &matchedComponentSet=matchedComponents.toSet();
+    QSet<quint64> checkedItems;
+    //the items with a matching file name
+    index=0;
+    while(index<matchedComponents.size())
+    {
+        const QHash<quint32,QSet<quint64> >::const_iterator i=nameItems.constFind(matchedComponents.at(index));
+        if(i!=nameItems.constEnd())
+        {
+            QSet<quint64>::const_iterator j=i.value().constBegin();
+            while(j!=i.value().constEnd())
+            {
+                const quint64 &id=*j;
+                if(!checkedItems.contains(id))
+                {
+                    checkedItems << id;
+                    if(!needFullCheck || itemMatch(items.value(id),currentSearch))
+                        if(!addResult(result,searchId,id))
+                            return;
+                }
+                ++j;
+            }
+        }
+        index++;
+    }
+    //the items into a matching folder and its sub-folders
+    QVector<quint32> foldersToVisit;
+    quint32 folder=1;
+    while(folder<(quint32)folders.size())
+    {
+        if(matchedComponentSet.contains(folders.at(folder).component))
+            foldersToVisit << folder;
+        folder++;
+    }
+    QSet<quint32> visitedFolders;
+    while(!foldersToVisit.isEmpty())
+    {
+        folder=foldersToVisit.last();
+        foldersToVisit.removeLast();
+        if(visitedFolders.contains(folder))
+            continue;
+        visitedFolders << folder;
+        const FolderNode &node=folders.at(folder);
+        QSet<quint64>::const_iterator j=node.items.constBegin();
+        while(j!=node.items.constEnd())
+        {
+            const quint64 &id=*j;
+            if(!checkedItems.contains(id))
+            {
+                checkedItems << id;
+                if(!needFullCheck || itemMatch(items.value(id),currentSearch))
+                    if(!addResult(result,searchId,id))
+                        return;
+            }
+            ++j;
+        }
+        foldersToVisit << node.children;
+    }
+    emit searchResult(searchId,result,true);
+}
@@ -0,0 +1,85 @@
+/** \file TransferSearch.h
+\brief Thread which index the transfer list to search into it
+\author alpha_one_x86
+\licence GPL3, see the file COPYING */
+
+#ifndef TRANSFERSEARCH_H
+#define TRANSFERSEARCH_H
+
+#include <QThread>
+#include <QString>
+#include <QStringList>
+#include <QList>
+#include <QVector>
+#include <QHash>
+#include <QSet>
+#include <QPair>
+#include <QAtomicInt>
+
+/// \brief the result are sent by block of this size
+#define TRANSFERSEARCH_RESULT_BLOCK 10000
+
+/** \brief Thread which index the transfer list to search into it
+ * The path component are interned into a folder tree, and a trigram index give the component which contains the searched text.
+ * The item are only indexed by folder and file name, then the whole folder content match when the folder name match.
+ * The index is updated by the add and remove of each batch, the search are done into this thread and the result are sent by block. */
+class TransferSearch : public QThread
+{
+    Q_OBJECT
+public:
+    explicit TransferSearch();
+    ~TransferSearch();
+    /// \brief add the items to the index, the lists have the same size
+    void addItems(const QList<quint64> &ids,const QStringList &sources,const QStringList &destinations);
+    void removeItems(const QList<quint64> &ids);
+    /// \brief search the text, the previous search is dropped, the result are sent by searchResult()
+    void search(const quint32 &searchId,const QString &text);
+signals:
+    /// \brief the matched ids, the new added items are sent too while the search is the current search
+    void searchResult(const quint32 &searchId,const QList<quint64> &ids,const bool &finished) const;
+    void internalStartAddItems(const QList<quint64> &ids,const QStringList &sources,const QStringList &destinations) const;
+    void internalStartRemoveItems(const QList<quint64> &ids) const;
+    void internalStartSearch(const quint32 &searchId,const QString &text) const;
+private:
+    void run();
+    struct FolderNode
+    {
+        quint32 parent;
+        quint32 component;
+        QVector<quint32> children;
+        QSet<quint64> items;///< items with the source or the destination directly into this folder
+    };
+    struct Item
+    {
+        quint32 sourceFolder;
+        quint32 sourceName;
+        quint32 destinationFolder;
+        quint32 destinationName;
+    };
+    QVector<QString> components;///< the interned path component, in lower case
+    QHash<QString,quint32> componentIndex;
+    QHash<quint64,QVector<quint32> > trigramIndex;///< trigram to the component which contains it
+    QHash<quint32,QSet<quint64> > nameItems;///< file name component to the items
+    QVector<FolderNode> folders;///< the first is the root
+    QHash<QPair<quint32,quint32>,quint32> folderIndex;///< parent and component to the folder
+    QHash<quint64,Item> items;
+    QString currentSearch;
+    quint32 currentSearchId;
+    QAtomicInt lastSearchId;///< to drop the search replaced by a newer search
+    quint32 internComponent(const QString &component);
+    /// \brief split the path and return the folder, set the file name component
+    quint32 internPath(const QString &path,quint32 &name);
+    QString folderPath(const quint32 &folder) const;
+    bool itemMatch(const Item &item,const QString &text) const;
+    /// \brief the component which contains the text
+    QList<quint32> componentsContaining(const QString &text) const;
+    /// \brief add the id to the result and send it by block, return false if the search is dropped
+    bool addResult(QList<quint64> &result,const quint32 &searchId,const quint64 &id);
+    static QString text_slash;
+private slots:
+    void internalAddItems(const QList<quint64> &ids,const QStringList &sources,const QStringList &destinations);
+    void internalRemoveItems(const QList<quint64> &ids);
+    void internalSearch(const quint32 &searchId,const QString &text);
+};
+
+#endif // TRANSFERSEARCH_H
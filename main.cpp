@@ -5,6 +5,7 @@
 
 #include <QApplication>
 #include <QtPlugin>
+#include <cstring>
 
 #include "Environment.h"
 #include "EventDispatcher.h"
@@ -58,6 +59,8 @@ void registerTheOptions()
     KeysList.append(qMakePair(QStringLiteral("confirmToGroupWindows"),QVariant(true)));
     KeysList.append(qMakePair(QStringLiteral("giveGPUTime"),QVariant(true)));
     KeysList.append(qMakePair(QStringLiteral("remainingTimeAlgorithm"),QVariant(0)));
+    KeysList.append(qMakePair(QStringLiteral("remainingTimeModel"),QVariant(QStringList())));
+    KeysList.append(qMakePair(QStringLiteral("averageSpeedModel"),QVariant(0.0)));
     #ifdef ULTRACOPIER_INTERNET_SUPPORT
     #if defined(Q_OS_WIN32) || defined(Q_OS_MAC)
     KeysList.append(qMakePair(QStringLiteral("checkTheUpdate"),QVariant(true)));
@@ -85,6 +88,9 @@ void registerTheOptions()
     KeysList.append(qMakePair(QStringLiteral("transfer_format"),QVariant("[%time%] %source% (%size%) %destination%")));
     KeysList.append(qMakePair(QStringLiteral("error_format"),QVariant("[%time%] %path%, %error%")));
     KeysList.append(qMakePair(QStringLiteral("folder_format"),QVariant("[%time%] %operation% %path%")));
+    KeysList.append(qMakePair(QStringLiteral("format"),QVariant(0)));//0: text with the formats above, 1: JSON lines
+    KeysList.append(qMakePair(QStringLiteral("rotate_size"),QVariant(0)));//in MB, 0 to never rotate
+    KeysList.append(qMakePair(QStringLiteral("compress_rotated"),QVariant(false)));
     OptionEngine::optionEngine->addOptionGroup(QStringLiteral("Write_log"),KeysList);
 
     KeysList.clear();
@@ -96,10 +102,29 @@ void registerTheOptions()
     OptionEngine::optionEngine->addOptionGroup(QStringLiteral("SessionLoader"),KeysList);
 }
 
+/// \brief return true if ultracopier need run without systray, theme and dialog
+bool headlessArgument(int argc, char *argv[])
+{
+    int index=1;
+    while(index<argc)
+    {
+        if(strcmp(argv[index],"--headless")==0)
+            return true;
+        index++;
+    }
+    return false;
+}
+
 /// \brief Define the main() for the point entry
 int main(int argc, char *argv[])
 {
     int returnCode;
+    const bool headless=headlessArgument(argc,argv);
+    /* headless still need QApplication and not QCoreApplication: the copy engine factory and the copy engine
+     * create the widget of the filters and of the renaming rules, which need the GUI application. Without display
+     * server, the offscreen platform is used, and no window, systray or dialog is shown */
+    if(headless && qgetenv("QT_QPA_PLATFORM").isEmpty())
+        qputenv("QT_QPA_PLATFORM","offscreen");
     QApplication ultracopierApplication(argc, argv);
     ultracopierApplication.setApplicationVersion(ULTRACOPIER_VERSION);
     ultracopierApplication.setQuitOnLastWindowClosed(false);
@@ -117,11 +142,13 @@ int main(int argc, char *argv[])
 
     PluginsManager::pluginsManager=new PluginsManager();
     LanguagesManager::languagesManager=new LanguagesManager();
-    ThemesManager::themesManager=new ThemesManager();
+    //without theme, no interface and no icon are loaded
+    if(!headless)
+        ThemesManager::themesManager=new ThemesManager();
 
     //the main code, event loop of Qt and event dispatcher of ultracopier
     {
-        EventDispatcher backgroundRunningInstance;
+        EventDispatcher backgroundRunningInstance(headless);
         if(backgroundRunningInstance.shouldBeClosed())
             returnCode=0;
         else
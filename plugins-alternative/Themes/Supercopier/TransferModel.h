@@ -1,41 +1,22 @@
 #ifndef TRANSFERMODEL_H
 #define TRANSFERMODEL_H
 
-#include <QAbstractTableModel>
 #include <QItemSelectionModel>
 #include <QModelIndex>
 #include <QVariant>
-#include <QList>
-#include <QSet>
 #include <QIcon>
 #include <QString>
 
 #include "StructEnumDefinition.h"
 #include "Environment.h"
 
-#include "../../../interface/FacilityInterface.h"
+#include "../../../lib/transfer-model/TransferListModel.h"
 
-/// \brief model to store the transfer list
-class TransferModel : public QAbstractTableModel
+/// \brief model to store the transfer list, add the icons to the shared model
+class TransferModel : public TransferListModel
 {
     Q_OBJECT
 public:
-    /// \brief the transfer item displayed
-    struct TransfertItem
-    {
-        quint64 id;
-        QString source;
-        QString size;
-        QString destination;
-    };
-    /// \brief the transfer item with progression
-    struct ItemOfCopyListWithMoreInformations
-    {
-        quint64 currentReadProgression,currentWriteProgression;
-        Ultracopier::ItemOfCopyList generalData;
-        Ultracopier::ActionTypeCopyList actionType;
-        bool custom_with_progression;
-    };
     /// \brief returned first transfer item
     struct currentTransfertItem
     {
@@ -49,48 +30,12 @@ public:
 
     TransferModel();
 
-    virtual int columnCount(const QModelIndex& parent = QModelIndex()) const;
     virtual QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const;
-    virtual int rowCount(const QModelIndex& parent = QModelIndex()) const;
-    virtual QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const;
-    virtual bool setData(const QModelIndex& index, const QVariant& value, int role = Qt::EditRole);
-
-    QList<quint64> synchronizeItems(const QList<Ultracopier::ReturnActionOnCopyList>& returnActions);
-    void setFacilityEngine(FacilityInterface * facilityEngine);
-
-    int search(const QString &text,bool searchNext);
-    int searchPrev(const QString &text);
-
-    void setFileProgression(
-            #ifndef ULTRACOPIER_PLUGIN_DEBUG
-            const
-            #endif
-            QList<Ultracopier::ProgressionItem> &progressionList);
 
     currentTransfertItem getCurrentTransfertItem() const;
-
-    quint64 firstId() const;
-protected:
-    QList<TransfertItem> transfertItemList;///< To have a transfer list for the user
-    QSet<quint64> startId,stopId;///< To show what is started, what is stopped
-    QHash<quint64,ItemOfCopyListWithMoreInformations> internalRunningOperation;///< to have progression and stat
 private:
-    int loop_size,index_for_loop;
-    int sub_loop_size,sub_index_for_loop;
-    int row,column;
-    FacilityInterface * facilityEngine;
-    QString search_text;
-    /// \brief index from start the search, decresed by remove before it
-    int currentIndexSearch;
-    bool haveSearchItem;
-    quint64 searchId;
     static QIcon *start;
     static QIcon *stop;
-signals:
-    #ifdef ULTRACOPIER_PLUGIN_DEBUG
-    /// \brief To debug source
-    void debugInformation(const Ultracopier::DebugLevel &level,QString fonction,QString text,QString file,int ligne) const;
-    #endif
 };
 
 #endif // TRANSFERMODEL_H
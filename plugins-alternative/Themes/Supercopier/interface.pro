@@ -14,10 +14,14 @@ HEADERS         = interface.h \
     ../../../interface/PluginInterface_Themes.h \
     ../../../interface/FacilityInterface.h \
     ../../../interface/OptionInterface.h \
-    TransferModel.h
+    TransferModel.h \
+    ../../../lib/transfer-model/TransferListModel.h \
+    ../../../lib/transfer-model/TransferSearch.h
 SOURCES         = interface.cpp \
     factory.cpp \
-    TransferModel.cpp
+    TransferModel.cpp \
+    ../../../lib/transfer-model/TransferListModel.cpp \
+    ../../../lib/transfer-model/TransferSearch.cpp
 TARGET          = $$qtLibraryTarget(interface)
 TRANSLATIONS += Languages/ar/translation.ts \
     Languages/de/translation.ts \
@@ -434,10 +434,10 @@ void Themes::newLanguageLoaded()
   Return[1]: totalSize
   Return[2]: currentFile
   */
-void Themes::getActionOnList(const QList<Ultracopier::ReturnActionOnCopyList>& returnActions)
+void Themes::getCopyListEvents(const Ultracopier::CopyListEvents &events)
 {
-    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"start, returnActions.size(): "+QString::number(returnActions.size()));
-    QList<quint64> returnValue=transferModel.synchronizeItems(returnActions);
+    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"start, events.size(): "+QString::number(events.size()));
+    QList<quint64> returnValue=transferModel.synchronizeItems(events);
     totalFile+=returnValue[0];
     totalSize+=returnValue[1];
     currentFile+=returnValue[2];
@@ -456,8 +456,7 @@ void Themes::getActionOnList(const QList<Ultracopier::ReturnActionOnCopyList>& r
 
 void Themes::setFileProgression(const QList<Ultracopier::ProgressionItem> &progressionList)
 {
-    QList<Ultracopier::ProgressionItem> progressionListBis=progressionList;
-    transferModel.setFileProgression(progressionListBis);
+    transferModel.setFileProgression(progressionList);
     updateCurrentFileInformation();
 }
 
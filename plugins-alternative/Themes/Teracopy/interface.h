@@ -170,7 +170,7 @@ signals:
 public slots:
     //set the translate
     void newLanguageLoaded();
-    void getActionOnList(const QList<Ultracopier::ReturnActionOnCopyList>& returnActions);
+    void getCopyListEvents(const Ultracopier::CopyListEvents &events);
 };
 
 #endif // INTERFACE_H
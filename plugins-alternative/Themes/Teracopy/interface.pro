@@ -12,10 +12,14 @@ HEADERS         = interface.h \
     Environment.h \
     Variable.h \
     ../../../interface/PluginInterface_Themes.h \
-    TransferModel.h
+    TransferModel.h \
+    ../../../lib/transfer-model/TransferListModel.h \
+    ../../../lib/transfer-model/TransferSearch.h
 SOURCES         = interface.cpp \
     factory.cpp \
-    TransferModel.cpp
+    TransferModel.cpp \
+    ../../../lib/transfer-model/TransferListModel.cpp \
+    ../../../lib/transfer-model/TransferSearch.cpp
 TARGET          = $$qtLibraryTarget(interface)
 TRANSLATIONS += Languages/ar/translation.ts \
     Languages/de/translation.ts \
@@ -265,9 +265,12 @@ void Themes::setErrorAction(const QList<QPair<QString,QString> > &list)
 }
 
 //edit the transfer list
-void Themes::getActionOnList(const QList<Ultracopier::ReturnActionOnCopyList> &returnActions)
+void Themes::getCopyListEvents(const Ultracopier::CopyListEvents &events)
 {
-    transferModel.synchronizeItems(returnActions);
+    const QList<quint64> &returnValue=transferModel.synchronizeItems(events);
+    transferModel.totalFile+=returnValue.first();
+    transferModel.totalSize+=returnValue.at(1);
+    transferModel.currentFile+=returnValue.last();
     updateInformations();
 }
 
@@ -292,8 +295,7 @@ void Themes::newLanguageLoaded()
 
 void Themes::setFileProgression(const QList<Ultracopier::ProgressionItem> &progressionList)
 {
-    QList<Ultracopier::ProgressionItem> progressionListBis=progressionList;
-    transferModel.setFileProgression(progressionListBis);
+    transferModel.setFileProgression(progressionList);
     updateInformations();
 }
 
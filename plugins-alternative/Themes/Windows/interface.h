@@ -79,7 +79,7 @@ public:
     /// \brief to set if the copy engine is found
     void getOptionsEngineEnabled(const bool &isEnabled);
     /// \brief get action on the transfer list (add/move/remove)
-    void getActionOnList(const QList<Ultracopier::ReturnActionOnCopyList> &returnActions);
+    void getCopyListEvents(const Ultracopier::CopyListEvents &events);
     //get information about the copy
     /// \brief show the general progression
     void setGeneralProgression(const quint64 &current,const quint64 &total);
@@ -63,6 +63,13 @@ void CopyEngine::fileAlreadyExists(QFileInfo source,QFileInfo destination,bool i
                 thread->setFileExistsAction(tempFileExistsAction);
             break;
             default:
+                if(interface==NULL)
+                {
+                    //headless, nobody to ask, then keep the destination
+                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"no interface to ask, skip the same file: "+source.absoluteFilePath());
+                    thread->setFileExistsAction(FileExists_Skip);
+                    break;
+                }
                 if(dialogIsOpen)
                 {
                     alreadyExistsQueueItem newItem;
@@ -130,6 +137,13 @@ void CopyEngine::fileAlreadyExists(QFileInfo source,QFileInfo destination,bool i
                 thread->setFileExistsAction(tempFileExistsAction);
             break;
             default:
+                if(interface==NULL)
+                {
+                    //headless, nobody to ask, then never overwrite without a collision policy
+                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"no interface to ask, skip the existing file: "+destination.absoluteFilePath());
+                    thread->setFileExistsAction(FileExists_Skip);
+                    break;
+                }
                 if(dialogIsOpen)
                 {
                     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("dialog open, put in queue: %1 %2")
@@ -226,6 +240,13 @@ void CopyEngine::haveNeedPutAtBottom(bool needPutAtBottom, const QFileInfo &file
 
 void CopyEngine::missingDiskSpace(QList<Diskspace> list)
 {
+    if(interface==NULL)
+    {
+        //headless, the disk space check is enabled, then don't start a transfer which can't fit
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"no interface to ask, cancel because the disk space is missing");
+        emit cancelAll();
+        return;
+    }
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"show dialog");
     DiskSpace dialog(facilityEngine,list,interface);
     emit isInPause(true);
@@ -266,6 +287,13 @@ void CopyEngine::errorOnFile(QFileInfo fileInfo,QString errorString,TransferThre
         case FileError_Cancel:
         return;
         default:
+            if(interface==NULL)
+            {
+                //headless, nobody to ask, the error is logged and the file skipped
+                emit error(fileInfo.absoluteFilePath(),fileInfo.size(),fileInfo.lastModified(),errorString);
+                thread->skip();
+                return;
+            }
             if(dialogIsOpen)
             {
                 errorQueueItem newItem;
@@ -355,6 +383,13 @@ void CopyEngine::folderAlreadyExists(QFileInfo source,QFileInfo destination,bool
             thread->setFolderExistsAction(tempFolderExistsAction);
         break;
         default:
+            if(interface==NULL)
+            {
+                //headless, nobody to ask, the files into it follow the file collision policy
+                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"no interface to ask, merge the folder: "+destination.absoluteFilePath());
+                thread->setFolderExistsAction(FolderExists_Merge);
+                break;
+            }
             if(dialogIsOpen)
             {
                 alreadyExistsQueueItem newItem;
@@ -413,6 +448,13 @@ void CopyEngine::errorOnFolder(QFileInfo fileInfo, QString errorString, ScanFile
             thread->setFolderErrorAction(tempFileErrorAction);
         break;
         default:
+            if(interface==NULL)
+            {
+                //headless, nobody to ask, the error is logged and the folder skipped
+                emit error(fileInfo.absoluteFilePath(),fileInfo.size(),fileInfo.lastModified(),errorString);
+                thread->setFolderErrorAction(FileError_Skip);
+                break;
+            }
             if(dialogIsOpen)
             {
                 errorQueueItem newItem;
@@ -472,6 +514,13 @@ void CopyEngine::mkPathErrorOnFolder(QFileInfo folder,QString errorString,const
             listThread->mkPathQueue.retry();
         return;
         default:
+            if(interface==NULL)
+            {
+                //headless, nobody to ask, the error is logged and the folder skipped
+                emit error(folder.absoluteFilePath(),folder.size(),folder.lastModified(),errorString);
+                listThread->mkPathQueue.skip();
+                return;
+            }
             if(dialogIsOpen)
             {
                 errorQueueItem newItem;
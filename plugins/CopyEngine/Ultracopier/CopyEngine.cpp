@@ -40,7 +40,6 @@ CopyEngine::CopyEngine(FacilityInterface * facilityEngine) :
     alwaysDoThisActionForFileError	= FileError_NotSet;
     checkDestinationFolderExists	= false;
     stopIt                          = false;
-    size_for_speed                  = 0;
     putAtBottom                     = 0;
     forcedMode                      = false;
     followTheStrictOrder            = false;
@@ -117,6 +116,8 @@ void CopyEngine::connectTheSignalsSlots()
     #ifdef ULTRACOPIER_PLUGIN_DEBUG_WINDOW
     if(!connect(listThread,&ListThread::updateTheDebugInfo,				this,&CopyEngine::updateTheDebugInfo,			Qt::QueuedConnection))
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,"unable to connect updateTheDebugInfo()");
+    if(!connect(&debugDialogWindow,&DebugDialog::dumpLatency,				listThread,&ListThread::dumpLatency,			Qt::QueuedConnection))
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,"unable to connect dumpLatency()");
     #endif
     if(!connect(listThread,&ListThread::errorTransferList,							this,&CopyEngine::errorTransferList,						Qt::QueuedConnection))
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,"unable to connect errorTransferList()");
@@ -124,8 +125,6 @@ void CopyEngine::connectTheSignalsSlots()
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,"unable to connect warningTransferList()");
     if(!connect(listThread,&ListThread::mkPathErrorOnFolder,					this,&CopyEngine::mkPathErrorOnFolderSlot,				Qt::QueuedConnection))
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,"unable to connect mkPathErrorOnFolder()");
-    if(!connect(listThread,&ListThread::send_realBytesTransfered,					this,&CopyEngine::get_realBytesTransfered,				Qt::QueuedConnection))
-        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,"unable to connect send_realBytesTransfered()");
 
     if(!connect(this,&CopyEngine::tryCancel,						listThread,&ListThread::cancel,				Qt::QueuedConnection))
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,"unable to connect tryCancel()");
@@ -428,7 +427,8 @@ bool CopyEngine::newCopy(const QStringList &sources)
     if(forcedMode && mode!=Ultracopier::Copy)
     {
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"The engine is forced to move, you can't copy with it");
-        QMessageBox::critical(NULL,facilityEngine->translateText(QStringLiteral("Internal error")),tr("The engine is forced to move, you can't copy with it"));
+        if(interface!=NULL)
+            QMessageBox::critical(NULL,facilityEngine->translateText(QStringLiteral("Internal error")),tr("The engine is forced to move, you can't copy with it"));
         return false;
     }
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"start");
@@ -450,7 +450,8 @@ bool CopyEngine::newCopy(const QStringList &sources,const QString &destination)
     if(forcedMode && mode!=Ultracopier::Copy)
     {
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"The engine is forced to move, you can't copy with it");
-        QMessageBox::critical(NULL,facilityEngine->translateText(QStringLiteral("Internal error")),tr("The engine is forced to move, you can't copy with it"));
+        if(interface!=NULL)
+            QMessageBox::critical(NULL,facilityEngine->translateText(QStringLiteral("Internal error")),tr("The engine is forced to move, you can't copy with it"));
         return false;
     }
     return listThread->newCopy(sources,destination);
@@ -461,13 +462,14 @@ bool CopyEngine::newMove(const QStringList &sources)
     if(forcedMode && mode!=Ultracopier::Move)
     {
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"The engine is forced to copy, you can't move with it");
-        QMessageBox::critical(NULL,facilityEngine->translateText(QStringLiteral("Internal error")),tr("The engine is forced to copy, you can't move with it"));
+        if(interface!=NULL)
+            QMessageBox::critical(NULL,facilityEngine->translateText(QStringLiteral("Internal error")),tr("The engine is forced to copy, you can't move with it"));
         return false;
     }
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"start");
     QString destination;
-    if(!ui->defaultDestinationFolder->text().isEmpty() && QDir(ui->defaultDestinationFolder->text()).exists())
-        destination = ui->defaultDestinationFolder->text();
+    if(!defaultDestinationFolder.isEmpty() && QDir(defaultDestinationFolder).exists())
+        destination = defaultDestinationFolder;
     else
         destination = askDestination();
     if(destination.isEmpty())
@@ -483,7 +485,8 @@ bool CopyEngine::newMove(const QStringList &sources,const QString &destination)
     if(forcedMode && mode!=Ultracopier::Move)
     {
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"The engine is forced to copy, you can't move with it");
-        QMessageBox::critical(NULL,facilityEngine->translateText(QStringLiteral("Internal error")),tr("The engine is forced to copy, you can't move with it"));
+        if(interface!=NULL)
+            QMessageBox::critical(NULL,facilityEngine->translateText(QStringLiteral("Internal error")),tr("The engine is forced to copy, you can't move with it"));
         return false;
     }
     return listThread->newMove(sources,destination);
@@ -505,6 +508,9 @@ void CopyEngine::defaultDestinationFolderBrowse()
 QString CopyEngine::askDestination()
 {
     QString destination = listThread->getUniqueDestinationFolder();
+    //headless, nobody to ask, then only the actual destination can be used
+    if(interface==NULL)
+        return destination;
     if(!destination.isEmpty())
     {
         QMessageBox::StandardButton button=QMessageBox::question(interface,tr("Destination"),tr("Use the actual destination \"%1\"?").arg(destination),QMessageBox::Yes | QMessageBox::No,QMessageBox::Yes);
@@ -520,10 +526,10 @@ void CopyEngine::newTransferList(const QString &file)
     emit signal_importTransferList(file);
 }
 
-//because direct access to list thread into the main thread can't be do
+//read without lock the progression published by the list thread
 quint64 CopyEngine::realByteTransfered()
 {
-    return size_for_speed;
+    return listThread->getRealByteTransfered();
 }
 
 //speed limitation
@@ -716,7 +722,8 @@ void CopyEngine::forceMode(const Ultracopier::CopyMode &mode)
     if(forcedMode)
     {
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("Mode forced previously"));
-        QMessageBox::critical(NULL,facilityEngine->translateText(QStringLiteral("Internal error")),tr("The mode has been forced previously. This is an internal error, please report it"));
+        if(interface!=NULL)
+            QMessageBox::critical(NULL,facilityEngine->translateText(QStringLiteral("Internal error")),tr("The mode has been forced previously. This is an internal error, please report it"));
         return;
     }
     #ifdef ULTRACOPIER_PLUGIN_RSYNC
@@ -738,7 +745,7 @@ void CopyEngine::forceMode(const Ultracopier::CopyMode &mode)
 
 void CopyEngine::exportTransferList()
 {
-    QString fileName = QFileDialog::getSaveFileName(interface,facilityEngine->translateText(QStringLiteral("Save transfer list")),QStringLiteral("transfer-list.lst"),facilityEngine->translateText(QStringLiteral("Transfer list"))+QStringLiteral(" (*.lst)"));
+    QString fileName = QFileDialog::getSaveFileName(interface,facilityEngine->translateText(QStringLiteral("Save transfer list")),QStringLiteral("transfer-list.lst"),facilityEngine->translateText(QStringLiteral("Transfer list"))+QStringLiteral(" (*.lst);;")+facilityEngine->translateText(QStringLiteral("Binary transfer list"))+QStringLiteral(" (*" TRANSFERLISTFILE_SUFFIX ")"));
     if(fileName.isEmpty())
         return;
     emit signal_exportTransferList(fileName);
@@ -746,7 +753,7 @@ void CopyEngine::exportTransferList()
 
 void CopyEngine::importTransferList()
 {
-    QString fileName = QFileDialog::getOpenFileName(interface,facilityEngine->translateText(QStringLiteral("Open transfer list")),QStringLiteral("transfer-list.lst"),facilityEngine->translateText(QStringLiteral("Transfer list"))+QStringLiteral(" (*.lst)"));
+    QString fileName = QFileDialog::getOpenFileName(interface,facilityEngine->translateText(QStringLiteral("Open transfer list")),QStringLiteral("transfer-list.lst"),facilityEngine->translateText(QStringLiteral("Transfer list"))+QStringLiteral(" (*.lst);;")+facilityEngine->translateText(QStringLiteral("Binary transfer list"))+QStringLiteral(" (*" TRANSFERLISTFILE_SUFFIX ")"));
     if(fileName.isEmpty())
         return;
     emit signal_importTransferList(fileName);
@@ -754,11 +761,25 @@ void CopyEngine::importTransferList()
 
 void CopyEngine::warningTransferList(const QString &warning)
 {
+    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,warning);
+    //headless, nobody to show it, then only logged
+    if(interface==NULL)
+    {
+        emit error(QString(),0,QDateTime(),warning);
+        return;
+    }
     QMessageBox::warning(interface,facilityEngine->translateText(QStringLiteral("Error")),warning);
 }
 
 void CopyEngine::errorTransferList(const QString &error)
 {
+    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,error);
+    //headless, nobody to show it, then only logged
+    if(interface==NULL)
+    {
+        emit this->error(QString(),0,QDateTime(),error);
+        return;
+    }
     QMessageBox::critical(interface,facilityEngine->translateText(QStringLiteral("Error")),error);
 }
 
@@ -1169,18 +1190,14 @@ void CopyEngine::showRenamingRules()
 {
     if(renamingRules==NULL)
     {
-        QMessageBox::critical(NULL,tr("Options error"),tr("Options engine is not loaded. Unable to access the filters"));
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,"options not loaded");
+        if(interface!=NULL)
+            QMessageBox::critical(NULL,tr("Options error"),tr("Options engine is not loaded. Unable to access the filters"));
         return;
     }
     renamingRules->exec();
 }
 
-void CopyEngine::get_realBytesTransfered(quint64 realBytesTransfered)
-{
-    size_for_speed=realBytesTransfered;
-}
-
 void CopyEngine::newActionInProgess(Ultracopier::EngineActionInProgress action)
 {
     if(action==Ultracopier::Idle)
@@ -1230,10 +1247,15 @@ void CopyEngine::setCopyListOrder(const bool &order)
     listThread->setCopyListOrder(order);
 }
 
+void CopyEngine::setPhysicalOrder(const bool &physicalOrder)
+{
+    listThread->setPhysicalOrder(physicalOrder);
+}
+
 void CopyEngine::exportErrorIntoTransferList()
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Information,"exportErrorIntoTransferList");
-    QString fileName = QFileDialog::getSaveFileName(interface,facilityEngine->translateText(QStringLiteral("Save transfer list")),QStringLiteral("transfer-list.lst"),facilityEngine->translateText(QStringLiteral("Transfer list"))+QStringLiteral(" (*.lst)"));
+    QString fileName = QFileDialog::getSaveFileName(interface,facilityEngine->translateText(QStringLiteral("Save transfer list")),QStringLiteral("transfer-list.lst"),facilityEngine->translateText(QStringLiteral("Transfer list"))+QStringLiteral(" (*.lst);;")+facilityEngine->translateText(QStringLiteral("Binary transfer list"))+QStringLiteral(" (*" TRANSFERLISTFILE_SUFFIX ")"));
     if(fileName.isEmpty())
         return;
     emit signal_exportErrorIntoTransferList(fileName);
@@ -102,7 +102,6 @@ private:
         bool isSame;
     };
     QList<alreadyExistsQueueItem> alreadyExistsQueue;
-    quint64 size_for_speed;//because direct access to list thread into the main thread can't be do
     Ultracopier::CopyMode			mode;
     bool				forcedMode;
 
@@ -167,7 +166,6 @@ private slots:
     void showFilterDialog();
     void sendNewRenamingRules(QString firstRenamingRule,QString otherRenamingRule);
     void showRenamingRules();
-    void get_realBytesTransfered(quint64 realBytesTransfered);
     void newActionInProgess(Ultracopier::EngineActionInProgress);
     void updatedBlockSize();
     void updateBufferCheckbox();
@@ -241,6 +239,7 @@ public:
     void setCheckDiskSpace(const bool &checkDiskSpace);
     void setDefaultDestinationFolder(const QString &defaultDestinationFolder);
     void setCopyListOrder(const bool &order);
+    void setPhysicalOrder(const bool &physicalOrder);
     void defaultDestinationFolderBrowse();
     QString askDestination();
 public slots:
@@ -19,6 +19,8 @@ HEADERS         = \
     ../Ultracopier/ReadThread.h \
     ../Ultracopier/WriteThread.h \
     ../Ultracopier/MkPath.h \
+    ../Ultracopier/MkPathWorker.h \
+    ../Ultracopier/PhysicalOrder.h \
     ../Ultracopier/AvancedQFile.h \
     ../Ultracopier/ListThread.h \
     ../../../interface/PluginInterface_CopyEngine.h \
@@ -28,6 +30,14 @@ HEADERS         = \
     ../Ultracopier/FilterRules.h \
     ../Ultracopier/RenamingRules.h \
     ../Ultracopier/DriveManagement.h \
+    ../Ultracopier/DestinationFolderCache.h \
+    ../Ultracopier/LatencyHistogram.h \
+    ../Ultracopier/TransferQueue.h \
+    ../Ultracopier/FolderTable.h \
+    ../Ultracopier/NameArena.h \
+    ../Ultracopier/TransferSpill.h \
+    ../Ultracopier/TransferListFile.h \
+    ../Ultracopier/TransferProgress.h \
     ../Ultracopier/CopyEngine.h \
     ../Ultracopier/DebugDialog.h \
     ../Ultracopier/CopyEngineFactory.h \
@@ -42,13 +52,20 @@ SOURCES         = \
     ../Ultracopier/ReadThread.cpp \
     ../Ultracopier/WriteThread.cpp \
     ../Ultracopier/MkPath.cpp \
+    ../Ultracopier/MkPathWorker.cpp \
+    ../Ultracopier/PhysicalOrder.cpp \
     ../Ultracopier/AvancedQFile.cpp \
     ../Ultracopier/ListThread.cpp \
     ../Ultracopier/Filters.cpp \
     ../Ultracopier/FilterRules.cpp \
     ../Ultracopier/RenamingRules.cpp \
-    ../Ultracopier/ListThread_InodeAction.cpp \
     ../Ultracopier/DriveManagement.cpp \
+    ../Ultracopier/DestinationFolderCache.cpp \
+    ../Ultracopier/LatencyHistogram.cpp \
+    ../Ultracopier/FolderTable.cpp \
+    ../Ultracopier/NameArena.cpp \
+    ../Ultracopier/TransferSpill.cpp \
+    ../Ultracopier/TransferListFile.cpp \
     ../Ultracopier/CopyEngine-collision-and-error.cpp \
     ../Ultracopier/CopyEngine.cpp \
     ../Ultracopier/DebugDialog.cpp \
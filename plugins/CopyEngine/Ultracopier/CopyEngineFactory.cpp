@@ -19,8 +19,7 @@ inline double round(double d) {
 }
 #endif
 
-CopyEngineFactory::CopyEngineFactory() :
-    ui(new Ui::copyEngineOptions())
+CopyEngineFactory::CopyEngineFactory()
 {
     qRegisterMetaType<FolderExistsAction>("FolderExistsAction");
     qRegisterMetaType<FileExistsAction>("FileExistsAction");
@@ -32,57 +31,17 @@ CopyEngineFactory::CopyEngineFactory() :
     qRegisterMetaType<ErrorType>("ErrorType");
     qRegisterMetaType<Diskspace>("Diskspace");
     qRegisterMetaType<QList<Diskspace> >("QList<Diskspace>");
+    qRegisterMetaType<QList<quint64> >("QList<quint64>");
     qRegisterMetaType<QFileInfo>("QFileInfo");
     qRegisterMetaType<Ultracopier::CopyMode>("Ultracopier::CopyMode");
 
-    tempWidget=new QWidget();
-    ui->setupUi(tempWidget);
-    ui->toolBox->setCurrentIndex(0);
-    ui->blockSize->setMaximum(ULTRACOPIER_PLUGIN_MAX_BLOCK_SIZE);
+    ui=NULL;
+    tempWidget=NULL;
     errorFound=false;
     optionsEngine=NULL;
-    filters=new Filters(tempWidget);
-    renamingRules=new RenamingRules(tempWidget);
-
-    connect(ui->doRightTransfer,            &QCheckBox::toggled,                                            this,&CopyEngineFactory::setDoRightTransfer);
-    connect(ui->keepDate,                   &QCheckBox::toggled,                                            this,&CopyEngineFactory::setKeepDate);
-    connect(ui->blockSize,                  static_cast<void(QSpinBox::*)(int)>(&QSpinBox::valueChanged),	this,&CopyEngineFactory::setBlockSize);
-    connect(ui->sequentialBuffer,           static_cast<void(QSpinBox::*)(int)>(&QSpinBox::valueChanged),	this,&CopyEngineFactory::setSequentialBuffer);
-    connect(ui->parallelBuffer,             static_cast<void(QSpinBox::*)(int)>(&QSpinBox::valueChanged),	this,&CopyEngineFactory::setParallelBuffer);
-    connect(ui->parallelizeIfSmallerThan,	static_cast<void(QSpinBox::*)(int)>(&QSpinBox::valueChanged),	this,&CopyEngineFactory::setParallelizeIfSmallerThan);
-    connect(ui->inodeThreads,               static_cast<void(QSpinBox::*)(int)>(&QSpinBox::valueChanged),	this,&CopyEngineFactory::on_inodeThreads_editingFinished);
-    connect(ui->autoStart,                  &QCheckBox::toggled,                                            this,&CopyEngineFactory::setAutoStart);
-    connect(ui->doChecksum,                 &QCheckBox::toggled,                                            this,&CopyEngineFactory::doChecksum_toggled);
-    connect(ui->comboBoxFolderError,        static_cast<void(QComboBox::*)(int)>(&QComboBox::currentIndexChanged),		this,&CopyEngineFactory::setFolderError);
-    connect(ui->comboBoxFolderCollision,	static_cast<void(QComboBox::*)(int)>(&QComboBox::currentIndexChanged),		this,&CopyEngineFactory::setFolderCollision);
-    connect(ui->comboBoxFileError,          static_cast<void(QComboBox::*)(int)>(&QComboBox::currentIndexChanged),		this,&CopyEngineFactory::setFileError);
-    connect(ui->comboBoxFileCollision,      static_cast<void(QComboBox::*)(int)>(&QComboBox::currentIndexChanged),		this,&CopyEngineFactory::setFileCollision);
-    connect(ui->transferAlgorithm,          static_cast<void(QComboBox::*)(int)>(&QComboBox::currentIndexChanged),		this,&CopyEngineFactory::setTransferAlgorithm);
-    connect(ui->checkBoxDestinationFolderExists,	&QCheckBox::toggled,		this,&CopyEngineFactory::setCheckDestinationFolder);
-    connect(ui->checksumIgnoreIfImpossible,	&QCheckBox::toggled,                this,&CopyEngineFactory::checksumIgnoreIfImpossible_toggled);
-    connect(ui->checksumOnlyOnError,        &QCheckBox::toggled,                this,&CopyEngineFactory::checksumOnlyOnError_toggled);
-    connect(ui->osBuffer,                   &QCheckBox::toggled,                this,&CopyEngineFactory::osBuffer_toggled);
-    connect(ui->osBufferLimited,            &QCheckBox::toggled,                this,&CopyEngineFactory::osBufferLimited_toggled);
-    connect(ui->osBufferLimit,              &QSpinBox::editingFinished,         this,&CopyEngineFactory::osBufferLimit_editingFinished);
-    #ifdef ULTRACOPIER_PLUGIN_RSYNC
-    connect(ui->rsync,                      &QCheckBox::toggled,                this,&CopyEngineFactory::setRsync);
-    #endif
-    connect(ui->inodeThreads,               &QSpinBox::editingFinished,         this,&CopyEngineFactory::on_inodeThreads_editingFinished);
-    connect(ui->osBufferLimited,            &QAbstractButton::toggled,          this,&CopyEngineFactory::updateBufferCheckbox);
-    connect(ui->osBuffer,                   &QAbstractButton::toggled,          this,&CopyEngineFactory::updateBufferCheckbox);
-    connect(ui->moveTheWholeFolder,         &QCheckBox::toggled,                this,&CopyEngineFactory::moveTheWholeFolder);
-    connect(ui->followTheStrictOrder,       &QCheckBox::toggled,                this,&CopyEngineFactory::followTheStrictOrder);
-    connect(ui->deletePartiallyTransferredFiles,&QCheckBox::toggled,            this,&CopyEngineFactory::deletePartiallyTransferredFiles);
-    connect(ui->renameTheOriginalDestination,&QCheckBox::toggled,               this,&CopyEngineFactory::renameTheOriginalDestination);
-    connect(ui->checkDiskSpace,             &QCheckBox::toggled,                this,&CopyEngineFactory::checkDiskSpace);
-    connect(ui->defaultDestinationFolderBrowse,&QPushButton::clicked,           this,&CopyEngineFactory::defaultDestinationFolderBrowse);
-    connect(ui->defaultDestinationFolder,&QLineEdit::editingFinished,           this,&CopyEngineFactory::defaultDestinationFolder);
-    connect(ui->copyListOrder,              &QCheckBox::toggled,                this,&CopyEngineFactory::copyListOrder);
-
-    connect(filters,&Filters::sendNewFilters,this,&CopyEngineFactory::sendNewFilters);
-    connect(ui->filters,&QPushButton::clicked,this,&CopyEngineFactory::showFilterDialog);
-    connect(renamingRules,&RenamingRules::sendNewRenamingRules,this,&CopyEngineFactory::sendNewRenamingRules);
-    connect(ui->renamingRules,&QPushButton::clicked,this,&CopyEngineFactory::showRenamingRules);
+    filters=NULL;
+    renamingRules=NULL;
+    optionsValue=OptionsValue();
 
     lunchInitFunction.setInterval(0);
     lunchInitFunction.setSingleShot(true);
@@ -92,9 +51,12 @@ CopyEngineFactory::CopyEngineFactory() :
 
 CopyEngineFactory::~CopyEngineFactory()
 {
-    delete renamingRules;
-    delete filters;
-    delete ui;
+    if(renamingRules!=NULL)
+        delete renamingRules;
+    if(filters!=NULL)
+        delete filters;
+    if(ui!=NULL)
+        delete ui;
 }
 
 void CopyEngineFactory::init()
@@ -110,38 +72,39 @@ PluginInterface_CopyEngine * CopyEngineFactory::getInstance()
     realObject->connectTheSignalsSlots();
     PluginInterface_CopyEngine * newTransferEngine=realObject;
     connect(this,&CopyEngineFactory::reloadLanguage,realObject,&CopyEngine::newLanguageLoaded);
-    realObject->setRightTransfer(ui->doRightTransfer->isChecked());
-    realObject->setKeepDate(ui->keepDate->isChecked());
-    realObject->setBlockSize(ui->blockSize->value());
-    realObject->setAutoStart(ui->autoStart->isChecked());
+    realObject->setRightTransfer(optionsValue.doRightTransfer);
+    realObject->setKeepDate(optionsValue.keepDate);
+    realObject->setBlockSize(optionsValue.blockSize);
+    realObject->setAutoStart(optionsValue.autoStart);
     #ifdef ULTRACOPIER_PLUGIN_RSYNC
-    realObject->setRsync(ui->rsync->isChecked());
+    realObject->setRsync(optionsValue.rsync);
     #endif
-    realObject->setFolderCollision(ui->comboBoxFolderCollision->currentIndex());
-    realObject->setFolderError(ui->comboBoxFolderError->currentIndex());
-    realObject->setFileCollision(ui->comboBoxFileCollision->currentIndex());
-    realObject->setFileError(ui->comboBoxFileError->currentIndex());
-    realObject->setTransferAlgorithm(ui->transferAlgorithm->currentIndex());
-    realObject->setCheckDestinationFolderExists(ui->checkBoxDestinationFolderExists->isChecked());
-    realObject->set_doChecksum(ui->doChecksum->isChecked());
-    realObject->set_checksumIgnoreIfImpossible(ui->checksumIgnoreIfImpossible->isChecked());
-    realObject->set_checksumOnlyOnError(ui->checksumOnlyOnError->isChecked());
-    realObject->set_osBuffer(ui->osBuffer->isChecked());
-    realObject->set_osBufferLimited(ui->osBufferLimited->isChecked());
-    realObject->set_osBufferLimit(ui->osBufferLimit->value());
+    realObject->setFolderCollision(optionsValue.folderCollision);
+    realObject->setFolderError(optionsValue.folderError);
+    realObject->setFileCollision(optionsValue.fileCollision);
+    realObject->setFileError(optionsValue.fileError);
+    realObject->setTransferAlgorithm(optionsValue.transferAlgorithm);
+    realObject->setCheckDestinationFolderExists(optionsValue.checkDestinationFolder);
+    realObject->set_doChecksum(optionsValue.doChecksum);
+    realObject->set_checksumIgnoreIfImpossible(optionsValue.checksumIgnoreIfImpossible);
+    realObject->set_checksumOnlyOnError(optionsValue.checksumOnlyOnError);
+    realObject->set_osBuffer(optionsValue.osBuffer);
+    realObject->set_osBufferLimited(optionsValue.osBufferLimited);
+    realObject->set_osBufferLimit(optionsValue.osBufferLimit);
     realObject->set_setFilters(includeStrings,includeOptions,excludeStrings,excludeOptions);
     realObject->setRenamingRules(firstRenamingRule,otherRenamingRule);
-    realObject->setSequentialBuffer(ui->sequentialBuffer->value());
-    realObject->setParallelBuffer(ui->parallelBuffer->value());
-    realObject->setParallelizeIfSmallerThan(ui->parallelizeIfSmallerThan->value());
-    realObject->setMoveTheWholeFolder(ui->moveTheWholeFolder->isChecked());
-    realObject->setFollowTheStrictOrder(ui->followTheStrictOrder->isChecked());
-    realObject->setDeletePartiallyTransferredFiles(ui->deletePartiallyTransferredFiles->isChecked());
-    realObject->setInodeThreads(ui->inodeThreads->value());
-    realObject->setRenameTheOriginalDestination(ui->renameTheOriginalDestination->isChecked());
-    realObject->setCheckDiskSpace(ui->checkDiskSpace->isChecked());
-    realObject->setDefaultDestinationFolder(ui->defaultDestinationFolder->text());
-    realObject->setCopyListOrder(ui->copyListOrder->isChecked());
+    realObject->setSequentialBuffer(optionsValue.sequentialBuffer);
+    realObject->setParallelBuffer(optionsValue.parallelBuffer);
+    realObject->setParallelizeIfSmallerThan(optionsValue.parallelizeIfSmallerThan);
+    realObject->setMoveTheWholeFolder(optionsValue.moveTheWholeFolder);
+    realObject->setFollowTheStrictOrder(optionsValue.followTheStrictOrder);
+    realObject->setDeletePartiallyTransferredFiles(optionsValue.deletePartiallyTransferredFiles);
+    realObject->setInodeThreads(optionsValue.inodeThreads);
+    realObject->setRenameTheOriginalDestination(optionsValue.renameTheOriginalDestination);
+    realObject->setCheckDiskSpace(optionsValue.checkDiskSpace);
+    realObject->setDefaultDestinationFolder(optionsValue.defaultDestinationFolder);
+    realObject->setCopyListOrder(optionsValue.copyListOrder);
+    realObject->setPhysicalOrder(optionsValue.physicalOrder);
     return newTransferEngine;
 }
 
@@ -221,68 +184,180 @@ void CopyEngineFactory::setResources(OptionInterface * options,const QString &wr
         KeysList.append(qMakePair(QStringLiteral("defaultDestinationFolder"),QVariant(QString())));
         KeysList.append(qMakePair(QStringLiteral("inodeThreads"),QVariant(1)));
         KeysList.append(qMakePair(QStringLiteral("copyListOrder"),QVariant(false)));
+        KeysList.append(qMakePair(QStringLiteral("physicalOrder"),QVariant(false)));
         options->addOptionGroup(KeysList);
-        #if ! defined (Q_CC_GNU)
-        ui->keepDate->setEnabled(false);
-        ui->keepDate->setToolTip(QStringLiteral("Not supported with this compiler"));
-        #endif
-        ui->doRightTransfer->setChecked(options->getOptionValue(QStringLiteral("doRightTransfer")).toBool());
-        ui->keepDate->setChecked(options->getOptionValue(QStringLiteral("keepDate")).toBool());
-        ui->blockSize->setValue(options->getOptionValue(QStringLiteral("blockSize")).toUInt());//keep before sequentialBuffer and parallelBuffer
-        ui->autoStart->setChecked(options->getOptionValue(QStringLiteral("autoStart")).toBool());
+        optionsValue.doRightTransfer=options->getOptionValue(QStringLiteral("doRightTransfer")).toBool();
+        optionsValue.keepDate=options->getOptionValue(QStringLiteral("keepDate")).toBool();
+        optionsValue.blockSize=options->getOptionValue(QStringLiteral("blockSize")).toUInt();
+        if(optionsValue.blockSize<1)
+            optionsValue.blockSize=1;
+        if(optionsValue.blockSize>ULTRACOPIER_PLUGIN_MAX_BLOCK_SIZE)
+            optionsValue.blockSize=ULTRACOPIER_PLUGIN_MAX_BLOCK_SIZE;
+        optionsValue.autoStart=options->getOptionValue(QStringLiteral("autoStart")).toBool();
         #ifdef ULTRACOPIER_PLUGIN_RSYNC
-        ui->rsync->setChecked(options->getOptionValue(QStringLiteral("rsync")).toBool());
-        #else
-        ui->label_rsync->setVisible(false);
-        ui->rsync->setVisible(false);
+        optionsValue.rsync=options->getOptionValue(QStringLiteral("rsync")).toBool();
         #endif
-        ui->comboBoxFolderError->setCurrentIndex(options->getOptionValue(QStringLiteral("folderError")).toUInt());
-        ui->comboBoxFolderCollision->setCurrentIndex(options->getOptionValue(QStringLiteral("folderCollision")).toUInt());
-        ui->comboBoxFileError->setCurrentIndex(options->getOptionValue(QStringLiteral("fileError")).toUInt());
-        ui->comboBoxFileCollision->setCurrentIndex(options->getOptionValue(QStringLiteral("fileCollision")).toUInt());
-        ui->transferAlgorithm->setCurrentIndex(options->getOptionValue(QStringLiteral("transferAlgorithm")).toUInt());
-        ui->checkBoxDestinationFolderExists->setChecked(options->getOptionValue(QStringLiteral("checkDestinationFolder")).toBool());
-        ui->parallelizeIfSmallerThan->setValue(options->getOptionValue(QStringLiteral("parallelizeIfSmallerThan")).toUInt());
-        ui->sequentialBuffer->setValue(options->getOptionValue(QStringLiteral("sequentialBuffer")).toUInt());
-        ui->parallelBuffer->setValue(options->getOptionValue(QStringLiteral("parallelBuffer")).toUInt());
-        ui->sequentialBuffer->setSingleStep(ui->blockSize->value());
-        ui->parallelBuffer->setSingleStep(ui->blockSize->value());
-        ui->deletePartiallyTransferredFiles->setChecked(options->getOptionValue(QStringLiteral("deletePartiallyTransferredFiles")).toBool());
-        ui->moveTheWholeFolder->setChecked(options->getOptionValue(QStringLiteral("moveTheWholeFolder")).toBool());
-        ui->followTheStrictOrder->setChecked(options->getOptionValue(QStringLiteral("followTheStrictOrder")).toBool());
-        ui->inodeThreads->setValue(options->getOptionValue(QStringLiteral("inodeThreads")).toUInt());
-        ui->renameTheOriginalDestination->setChecked(options->getOptionValue(QStringLiteral("renameTheOriginalDestination")).toBool());
-        ui->checkDiskSpace->setChecked(options->getOptionValue(QStringLiteral("checkDiskSpace")).toBool());
-        ui->defaultDestinationFolder->setText(options->getOptionValue(QStringLiteral("defaultDestinationFolder")).toString());
-
-        ui->doChecksum->setChecked(options->getOptionValue(QStringLiteral("doChecksum")).toBool());
-        ui->checksumIgnoreIfImpossible->setChecked(options->getOptionValue(QStringLiteral("checksumIgnoreIfImpossible")).toBool());
-        ui->checksumOnlyOnError->setChecked(options->getOptionValue(QStringLiteral("checksumOnlyOnError")).toBool());
-
-        ui->osBuffer->setChecked(options->getOptionValue(QStringLiteral("osBuffer")).toBool());
-        ui->osBufferLimited->setChecked(options->getOptionValue(QStringLiteral("osBufferLimited")).toBool());
-        ui->osBufferLimit->setValue(options->getOptionValue(QStringLiteral("osBufferLimit")).toUInt());
-        //ui->autoStart->setChecked(options->getOptionValue(QStringLiteral("autoStart")).toBool());//moved from options(), wrong previous place
+        optionsValue.folderError=options->getOptionValue(QStringLiteral("folderError")).toUInt();
+        optionsValue.folderCollision=options->getOptionValue(QStringLiteral("folderCollision")).toUInt();
+        optionsValue.fileError=options->getOptionValue(QStringLiteral("fileError")).toUInt();
+        optionsValue.fileCollision=options->getOptionValue(QStringLiteral("fileCollision")).toUInt();
+        optionsValue.transferAlgorithm=options->getOptionValue(QStringLiteral("transferAlgorithm")).toUInt();
+        optionsValue.checkDestinationFolder=options->getOptionValue(QStringLiteral("checkDestinationFolder")).toBool();
+        optionsValue.parallelizeIfSmallerThan=options->getOptionValue(QStringLiteral("parallelizeIfSmallerThan")).toUInt();
+        //keep after the block size, rounded like the spinbox of the options do
+        optionsValue.sequentialBuffer=bufferToBlockSize(options->getOptionValue(QStringLiteral("sequentialBuffer")).toUInt(),ULTRACOPIER_PLUGIN_MAX_SEQUENTIAL_NUMBER_OF_BLOCK);
+        optionsValue.parallelBuffer=bufferToBlockSize(options->getOptionValue(QStringLiteral("parallelBuffer")).toUInt(),ULTRACOPIER_PLUGIN_MAX_PARALLEL_NUMBER_OF_BLOCK);
+        options->setOptionValue(QStringLiteral("sequentialBuffer"),optionsValue.sequentialBuffer);
+        options->setOptionValue(QStringLiteral("parallelBuffer"),optionsValue.parallelBuffer);
+        optionsValue.deletePartiallyTransferredFiles=options->getOptionValue(QStringLiteral("deletePartiallyTransferredFiles")).toBool();
+        optionsValue.moveTheWholeFolder=options->getOptionValue(QStringLiteral("moveTheWholeFolder")).toBool();
+        optionsValue.followTheStrictOrder=options->getOptionValue(QStringLiteral("followTheStrictOrder")).toBool();
+        optionsValue.inodeThreads=options->getOptionValue(QStringLiteral("inodeThreads")).toUInt();
+        optionsValue.renameTheOriginalDestination=options->getOptionValue(QStringLiteral("renameTheOriginalDestination")).toBool();
+        optionsValue.checkDiskSpace=options->getOptionValue(QStringLiteral("checkDiskSpace")).toBool();
+        optionsValue.defaultDestinationFolder=options->getOptionValue(QStringLiteral("defaultDestinationFolder")).toString();
+
+        optionsValue.doChecksum=options->getOptionValue(QStringLiteral("doChecksum")).toBool();
+        optionsValue.checksumIgnoreIfImpossible=options->getOptionValue(QStringLiteral("checksumIgnoreIfImpossible")).toBool();
+        optionsValue.checksumOnlyOnError=options->getOptionValue(QStringLiteral("checksumOnlyOnError")).toBool();
+
+        optionsValue.osBuffer=options->getOptionValue(QStringLiteral("osBuffer")).toBool();
+        optionsValue.osBufferLimited=options->getOptionValue(QStringLiteral("osBufferLimited")).toBool();
+        optionsValue.osBufferLimit=options->getOptionValue(QStringLiteral("osBufferLimit")).toUInt();
         includeStrings=options->getOptionValue(QStringLiteral("includeStrings")).toStringList();
         includeOptions=options->getOptionValue(QStringLiteral("includeOptions")).toStringList();
         excludeStrings=options->getOptionValue(QStringLiteral("excludeStrings")).toStringList();
         excludeOptions=options->getOptionValue(QStringLiteral("excludeOptions")).toStringList();
-        filters->setFilters(includeStrings,includeOptions,excludeStrings,excludeOptions);
         firstRenamingRule=options->getOptionValue(QStringLiteral("firstRenamingRule")).toString();
         otherRenamingRule=options->getOptionValue(QStringLiteral("otherRenamingRule")).toString();
-        renamingRules->setRenamingRules(firstRenamingRule,otherRenamingRule);
-
-        ui->checksumOnlyOnError->setEnabled(ui->doChecksum->isChecked());
-        ui->checksumIgnoreIfImpossible->setEnabled(ui->doChecksum->isChecked());
-        ui->copyListOrder->setChecked(options->getOptionValue(QStringLiteral("copyListOrder")).toBool());
+        optionsValue.copyListOrder=options->getOptionValue(QStringLiteral("copyListOrder")).toBool();
+        optionsValue.physicalOrder=options->getOptionValue(QStringLiteral("physicalOrder")).toBool();
 
-        updateBufferCheckbox();
         optionsEngine=options;
-
-        updatedBlockSize();
     }
 }
 
+int CopyEngineFactory::bufferToBlockSize(const int &buffer,const int &maxNumberOfBlock) const
+{
+    int newBuffer=round((float)buffer/(float)optionsValue.blockSize)*optionsValue.blockSize;
+    if(newBuffer<optionsValue.blockSize)
+        newBuffer=optionsValue.blockSize;
+    if(newBuffer>optionsValue.blockSize*maxNumberOfBlock)
+        newBuffer=optionsValue.blockSize*maxNumberOfBlock;
+    return newBuffer;
+}
+
+void CopyEngineFactory::createOptionsWidget()
+{
+    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("create the options widget"));
+    //don't save the value set on the widgets
+    OptionInterface * optionsEngine=this->optionsEngine;
+    this->optionsEngine=NULL;
+    ui=new Ui::copyEngineOptions();
+    tempWidget=new QWidget();
+    ui->setupUi(tempWidget);
+    retranslateOptionsWidget();
+    ui->toolBox->setCurrentIndex(0);
+    ui->blockSize->setMaximum(ULTRACOPIER_PLUGIN_MAX_BLOCK_SIZE);
+    filters=new Filters(tempWidget);
+    renamingRules=new RenamingRules(tempWidget);
+
+    #if ! defined (Q_CC_GNU)
+    ui->keepDate->setEnabled(false);
+    ui->keepDate->setToolTip(QStringLiteral("Not supported with this compiler"));
+    #endif
+    ui->doRightTransfer->setChecked(optionsValue.doRightTransfer);
+    ui->keepDate->setChecked(optionsValue.keepDate);
+    ui->blockSize->setValue(optionsValue.blockSize);//keep before sequentialBuffer and parallelBuffer
+    ui->autoStart->setChecked(optionsValue.autoStart);
+    #ifdef ULTRACOPIER_PLUGIN_RSYNC
+    ui->rsync->setChecked(optionsValue.rsync);
+    #else
+    ui->label_rsync->setVisible(false);
+    ui->rsync->setVisible(false);
+    #endif
+    ui->comboBoxFolderError->setCurrentIndex(optionsValue.folderError);
+    ui->comboBoxFolderCollision->setCurrentIndex(optionsValue.folderCollision);
+    ui->comboBoxFileError->setCurrentIndex(optionsValue.fileError);
+    ui->comboBoxFileCollision->setCurrentIndex(optionsValue.fileCollision);
+    ui->transferAlgorithm->setCurrentIndex(optionsValue.transferAlgorithm);
+    ui->checkBoxDestinationFolderExists->setChecked(optionsValue.checkDestinationFolder);
+    ui->parallelizeIfSmallerThan->setValue(optionsValue.parallelizeIfSmallerThan);
+    updatedBlockSize();
+    ui->sequentialBuffer->setValue(optionsValue.sequentialBuffer);
+    ui->parallelBuffer->setValue(optionsValue.parallelBuffer);
+    ui->deletePartiallyTransferredFiles->setChecked(optionsValue.deletePartiallyTransferredFiles);
+    ui->moveTheWholeFolder->setChecked(optionsValue.moveTheWholeFolder);
+    ui->followTheStrictOrder->setChecked(optionsValue.followTheStrictOrder);
+    ui->inodeThreads->setValue(optionsValue.inodeThreads);
+    ui->renameTheOriginalDestination->setChecked(optionsValue.renameTheOriginalDestination);
+    ui->checkDiskSpace->setChecked(optionsValue.checkDiskSpace);
+    ui->defaultDestinationFolder->setText(optionsValue.defaultDestinationFolder);
+
+    ui->doChecksum->setChecked(optionsValue.doChecksum);
+    ui->checksumIgnoreIfImpossible->setChecked(optionsValue.checksumIgnoreIfImpossible);
+    ui->checksumOnlyOnError->setChecked(optionsValue.checksumOnlyOnError);
+
+    ui->osBuffer->setChecked(optionsValue.osBuffer);
+    ui->osBufferLimited->setChecked(optionsValue.osBufferLimited);
+    ui->osBufferLimit->setValue(optionsValue.osBufferLimit);
+    filters->setFilters(includeStrings,includeOptions,excludeStrings,excludeOptions);
+    renamingRules->setRenamingRules(firstRenamingRule,otherRenamingRule);
+
+    ui->checksumOnlyOnError->setEnabled(ui->doChecksum->isChecked());
+    ui->checksumIgnoreIfImpossible->setEnabled(ui->doChecksum->isChecked());
+    ui->copyListOrder->setChecked(optionsValue.copyListOrder);
+    ui->physicalOrder->setChecked(optionsValue.physicalOrder);
+    #ifndef Q_OS_LINUX
+    ui->label_physicalOrder->setVisible(false);
+    ui->physicalOrder->setVisible(false);
+    #endif
+
+    updateBufferCheckbox();
+
+    connect(ui->doRightTransfer,            &QCheckBox::toggled,                                            this,&CopyEngineFactory::setDoRightTransfer);
+    connect(ui->keepDate,                   &QCheckBox::toggled,                                            this,&CopyEngineFactory::setKeepDate);
+    connect(ui->blockSize,                  static_cast<void(QSpinBox::*)(int)>(&QSpinBox::valueChanged),	this,&CopyEngineFactory::setBlockSize);
+    connect(ui->sequentialBuffer,           static_cast<void(QSpinBox::*)(int)>(&QSpinBox::valueChanged),	this,&CopyEngineFactory::setSequentialBuffer);
+    connect(ui->parallelBuffer,             static_cast<void(QSpinBox::*)(int)>(&QSpinBox::valueChanged),	this,&CopyEngineFactory::setParallelBuffer);
+    connect(ui->parallelizeIfSmallerThan,	static_cast<void(QSpinBox::*)(int)>(&QSpinBox::valueChanged),	this,&CopyEngineFactory::setParallelizeIfSmallerThan);
+    connect(ui->inodeThreads,               static_cast<void(QSpinBox::*)(int)>(&QSpinBox::valueChanged),	this,&CopyEngineFactory::on_inodeThreads_editingFinished);
+    connect(ui->autoStart,                  &QCheckBox::toggled,                                            this,&CopyEngineFactory::setAutoStart);
+    connect(ui->doChecksum,                 &QCheckBox::toggled,                                            this,&CopyEngineFactory::doChecksum_toggled);
+    connect(ui->comboBoxFolderError,        static_cast<void(QComboBox::*)(int)>(&QComboBox::currentIndexChanged),		this,&CopyEngineFactory::setFolderError);
+    connect(ui->comboBoxFolderCollision,	static_cast<void(QComboBox::*)(int)>(&QComboBox::currentIndexChanged),		this,&CopyEngineFactory::setFolderCollision);
+    connect(ui->comboBoxFileError,          static_cast<void(QComboBox::*)(int)>(&QComboBox::currentIndexChanged),		this,&CopyEngineFactory::setFileError);
+    connect(ui->comboBoxFileCollision,      static_cast<void(QComboBox::*)(int)>(&QComboBox::currentIndexChanged),		this,&CopyEngineFactory::setFileCollision);
+    connect(ui->transferAlgorithm,          static_cast<void(QComboBox::*)(int)>(&QComboBox::currentIndexChanged),		this,&CopyEngineFactory::setTransferAlgorithm);
+    connect(ui->checkBoxDestinationFolderExists,	&QCheckBox::toggled,		this,&CopyEngineFactory::setCheckDestinationFolder);
+    connect(ui->checksumIgnoreIfImpossible,	&QCheckBox::toggled,                this,&CopyEngineFactory::checksumIgnoreIfImpossible_toggled);
+    connect(ui->checksumOnlyOnError,        &QCheckBox::toggled,                this,&CopyEngineFactory::checksumOnlyOnError_toggled);
+    connect(ui->osBuffer,                   &QCheckBox::toggled,                this,&CopyEngineFactory::osBuffer_toggled);
+    connect(ui->osBufferLimited,            &QCheckBox::toggled,                this,&CopyEngineFactory::osBufferLimited_toggled);
+    connect(ui->osBufferLimit,              &QSpinBox::editingFinished,         this,&CopyEngineFactory::osBufferLimit_editingFinished);
+    #ifdef ULTRACOPIER_PLUGIN_RSYNC
+    connect(ui->rsync,                      &QCheckBox::toggled,                this,&CopyEngineFactory::setRsync);
+    #endif
+    connect(ui->inodeThreads,               &QSpinBox::editingFinished,         this,&CopyEngineFactory::on_inodeThreads_editingFinished);
+    connect(ui->osBufferLimited,            &QAbstractButton::toggled,          this,&CopyEngineFactory::updateBufferCheckbox);
+    connect(ui->osBuffer,                   &QAbstractButton::toggled,          this,&CopyEngineFactory::updateBufferCheckbox);
+    connect(ui->moveTheWholeFolder,         &QCheckBox::toggled,                this,&CopyEngineFactory::moveTheWholeFolder);
+    connect(ui->followTheStrictOrder,       &QCheckBox::toggled,                this,&CopyEngineFactory::followTheStrictOrder);
+    connect(ui->deletePartiallyTransferredFiles,&QCheckBox::toggled,            this,&CopyEngineFactory::deletePartiallyTransferredFiles);
+    connect(ui->renameTheOriginalDestination,&QCheckBox::toggled,               this,&CopyEngineFactory::renameTheOriginalDestination);
+    connect(ui->checkDiskSpace,             &QCheckBox::toggled,                this,&CopyEngineFactory::checkDiskSpace);
+    connect(ui->defaultDestinationFolderBrowse,&QPushButton::clicked,           this,&CopyEngineFactory::defaultDestinationFolderBrowse);
+    connect(ui->defaultDestinationFolder,&QLineEdit::editingFinished,           this,&CopyEngineFactory::defaultDestinationFolder);
+    connect(ui->copyListOrder,              &QCheckBox::toggled,                this,&CopyEngineFactory::copyListOrder);
+    connect(ui->physicalOrder,              &QCheckBox::toggled,                this,&CopyEngineFactory::physicalOrder);
+
+    connect(filters,&Filters::sendNewFilters,this,&CopyEngineFactory::sendNewFilters);
+    connect(ui->filters,&QPushButton::clicked,this,&CopyEngineFactory::showFilterDialog);
+    connect(renamingRules,&RenamingRules::sendNewRenamingRules,this,&CopyEngineFactory::sendNewRenamingRules);
+    connect(ui->renamingRules,&QPushButton::clicked,this,&CopyEngineFactory::showRenamingRules);
+    this->optionsEngine=optionsEngine;
+}
+
 QStringList CopyEngineFactory::supportedProtocolsForTheSource() const
 {
     return QStringList() << QStringLiteral("file");
@@ -314,12 +389,15 @@ void CopyEngineFactory::resetOptions()
 
 QWidget * CopyEngineFactory::options()
 {
+    if(ui==NULL)
+        createOptionsWidget();
     return tempWidget;
 }
 
 void CopyEngineFactory::setDoRightTransfer(bool doRightTransfer)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the value have changed");
+    optionsValue.doRightTransfer=doRightTransfer;
     if(optionsEngine!=NULL)
         optionsEngine->setOptionValue(QStringLiteral("doRightTransfer"),doRightTransfer);
 }
@@ -327,6 +405,7 @@ void CopyEngineFactory::setDoRightTransfer(bool doRightTransfer)
 void CopyEngineFactory::setKeepDate(bool keepDate)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the value have changed");
+    optionsValue.keepDate=keepDate;
     if(optionsEngine!=NULL)
         optionsEngine->setOptionValue(QStringLiteral("keepDate"),keepDate);
 }
@@ -336,6 +415,7 @@ void CopyEngineFactory::setBlockSize(int blockSize)
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the value have changed");
     if(optionsEngine!=NULL)
         optionsEngine->setOptionValue(QStringLiteral("blockSize"),blockSize);
+    optionsValue.blockSize=blockSize;
     updatedBlockSize();
 }
 
@@ -346,6 +426,7 @@ void CopyEngineFactory::setParallelBuffer(int parallelBuffer)
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the value have changed");
         parallelBuffer=round((float)parallelBuffer/(float)ui->blockSize->value())*ui->blockSize->value();
         ui->parallelBuffer->setValue(parallelBuffer);
+        optionsValue.parallelBuffer=parallelBuffer;
         optionsEngine->setOptionValue(QStringLiteral("parallelBuffer"),parallelBuffer);
     }
 }
@@ -357,6 +438,7 @@ void CopyEngineFactory::setSequentialBuffer(int sequentialBuffer)
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("the value have changed"));
         sequentialBuffer=round((float)sequentialBuffer/(float)ui->blockSize->value())*ui->blockSize->value();
         ui->sequentialBuffer->setValue(sequentialBuffer);
+        optionsValue.sequentialBuffer=sequentialBuffer;
         optionsEngine->setOptionValue(QStringLiteral("sequentialBuffer"),sequentialBuffer);
     }
 }
@@ -366,6 +448,7 @@ void CopyEngineFactory::setParallelizeIfSmallerThan(int parallelizeIfSmallerThan
     if(optionsEngine!=NULL)
     {
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the value have changed");
+        optionsValue.parallelizeIfSmallerThan=parallelizeIfSmallerThan;
         optionsEngine->setOptionValue(QStringLiteral("parallelizeIfSmallerThan"),parallelizeIfSmallerThan);
     }
 }
@@ -373,6 +456,7 @@ void CopyEngineFactory::setParallelizeIfSmallerThan(int parallelizeIfSmallerThan
 void CopyEngineFactory::setAutoStart(bool autoStart)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the value have changed");
+    optionsValue.autoStart=autoStart;
     if(optionsEngine!=NULL)
         optionsEngine->setOptionValue(QStringLiteral("autoStart"),autoStart);
 }
@@ -380,6 +464,7 @@ void CopyEngineFactory::setAutoStart(bool autoStart)
 void CopyEngineFactory::setFolderCollision(int index)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the value have changed");
+    optionsValue.folderCollision=index;
     if(optionsEngine!=NULL)
         optionsEngine->setOptionValue(QStringLiteral("folderCollision"),index);
 }
@@ -387,6 +472,7 @@ void CopyEngineFactory::setFolderCollision(int index)
 void CopyEngineFactory::setFolderError(int index)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the value have changed");
+    optionsValue.folderError=index;
     if(optionsEngine!=NULL)
         optionsEngine->setOptionValue(QStringLiteral("folderError"),index);
 }
@@ -394,6 +480,7 @@ void CopyEngineFactory::setFolderError(int index)
 void CopyEngineFactory::setTransferAlgorithm(int index)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the value have changed");
+    optionsValue.transferAlgorithm=index;
     if(optionsEngine!=NULL)
         optionsEngine->setOptionValue(QStringLiteral("transferAlgorithm"),index);
 }
@@ -401,6 +488,7 @@ void CopyEngineFactory::setTransferAlgorithm(int index)
 void CopyEngineFactory::setCheckDestinationFolder()
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the value have changed");
+    optionsValue.checkDestinationFolder=ui->checkBoxDestinationFolderExists->isChecked();
     if(optionsEngine!=NULL)
         optionsEngine->setOptionValue(QStringLiteral("checkDestinationFolder"),ui->checkBoxDestinationFolderExists->isChecked());
 }
@@ -408,8 +496,24 @@ void CopyEngineFactory::setCheckDestinationFolder()
 void CopyEngineFactory::newLanguageLoaded()
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"start, retranslate the widget options");
-    OptionInterface * optionsEngine=this->optionsEngine;
-    this->optionsEngine=NULL;
+    //the widget not created will be translated at the creation
+    if(ui!=NULL)
+    {
+        OptionInterface * optionsEngine=this->optionsEngine;
+        this->optionsEngine=NULL;
+        retranslateOptionsWidget();
+        if(optionsEngine!=NULL)
+        {
+            filters->newLanguageLoaded();
+            renamingRules->newLanguageLoaded();
+        }
+        this->optionsEngine=optionsEngine;
+    }
+    emit reloadLanguage();
+}
+
+void CopyEngineFactory::retranslateOptionsWidget()
+{
     ui->retranslateUi(tempWidget);
     ui->comboBoxFolderError->setItemText(0,tr("Ask"));
     ui->comboBoxFolderError->setItemText(1,tr("Skip"));
@@ -434,18 +538,12 @@ void CopyEngineFactory::newLanguageLoaded()
     ui->transferAlgorithm->setItemText(0,tr("Automatic"));
     ui->transferAlgorithm->setItemText(1,tr("Sequential"));
     ui->transferAlgorithm->setItemText(2,tr("Parallel"));
-    if(optionsEngine!=NULL)
-    {
-        filters->newLanguageLoaded();
-        renamingRules->newLanguageLoaded();
-    }
-    emit reloadLanguage();
-    this->optionsEngine=optionsEngine;
 }
 
 void CopyEngineFactory::doChecksum_toggled(bool doChecksum)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the value have changed");
+    optionsValue.doChecksum=doChecksum;
     if(optionsEngine!=NULL)
         optionsEngine->setOptionValue(QStringLiteral("doChecksum"),doChecksum);
 }
@@ -453,6 +551,7 @@ void CopyEngineFactory::doChecksum_toggled(bool doChecksum)
 void CopyEngineFactory::checksumOnlyOnError_toggled(bool checksumOnlyOnError)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the value have changed");
+    optionsValue.checksumOnlyOnError=checksumOnlyOnError;
     if(optionsEngine!=NULL)
         optionsEngine->setOptionValue(QStringLiteral("checksumOnlyOnError"),checksumOnlyOnError);
 }
@@ -460,6 +559,7 @@ void CopyEngineFactory::checksumOnlyOnError_toggled(bool checksumOnlyOnError)
 void CopyEngineFactory::osBuffer_toggled(bool osBuffer)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the value have changed");
+    optionsValue.osBuffer=osBuffer;
     if(optionsEngine!=NULL)
         optionsEngine->setOptionValue(QStringLiteral("osBuffer"),osBuffer);
     ui->osBufferLimit->setEnabled(ui->osBuffer->isChecked() && ui->osBufferLimited->isChecked());
@@ -468,6 +568,7 @@ void CopyEngineFactory::osBuffer_toggled(bool osBuffer)
 void CopyEngineFactory::osBufferLimited_toggled(bool osBufferLimited)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the value have changed");
+    optionsValue.osBufferLimited=osBufferLimited;
     if(optionsEngine!=NULL)
         optionsEngine->setOptionValue(QStringLiteral("osBufferLimited"),osBufferLimited);
     ui->osBufferLimit->setEnabled(ui->osBuffer->isChecked() && ui->osBufferLimited->isChecked());
@@ -476,6 +577,7 @@ void CopyEngineFactory::osBufferLimited_toggled(bool osBufferLimited)
 void CopyEngineFactory::osBufferLimit_editingFinished()
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the spinbox have changed");
+    optionsValue.osBufferLimit=ui->osBufferLimit->value();
     if(optionsEngine!=NULL)
         optionsEngine->setOptionValue(QStringLiteral("osBufferLimit"),ui->osBufferLimit->value());
 }
@@ -539,6 +641,7 @@ void CopyEngineFactory::updateBufferCheckbox()
 void CopyEngineFactory::checksumIgnoreIfImpossible_toggled(bool checksumIgnoreIfImpossible)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the value have changed");
+    optionsValue.checksumIgnoreIfImpossible=checksumIgnoreIfImpossible;
     if(optionsEngine!=NULL)
         optionsEngine->setOptionValue(QStringLiteral("checksumIgnoreIfImpossible"),checksumIgnoreIfImpossible);
 }
@@ -557,6 +660,7 @@ void CopyEngineFactory::setFileCollision(int index)
         case 4:
         case 5:
         case 6:
+            optionsValue.fileCollision=index;
             optionsEngine->setOptionValue(QStringLiteral("fileCollision"),index);
         break;
         default:
@@ -575,6 +679,7 @@ void CopyEngineFactory::setFileError(int index)
         case 0:
         case 1:
         case 2:
+            optionsValue.fileError=index;
             optionsEngine->setOptionValue(QStringLiteral("fileError"),index);
         break;
         default:
@@ -598,6 +703,7 @@ void CopyEngineFactory::updatedBlockSize()
 void CopyEngineFactory::deletePartiallyTransferredFiles(bool checked)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the value have changed");
+    optionsValue.deletePartiallyTransferredFiles=checked;
     if(optionsEngine!=NULL)
         optionsEngine->setOptionValue(QStringLiteral("deletePartiallyTransferredFiles"),checked);
 }
@@ -605,6 +711,7 @@ void CopyEngineFactory::deletePartiallyTransferredFiles(bool checked)
 void CopyEngineFactory::renameTheOriginalDestination(bool checked)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the value have changed");
+    optionsValue.renameTheOriginalDestination=checked;
     if(optionsEngine!=NULL)
         optionsEngine->setOptionValue(QStringLiteral("renameTheOriginalDestination"),checked);
 }
@@ -612,6 +719,7 @@ void CopyEngineFactory::renameTheOriginalDestination(bool checked)
 void CopyEngineFactory::checkDiskSpace(bool checked)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the value have changed");
+    optionsValue.checkDiskSpace=checked;
     if(optionsEngine!=NULL)
         optionsEngine->setOptionValue(QStringLiteral("checkDiskSpace"),checked);
 }
@@ -626,6 +734,7 @@ void CopyEngineFactory::defaultDestinationFolderBrowse()
     }
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the value have changed");
     ui->defaultDestinationFolder->setText(destination);
+    optionsValue.defaultDestinationFolder=destination;
     if(optionsEngine!=NULL)
         optionsEngine->setOptionValue(QStringLiteral("defaultDestinationFolder"),destination);
 }
@@ -633,6 +742,7 @@ void CopyEngineFactory::defaultDestinationFolderBrowse()
 void CopyEngineFactory::defaultDestinationFolder()
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the value have changed");
+    optionsValue.defaultDestinationFolder=ui->defaultDestinationFolder->text();
     if(optionsEngine!=NULL)
         optionsEngine->setOptionValue(QStringLiteral("defaultDestinationFolder"),ui->defaultDestinationFolder->text());
 }
@@ -640,6 +750,7 @@ void CopyEngineFactory::defaultDestinationFolder()
 void CopyEngineFactory::followTheStrictOrder(bool checked)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the value have changed");
+    optionsValue.followTheStrictOrder=checked;
     if(optionsEngine!=NULL)
         optionsEngine->setOptionValue(QStringLiteral("followTheStrictOrder"),checked);
 }
@@ -647,6 +758,7 @@ void CopyEngineFactory::followTheStrictOrder(bool checked)
 void CopyEngineFactory::moveTheWholeFolder(bool checked)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the value have changed");
+    optionsValue.moveTheWholeFolder=checked;
     if(optionsEngine!=NULL)
         optionsEngine->setOptionValue(QStringLiteral("moveTheWholeFolder"),checked);
 }
@@ -654,6 +766,7 @@ void CopyEngineFactory::moveTheWholeFolder(bool checked)
 void CopyEngineFactory::on_inodeThreads_editingFinished()
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the spinbox have changed");
+    optionsValue.inodeThreads=ui->inodeThreads->value();
     if(optionsEngine!=NULL)
         optionsEngine->setOptionValue(QStringLiteral("inodeThreads"),ui->inodeThreads->value());
 }
@@ -681,6 +794,7 @@ size_t CopyEngineFactory::getTotalSystemMemory()
 void CopyEngineFactory::setRsync(bool rsync)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the value have changed");
+    optionsValue.rsync=rsync;
     if(optionsEngine!=NULL)
         optionsEngine->setOptionValue("rsync",rsync);
 }
@@ -689,6 +803,15 @@ void CopyEngineFactory::setRsync(bool rsync)
 void CopyEngineFactory::copyListOrder(bool checked)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the value have changed");
+    optionsValue.copyListOrder=checked;
     if(optionsEngine!=NULL)
         optionsEngine->setOptionValue(QStringLiteral("copyListOrder"),checked);
 }
+
+void CopyEngineFactory::physicalOrder(bool checked)
+{
+    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"the value have changed");
+    optionsValue.physicalOrder=checked;
+    if(optionsEngine!=NULL)
+        optionsEngine->setOptionValue(QStringLiteral("physicalOrder"),checked);
+}
@@ -68,6 +68,41 @@ public:
     QWidget * options();
 
 private:
+    /// \brief the options values, the instances are created from it without the widgets
+    struct OptionsValue
+    {
+        bool doRightTransfer;
+        bool keepDate;
+        int blockSize;
+        int sequentialBuffer;
+        int parallelBuffer;
+        int parallelizeIfSmallerThan;
+        bool autoStart;
+        bool rsync;
+        int folderError;
+        int folderCollision;
+        int fileError;
+        int fileCollision;
+        int transferAlgorithm;
+        bool checkDestinationFolder;
+        bool doChecksum;
+        bool checksumIgnoreIfImpossible;
+        bool checksumOnlyOnError;
+        bool osBuffer;
+        bool osBufferLimited;
+        int osBufferLimit;
+        bool deletePartiallyTransferredFiles;
+        bool moveTheWholeFolder;
+        bool followTheStrictOrder;
+        bool renameTheOriginalDestination;
+        bool checkDiskSpace;
+        QString defaultDestinationFolder;
+        int inodeThreads;
+        bool copyListOrder;
+        bool physicalOrder;
+    };
+    OptionsValue optionsValue;
+    /// \brief NULL until the options are displayed the first time
     Ui::copyEngineOptions *ui;
     QWidget* tempWidget;
     OptionInterface * optionsEngine;
@@ -83,6 +118,11 @@ private:
 #if defined(Q_OS_WIN32) || (defined(Q_OS_LINUX) && defined(_SC_PHYS_PAGES))
     static size_t getTotalSystemMemory();
 #endif
+    /// \brief create the options widget and set it with the options value
+    void createOptionsWidget();
+    void retranslateOptionsWidget();
+    /// \brief round the buffer to a multiple of the block size, into the limits of the spinbox
+    int bufferToBlockSize(const int &buffer,const int &maxNumberOfBlock) const;
 private slots:
     void init();
     void setDoRightTransfer(bool doRightTransfer);
@@ -122,6 +162,7 @@ private slots:
     void moveTheWholeFolder(bool checked);
     void on_inodeThreads_editingFinished();
     void copyListOrder(bool checked);
+    void physicalOrder(bool checked);
 public slots:
     void resetOptions();
     void newLanguageLoaded();
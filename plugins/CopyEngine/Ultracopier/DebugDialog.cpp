@@ -14,6 +14,7 @@ DebugDialog::DebugDialog(QWidget *parent) :
     ui(new Ui::debugDialog)
 {
     ui->setupUi(this);
+    connect(ui->dumpLatency,&QPushButton::clicked,this,&DebugDialog::dumpLatency);
 }
 
 DebugDialog::~DebugDialog()
@@ -30,6 +30,9 @@ public:
     void setActiveTransfer(const int &activeTransfer);
     /// \brief show many many inode is manipulated
     void setInodeUsage(const int &inodeUsage);
+signals:
+    /// \brief the user ask to dump the latency histograms
+    void dumpLatency() const;
 private:
     Ui::debugDialog *ui;
 };
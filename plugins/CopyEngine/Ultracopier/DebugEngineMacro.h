@@ -10,12 +10,17 @@
 #	define __func__ __FUNCTION__
 #endif
 
-/// \brief Macro for the debug log
+/// \brief Macro for the debug log, the text is evaluated only if the level is compiled
 #ifdef ULTRACOPIER_PLUGIN_DEBUG
+	#ifdef ULTRACOPIER_PLUGIN_DEBUG_NOTICE
+		#define ULTRACOPIER_PLUGIN_DEBUG_LEVEL_ENABLED(a) true
+	#else
+		#define ULTRACOPIER_PLUGIN_DEBUG_LEVEL_ENABLED(a) ((a)!=Ultracopier::DebugLevel_Notice)
+	#endif
 	#if defined (__FILE__) && defined (__LINE__)
-		#define ULTRACOPIER_DEBUGCONSOLE(a,b) emit debugInformation(a,__func__,b,__FILE__,__LINE__)
+		#define ULTRACOPIER_DEBUGCONSOLE(a,b) (ULTRACOPIER_PLUGIN_DEBUG_LEVEL_ENABLED(a)?emit debugInformation(a,__func__,b,__FILE__,__LINE__):void())
 	#else
-		#define ULTRACOPIER_DEBUGCONSOLE(a,b) emit debugInformation(a,__func__,b)
+		#define ULTRACOPIER_DEBUGCONSOLE(a,b) (ULTRACOPIER_PLUGIN_DEBUG_LEVEL_ENABLED(a)?emit debugInformation(a,__func__,b):void())
 	#endif
 #else // ULTRACOPIER_PLUGIN_DEBUG
 	#define ULTRACOPIER_DEBUGCONSOLE(a,b) void()
@@ -0,0 +1,303 @@
+#include "DestinationFolderCache.h"
+
+#include <QDir>
+#include <QMutexLocker>
+#include <QFile>
+#include <QFileInfo>
+#include <QRegularExpression>
+
+#ifdef Q_OS_UNIX
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+DestinationFolderCache::DestinationFolderCache()
+{
+}
+
+bool DestinationFolderCache::split(const QString &path,QString &folder,QString &name)
+{
+    const QString &cleanPath=QDir::cleanPath(QDir::fromNativeSeparators(path));
+    const int index=cleanPath.lastIndexOf(QLatin1Char('/'));
+    if(index<0 || index==(cleanPath.size()-1))
+        return false;
+    name=cleanPath.mid(index+1);
+    if(index==0)
+        folder=QStringLiteral("/");
+    else
+    {
+        folder=cleanPath.left(index);
+        //C: is the current folder of the drive C, not the root
+        if(folder.endsWith(QLatin1Char(':')))
+            folder+=QLatin1Char('/');
+    }
+    return true;
+}
+
+bool DestinationFolderCache::existsOnDisk(const QString &folder,const QString &name)
+{
+    QString path=folder;
+    if(!path.endsWith(QLatin1Char('/')))
+        path+=QLatin1Char('/');
+    path+=name;
+    #ifdef Q_OS_UNIX
+    struct stat info;
+    return lstat(QFile::encodeName(path).constData(),&info)==0;
+    #else
+    const QFileInfo fileInfo(path);
+    return fileInfo.exists() || fileInfo.isSymLink();
+    #endif
+}
+
+QString DestinationFolderCache::entryKey(const QString &name,const bool &caseInsensitive)
+{
+    if(caseInsensitive)
+        return name.toCaseFolded();
+    return name;
+}
+
+bool DestinationFolderCache::isCaseInsensitive(const QString &folder,const QStringList &entryList)
+{
+    #ifdef Q_OS_WIN32
+    Q_UNUSED(folder);
+    Q_UNUSED(entryList);
+    return true;
+    #else
+    #ifdef _PC_CASE_SENSITIVE
+    const long caseSensitive=pathconf(QFile::encodeName(folder).constData(),_PC_CASE_SENSITIVE);
+    if(caseSensitive==0)
+        return true;
+    if(caseSensitive==1)
+        return false;
+    #endif
+    //the first name with a case: an entry of the folder, else the folder itself or its first existing parent
+    QString probeFolder,probeName;
+    int index=0;
+    while(index<entryList.size())
+    {
+        if(entryList.at(index).toUpper()!=entryList.at(index).toLower())
+        {
+            probeFolder=folder;
+            probeName=entryList.at(index);
+            break;
+        }
+        index++;
+    }
+    QString current=folder;
+    while(true)
+    {
+        if(probeName.isEmpty())
+        {
+            QString parent,name;
+            if(!split(current,parent,name))
+                return false;
+            current=parent;
+            if(name.toUpper()==name.toLower())
+                continue;
+            probeFolder=parent;
+            probeName=name;
+        }
+        QString otherName=probeName.toUpper();
+        if(otherName==probeName)
+            otherName=probeName.toLower();
+        if(!probeFolder.endsWith(QLatin1Char('/')))
+            probeFolder+=QLatin1Char('/');
+        struct stat info,otherInfo;
+        if(lstat(QFile::encodeName(probeFolder+probeName).constData(),&info)==0)
+        {
+            if(lstat(QFile::encodeName(probeFolder+otherName).constData(),&otherInfo)!=0)
+                return false;
+            return info.st_dev==otherInfo.st_dev && info.st_ino==otherInfo.st_ino;
+        }
+        probeName.clear();
+    }
+    #endif
+}
+
+DestinationFolderCache::Folder &DestinationFolderCache::listFolder(const QString &folder)
+{
+    QHash<QString,Folder>::iterator i=folderList.find(folder);
+    if(i!=folderList.end())
+        return i.value();
+    Folder newFolder;
+    QDir dir(folder);
+    newFolder.exists=dir.exists();
+    QStringList entryList;
+    if(newFolder.exists)
+        entryList=dir.entryList(QDir::AllEntries|QDir::NoDotAndDotDot|QDir::Hidden|QDir::System);
+    newFolder.caseInsensitive=isCaseInsensitive(folder,entryList);
+    newFolder.entries.reserve(entryList.size());
+    int index=0;
+    const int loop_size=entryList.size();
+    while(index<loop_size)
+    {
+        newFolder.entries.insert(entryKey(entryList.at(index),newFolder.caseInsensitive));
+        index++;
+    }
+    return folderList.insert(folder,newFolder).value();
+}
+
+bool DestinationFolderCache::exists(const QString &path)
+{
+    QString folder,name;
+    if(!split(path,folder,name))
+        return QFileInfo(path).exists();
+    QMutexLocker lock(&mutex);
+    const Folder &parent=listFolder(folder);
+    if(!parent.exists)
+        return false;
+    return parent.entries.contains(entryKey(name,parent.caseInsensitive));
+}
+
+bool DestinationFolderCache::folderExists(const QString &folder)
+{
+    QMutexLocker lock(&mutex);
+    return listFolder(QDir::cleanPath(QDir::fromNativeSeparators(folder))).exists;
+}
+
+QSet<QString> DestinationFolderCache::entries(const QString &folder)
+{
+    QMutexLocker lock(&mutex);
+    return listFolder(QDir::cleanPath(QDir::fromNativeSeparators(folder))).entries;
+}
+
+void DestinationFolderCache::add(const QString &path)
+{
+    QString current=QDir::cleanPath(QDir::fromNativeSeparators(path));
+    QString folder,name;
+    QMutexLocker lock(&mutex);
+    //if previously listed as not existing, list it again at the next access
+    folderList.remove(current);
+    //mkpath can have created the parent folders too
+    while(split(current,folder,name))
+    {
+        QHash<QString,Folder>::iterator i=folderList.find(folder);
+        if(i!=folderList.end())
+        {
+            i.value().entries.insert(entryKey(name,i.value().caseInsensitive));
+            if(i.value().exists)
+                return;
+            i.value().exists=true;
+        }
+        current=folder;
+    }
+}
+
+void DestinationFolderCache::addTree(const QString &folder)
+{
+    add(folder);
+    const QString &prefix=QDir::cleanPath(QDir::fromNativeSeparators(folder))+QLatin1Char('/');
+    QMutexLocker lock(&mutex);
+    QHash<QString,Folder>::iterator i=folderList.begin();
+    while(i!=folderList.end())
+    {
+        if(i.key().startsWith(prefix))
+            i=folderList.erase(i);
+        else
+            ++i;
+    }
+}
+
+void DestinationFolderCache::remove(const QString &path)
+{
+    QString folder,name;
+    if(!split(path,folder,name))
+        return;
+    QMutexLocker lock(&mutex);
+    folderList.remove(QDir::cleanPath(QDir::fromNativeSeparators(path)));
+    QHash<QString,Folder>::iterator i=folderList.find(folder);
+    if(i!=folderList.end())
+        i.value().entries.remove(entryKey(name,i.value().caseInsensitive));
+}
+
+void DestinationFolderCache::rename(const QString &oldPath,const QString &newPath)
+{
+    remove(oldPath);
+    add(newPath);
+}
+
+QString DestinationFolderCache::reserveFreeName(const QString &folder,const QString &firstName,const QString &otherName)
+{
+    const QString &cleanFolder=QDir::cleanPath(QDir::fromNativeSeparators(folder));
+    QMutexLocker lock(&mutex);
+    Folder &parent=listFolder(cleanFolder);
+    QSet<QString> &reserved=reservedList[cleanFolder];
+    const QString &firstKey=entryKey(firstName,parent.caseInsensitive);
+    if(!parent.entries.contains(firstKey) && !reserved.contains(firstKey))
+    {
+        if(!existsOnDisk(cleanFolder,firstName))
+        {
+            reserved.insert(firstKey);
+            return firstName;
+        }
+        //created out of the engine since the listing
+        parent.entries.insert(firstKey);
+    }
+    //extract the used numbers from the listing
+    const QString &otherKey=entryKey(otherName,parent.caseInsensitive);
+    const int numberIndex=otherKey.indexOf(QStringLiteral("%number%"));
+    if(numberIndex<0)
+    {
+        reserved.insert(otherKey);
+        return otherName;
+    }
+    const QRegularExpression numberRegex(QStringLiteral("^")+
+                                         QRegularExpression::escape(otherKey.left(numberIndex))+
+                                         QStringLiteral("([0-9]{1,9})")+
+                                         QRegularExpression::escape(otherKey.mid(numberIndex+8))+
+                                         QStringLiteral("$"));
+    QSet<int> usedNumbers;
+    QSet<QString>::const_iterator i=parent.entries.constBegin();
+    while(i!=parent.entries.constEnd())
+    {
+        const QRegularExpressionMatch &match=numberRegex.match(*i);
+        if(match.hasMatch())
+            usedNumbers.insert(match.captured(1).toInt());
+        ++i;
+    }
+    i=reserved.constBegin();
+    while(i!=reserved.constEnd())
+    {
+        const QRegularExpressionMatch &match=numberRegex.match(*i);
+        if(match.hasMatch())
+            usedNumbers.insert(match.captured(1).toInt());
+        ++i;
+    }
+    int num=2;
+    QString newName;
+    while(true)
+    {
+        if(!usedNumbers.contains(num))
+        {
+            newName=otherName;
+            newName.replace(QStringLiteral("%number%"),QString::number(num));
+            if(!existsOnDisk(cleanFolder,newName))
+                break;
+            parent.entries.insert(entryKey(newName,parent.caseInsensitive));
+        }
+        num++;
+    }
+    reserved.insert(entryKey(newName,parent.caseInsensitive));
+    return newName;
+}
+
+void DestinationFolderCache::release(const QString &path)
+{
+    QString folder,name;
+    if(!split(path,folder,name))
+        return;
+    QMutexLocker lock(&mutex);
+    QHash<QString,QSet<QString> >::iterator i=reservedList.find(folder);
+    if(i==reservedList.end())
+        return;
+    i.value().remove(entryKey(name,listFolder(folder).caseInsensitive));
+    if(i.value().isEmpty())
+        reservedList.erase(i);
+}
+
+void DestinationFolderCache::clear()
+{
+    QMutexLocker lock(&mutex);
+    folderList.clear();
+    reservedList.clear();
+}
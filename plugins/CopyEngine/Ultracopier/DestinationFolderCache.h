@@ -0,0 +1,71 @@
+/** \file DestinationFolderCache.h
+\brief Cache of the destination folder listing, to answer if the destination exists without file system access for each file
+\author alpha_one_x86
+\licence GPL3, see the file COPYING */
+
+#ifndef DESTINATIONFOLDERCACHE_H
+#define DESTINATIONFOLDERCACHE_H
+
+#include <QString>
+#include <QStringList>
+#include <QHash>
+#include <QSet>
+#include <QMutex>
+
+/** \brief Cache of the destination folder listing, shared by the threads of one copy engine
+ * Each folder is listed one time at the first access, the engine need call add() when it create an entry.
+ * The entry found are still to be checked on the file system (the cache can be outdated when the engine remove an entry),
+ * but the entry not found are not checked. */
+class DestinationFolderCache
+{
+public:
+    explicit DestinationFolderCache();
+    /// \brief return true if the file or folder exists, list the parent folder if not into the cache
+    bool exists(const QString &path);
+    /// \brief return true if the folder exists, list the folder if not into the cache
+    bool folderExists(const QString &folder);
+    /// \brief return the entries of the folder, list the folder if not into the cache
+    QSet<QString> entries(const QString &folder);
+    /// \brief the engine have created this file or folder
+    void add(const QString &path);
+    /// \brief the engine have moved a folder with its content here, drop the listing of this tree
+    void addTree(const QString &folder);
+    /// \brief the engine have removed this file or folder
+    void remove(const QString &path);
+    /// \brief the engine have renamed this file or folder
+    void rename(const QString &oldPath,const QString &newPath);
+    /** \brief return and reserve the first free name into the folder
+     * \param firstName the name to try first
+     * \param otherName the name to use next, where %number% is replaced by 2, 3, ...
+     * The used numbers are found with one pass on the folder listing, the reserved names are kept in memory
+     * to not give the same name to two transfers before the file is created, until release().
+     * The name is checked with lstat() before be returned, the listing can be outdated */
+    QString reserveFreeName(const QString &folder,const QString &firstName,const QString &otherName);
+    /// \brief the transfer which have reserved this name is finished, the name is into the listing if created
+    void release(const QString &path);
+    /// \brief drop all the listing
+    void clear();
+    /// \brief return the key used for the entry name, case folded on a case insensitive file system
+    static QString entryKey(const QString &name,const bool &caseInsensitive);
+private:
+    struct Folder
+    {
+        bool exists;
+        bool caseInsensitive;///< a.txt and A.TXT are the same entry
+        QSet<QString> entries;
+    };
+    QHash<QString,Folder> folderList;
+    //the names given by reserveFreeName(), by folder, kept when the folder is listed again
+    QHash<QString,QSet<QString> > reservedList;
+    QMutex mutex;
+    //need be called with the mutex locked
+    Folder &listFolder(const QString &folder);
+    static bool split(const QString &path,QString &folder,QString &name);
+    //check on the file system, without follow the symlink
+    static bool existsOnDisk(const QString &folder,const QString &name);
+    /* always on windows, else ask pathconf() if supported, else check if the name with an other case is the same inode,
+     * on an entry of the folder or on the folder itself or its first existing parent */
+    static bool isCaseInsensitive(const QString &folder,const QStringList &entryList);
+};
+
+#endif // DESTINATIONFOLDERCACHE_H
@@ -3,6 +3,20 @@
 #include <QDir>
 #include <QFileInfoList>
 #include <QStorageInfo>
+#include <QFile>
+#include <QSet>
+
+#ifdef Q_OS_LINUX
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
+#include <sys/ioctl.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <linux/fs.h>
+#include <linux/fiemap.h>
+#include <string.h>
+#endif
 
 DriveManagement::DriveManagement()
 {
@@ -19,12 +33,9 @@ DriveManagement::DriveManagement()
 //get drive of an file or folder
 QString DriveManagement::getDrive(const QString &fileOrFolder) const
 {
-    const QString &inode=QDir::toNativeSeparators(fileOrFolder);
-    int size=mountSysPoint.size();
-    for (int i = 0; i < size; ++i) {
-        if(inode.startsWith(mountSysPoint.at(i)))
-            return QDir::toNativeSeparators(mountSysPoint.at(i));
-    }
+    const int index=findMount(QDir::toNativeSeparators(fileOrFolder));
+    if(index!=-1)
+        return mountSysPoint.at(index);
     #ifdef Q_OS_WIN32
     if(fileOrFolder.contains(reg1))
     {
@@ -45,14 +56,144 @@ QString DriveManagement::getDrive(const QString &fileOrFolder) const
     return QString();
 }
 
+QString DriveManagement::getDrive(const QString &fileOrFolder,const quint64 &device) const
+{
+    //the bind mounts have the same device, then only the path can say which mount point it is
+    QHash<quint64,int>::const_iterator i=deviceMount.constFind(device);
+    if(i!=deviceMount.constEnd())
+        return mountSysPoint.at(i.value());
+    return getDrive(fileOrFolder);
+}
+
+int DriveManagement::findMount(const QString &inode) const
+{
+    const QChar separator=QDir::separator();
+    const int size=inode.size();
+    int found=-1;
+    int node=0;
+    int index=0;
+    while(true)
+    {
+        const MountNode &currentNode=mountTrie.at(node);
+        //only on full folder name: /mnt/a don't contains /mnt/ab
+        if(currentNode.mount!=-1 && (index==size || inode.at(index)==separator || (index>0 && inode.at(index-1)==separator)))
+            found=currentNode.mount;
+        if(index>=size)
+            break;
+        QHash<ushort,int>::const_iterator i=currentNode.children.constFind(inode.at(index).unicode());
+        if(i==currentNode.children.constEnd())
+            break;
+        node=i.value();
+        index++;
+    }
+    return found;
+}
+
+void DriveManagement::addMount(const QString &mountPoint,const int &index)
+{
+    int node=0;
+    int charIndex=0;
+    while(charIndex<mountPoint.size())
+    {
+        const ushort c=mountPoint.at(charIndex).unicode();
+        const int next=mountTrie.at(node).children.value(c,-1);
+        if(next!=-1)
+            node=next;
+        else
+        {
+            MountNode newNode;
+            newNode.mount=-1;
+            mountTrie << newNode;
+            mountTrie[node].children[c]=mountTrie.size()-1;
+            node=mountTrie.size()-1;
+        }
+        charIndex++;
+    }
+    //keep the first like getDriveType() and isRotational()
+    if(mountTrie.at(node).mount==-1)
+        mountTrie[node].mount=index;
+    if(!mountIndex.contains(mountPoint))
+        mountIndex[mountPoint]=index;
+}
+
 QByteArray DriveManagement::getDriveType(const QString &drive) const
 {
-    int index=mountSysPoint.indexOf(drive);
+    const int index=mountIndex.value(drive,-1);
     if(index!=-1)
         return driveType.at(index);
     return QByteArray();
 }
 
+bool DriveManagement::isRotational(const QString &drive) const
+{
+    const int index=mountIndex.value(drive,-1);
+    if(index!=-1)
+        return driveRotational.at(index);
+    return false;
+}
+
+quint64 DriveManagement::getPhysicalOffset(const QString &file)
+{
+    quint64 offset=0xFFFFFFFFFFFFFFFFULL;
+    #ifdef Q_OS_LINUX
+    const QByteArray &path=QFile::encodeName(file);
+    //only the regular file: open() block on a fifo and follow the symlink
+    struct stat info;
+    if(::lstat(path.constData(),&info)!=0 || !S_ISREG(info.st_mode))
+        return offset;
+    const int fd=::open(path.constData(),O_RDONLY|O_NONBLOCK|O_NOFOLLOW);
+    if(fd<0)
+        return offset;
+    //replaced between the lstat() and the open()
+    if(::fstat(fd,&info)!=0 || !S_ISREG(info.st_mode))
+    {
+        ::close(fd);
+        return offset;
+    }
+    //FIEMAP ask only the first extent, without sync to not flush the cache
+    quint64 buffer[(sizeof(struct fiemap)+sizeof(struct fiemap_extent))/sizeof(quint64)+1];
+    memset(buffer,0,sizeof(buffer));
+    struct fiemap *map=reinterpret_cast<struct fiemap *>(buffer);
+    map->fm_start=0;
+    map->fm_length=FIEMAP_MAX_OFFSET;
+    map->fm_flags=0;
+    map->fm_extent_count=1;
+    if(ioctl(fd,FS_IOC_FIEMAP,map)==0)
+    {
+        if(map->fm_mapped_extents>0)
+            offset=map->fm_extents[0].fe_physical;
+    }
+    else
+    {
+        //old file system without FIEMAP, FIBMAP need CAP_SYS_RAWIO
+        int block=0;
+        int blockSize=0;
+        if(ioctl(fd,FIBMAP,&block)==0 && block>0 && ioctl(fd,FIGETBSZ,&blockSize)==0)
+            offset=(quint64)block*blockSize;
+    }
+    ::close(fd);
+    #else
+    Q_UNUSED(file);
+    #endif
+    return offset;
+}
+
+#ifdef Q_OS_LINUX
+bool DriveManagement::readRotational(const quint64 &device)
+{
+    const QString &sysPath=QStringLiteral("/sys/dev/block/%1:%2").arg(major(device)).arg(minor(device));
+    //the partition have not queue, it's on the parent block device
+    QFile rotational(sysPath+QStringLiteral("/queue/rotational"));
+    if(!rotational.exists())
+        rotational.setFileName(sysPath+QStringLiteral("/../queue/rotational"));
+    if(!rotational.open(QIODevice::ReadOnly))
+        return false;
+    const bool returnValue=(rotational.readAll().trimmed()=="1");
+    rotational.close();
+    return returnValue;
+}
+#endif
+
 bool DriveManagement::isSameDrive(const QString &file1,const QString &file2) const
 {
     if(mountSysPoint.size()==0)
@@ -83,6 +224,15 @@ void DriveManagement::tryUpdate()
 {
     mountSysPoint.clear();
     driveType.clear();
+    driveRotational.clear();
+    mountTrie.clear();
+    mountIndex.clear();
+    deviceMount.clear();
+    MountNode root;
+    root.mount=-1;
+    mountTrie << root;
+    //the device with more than one mount point (bind mount) can't be resolved by st_dev
+    QSet<quint64> sharedDevice;
     const QList<QStorageInfo> mountedVolumesList=QStorageInfo::mountedVolumes();
     int index=0;
     while(index<mountedVolumesList.size())
@@ -97,6 +247,30 @@ void DriveManagement::tryUpdate()
         #else
         driveType << mountedVolumesList.at(index).fileSystemType();
         #endif
+        addMount(mountSysPoint.last(),index);
+        #ifdef Q_OS_LINUX
+        //only local block device, stat() on network mount point can block
+        struct stat info;
+        if(mountedVolumesList.at(index).device().startsWith("/dev/") && stat(QFile::encodeName(mountedVolumesList.at(index).rootPath()).constData(),&info)==0)
+        {
+            const quint64 device=info.st_dev;
+            driveRotational << readRotational(device);
+            if(deviceMount.contains(device))
+                sharedDevice << device;
+            else
+                deviceMount[device]=index;
+        }
+        else
+            driveRotational << false;
+        #else
+        driveRotational << false;
+        #endif
         index++;
     }
+    QSet<quint64>::const_iterator i=sharedDevice.constBegin();
+    while(i!=sharedDevice.constEnd())
+    {
+        deviceMount.remove(*i);
+        ++i;
+    }
 }
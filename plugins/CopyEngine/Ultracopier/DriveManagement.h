@@ -7,6 +7,8 @@
 #include <QRegularExpression>
 #include <QStorageInfo>
 #include <QTimer>
+#include <QHash>
+#include <QVector>
 
 #include "Environment.h"
 
@@ -18,11 +20,33 @@ public:
     bool isSameDrive(const QString &file1,const QString &file2) const;
     /// \brief get drive of an file or folder
     QString getDrive(const QString &fileOrFolder) const;
+    /// \brief get drive of an file or folder with the st_dev of its stat, without compare the path if the device have only one mount point
+    QString getDrive(const QString &fileOrFolder,const quint64 &device) const;
     QByteArray getDriveType(const QString &drive) const;
+    /// \brief return true if the drive is on rotational disk (HDD), false if unknown
+    bool isRotational(const QString &drive) const;
+    /// \brief get the physical offset on the disk of the first block of the file, max value if unknown
+    static quint64 getPhysicalOffset(const QString &file);
     void tryUpdate();
 protected:
     QStringList		mountSysPoint;
     QList<QByteArray> driveType;
+    QList<bool>     driveRotational;
+    /// \brief node of the trie on the mount point path, one char by level
+    struct MountNode
+    {
+        QHash<ushort,int> children;///< char to index into mountTrie
+        int mount;///< index into mountSysPoint, -1 if no mount point end here
+    };
+    QVector<MountNode> mountTrie;///< the first node is the root
+    QHash<QString,int> mountIndex;///< mount point to index into mountSysPoint
+    QHash<quint64,int> deviceMount;///< st_dev to index into mountSysPoint, only the device with one mount point
+    /// \brief return the index of the longest mount point which contains the path, -1 if not found
+    int findMount(const QString &inode) const;
+    void addMount(const QString &mountPoint,const int &index);
+    #ifdef Q_OS_LINUX
+    static bool readRotational(const quint64 &device);
+    #endif
     #ifdef Q_OS_WIN32
     QRegularExpression reg1,reg2,reg3,reg4;
     #endif
@@ -0,0 +1,49 @@
+#include "FolderTable.h"
+
+FolderTable::FolderTable()
+{
+    lastId=0;
+}
+
+quint32 FolderTable::add(const QString &folder)
+{
+    if(!folderList.isEmpty() && folderList.at(lastId)==folder)
+        return lastId;
+    QHash<QString,quint32>::const_iterator i=folderIndex.constFind(folder);
+    if(i!=folderIndex.constEnd())
+    {
+        lastId=i.value();
+        return lastId;
+    }
+    lastId=folderList.size();
+    folderList << folder;
+    //the key share the string data with the list
+    folderIndex.insert(folderList.last(),lastId);
+    return lastId;
+}
+
+const QString &FolderTable::folder(const quint32 &id) const
+{
+    return folderList.at(id);
+}
+
+QString FolderTable::filePath(const quint32 &id,const QString &name) const
+{
+    const QString &folder=folderList.at(id);
+    //the root folder already have the separator: "/" or "C:/"
+    if(folder.endsWith(QLatin1Char('/')))
+        return folder+name;
+    return folder+QLatin1Char('/')+name;
+}
+
+int FolderTable::size() const
+{
+    return folderList.size();
+}
+
+void FolderTable::clear()
+{
+    folderList.clear();
+    folderIndex.clear();
+    lastId=0;
+}
@@ -0,0 +1,34 @@
+/** \file FolderTable.h
+\brief Interned folder path, to store the queued transfer as folder id + file name
+\author alpha_one_x86
+\licence GPL3, see the file COPYING */
+
+#ifndef FOLDERTABLE_H
+#define FOLDERTABLE_H
+
+#include <QString>
+#include <QVector>
+#include <QHash>
+
+/** \brief Each folder path is stored only one time, the transfer list keep only the folder id
+ * The files of the same folder are added together by the listing, then the last folder is checked before the hash */
+class FolderTable
+{
+public:
+    explicit FolderTable();
+    /// \brief return the id of the folder, add it if not already into the table
+    quint32 add(const QString &folder);
+    /// \brief return the folder path for this id
+    const QString &folder(const quint32 &id) const;
+    /// \brief return the full path of the file into the folder with this id
+    QString filePath(const quint32 &id,const QString &name) const;
+    int size() const;
+    /// \brief drop all the folder, only when no transfer use them
+    void clear();
+private:
+    QVector<QString> folderList;
+    QHash<QString,quint32> folderIndex;
+    quint32 lastId;
+};
+
+#endif // FOLDERTABLE_H
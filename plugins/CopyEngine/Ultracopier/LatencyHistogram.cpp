@@ -0,0 +1,198 @@
+#include "LatencyHistogram.h"
+
+#include <QMutexLocker>
+#include <QStringList>
+
+LatencyHistogram::LatencyHistogram() :
+    sum(0),
+    maxValue(0)
+{
+}
+
+int LatencyHistogram::bucketOf(const quint64 &value)
+{
+    if(value<LATENCYHISTOGRAM_SUB_COUNT)
+        return value;
+    quint64 clampedValue=value;
+    if(clampedValue>=((quint64)1<<(LATENCYHISTOGRAM_MAX_BIT+1)))
+        clampedValue=((quint64)1<<(LATENCYHISTOGRAM_MAX_BIT+1))-1;
+    //highest bit set
+    int highestBit=0;
+    quint64 temp=clampedValue;
+    while(temp>=65536)
+    {
+        temp>>=16;
+        highestBit+=16;
+    }
+    while(temp>1)
+    {
+        temp>>=1;
+        highestBit++;
+    }
+    const int shift=highestBit-LATENCYHISTOGRAM_SUB_BITS;
+    return (shift+1)*LATENCYHISTOGRAM_SUB_COUNT+(int)(clampedValue>>shift)-LATENCYHISTOGRAM_SUB_COUNT;
+}
+
+quint64 LatencyHistogram::bucketValue(const int &bucket)
+{
+    if(bucket<LATENCYHISTOGRAM_SUB_COUNT)
+        return bucket;
+    const int shift=bucket/LATENCYHISTOGRAM_SUB_COUNT-1;
+    const quint64 lowest=(quint64)(LATENCYHISTOGRAM_SUB_COUNT+bucket%LATENCYHISTOGRAM_SUB_COUNT)<<shift;
+    return lowest+(((quint64)1<<shift)>>1);
+}
+
+void LatencyHistogram::record(const quint64 &microseconds)
+{
+    buckets[bucketOf(microseconds)].fetchAndAddRelaxed(1);
+    sum.fetchAndAddRelaxed(microseconds);
+    quint64 currentMax=maxValue.load();
+    while(microseconds>currentMax)
+    {
+        if(maxValue.testAndSetRelaxed(currentMax,microseconds))
+            break;
+        currentMax=maxValue.load();
+    }
+}
+
+quint64 LatencyHistogram::count() const
+{
+    quint64 count=0;
+    int index=0;
+    while(index<LATENCYHISTOGRAM_BUCKET_COUNT)
+    {
+        count+=buckets[index].load();
+        index++;
+    }
+    return count;
+}
+
+quint64 LatencyHistogram::mean() const
+{
+    const quint64 count=this->count();
+    if(count==0)
+        return 0;
+    return sum.load()/count;
+}
+
+quint64 LatencyHistogram::maximum() const
+{
+    return maxValue.load();
+}
+
+quint64 LatencyHistogram::valueAtPercentile(const double &percentile) const
+{
+    const quint64 count=this->count();
+    if(count==0)
+        return 0;
+    quint64 target=(quint64)(count*percentile/100.0+0.5);
+    if(target<1)
+        target=1;
+    quint64 cumulated=0;
+    int index=0;
+    while(index<LATENCYHISTOGRAM_BUCKET_COUNT)
+    {
+        cumulated+=buckets[index].load();
+        if(cumulated>=target)
+        {
+            //the bucket value can be greater than the real max
+            const quint64 value=bucketValue(index);
+            if(value>maximum())
+                return maximum();
+            return value;
+        }
+        index++;
+    }
+    return maximum();
+}
+
+LatencyStats::LatencyStats()
+{
+}
+
+LatencyStats::~LatencyStats()
+{
+    qDeleteAll(devices);
+}
+
+LatencyStages *LatencyStats::job()
+{
+    return &jobStages;
+}
+
+LatencyStages *LatencyStats::device(const QString &drive)
+{
+    QMutexLocker lock_mutex(&mutex);
+    QHash<QString,LatencyStages *>::const_iterator i=devices.constFind(drive);
+    if(i!=devices.constEnd())
+        return i.value();
+    LatencyStages *stages=new LatencyStages();
+    devices.insert(drive,stages);
+    return stages;
+}
+
+QString LatencyStats::stageName(const LatencyStage &stage)
+{
+    switch(stage)
+    {
+        case LatencyStage_Open:
+            return QStringLiteral("open");
+        case LatencyStage_FirstByte:
+            return QStringLiteral("first byte");
+        case LatencyStage_ReadBlock:
+            return QStringLiteral("read block");
+        case LatencyStage_WriteBlock:
+            return QStringLiteral("write block");
+        case LatencyStage_Close:
+            return QStringLiteral("close");
+        case LatencyStage_Metadata:
+            return QStringLiteral("metadata");
+        case LatencyStage_Checksum:
+            return QStringLiteral("checksum");
+        default:
+            return QStringLiteral("???");
+    }
+}
+
+QString LatencyStats::dumpStages(const LatencyStages &stages)
+{
+    QString text;
+    int index=0;
+    while(index<LatencyStage_Count)
+    {
+        const LatencyHistogram &histogram=stages.stages[index];
+        const quint64 count=histogram.count();
+        if(count>0)
+            text+=QStringLiteral("  %1 count: %2, mean: %3us, p50: %4us, p90: %5us, p99: %6us, p99.9: %7us, max: %8us\n")
+                .arg(stageName((LatencyStage)index),-12)
+                .arg(count)
+                .arg(histogram.mean())
+                .arg(histogram.valueAtPercentile(50))
+                .arg(histogram.valueAtPercentile(90))
+                .arg(histogram.valueAtPercentile(99))
+                .arg(histogram.valueAtPercentile(99.9))
+                .arg(histogram.maximum());
+        index++;
+    }
+    return text;
+}
+
+QString LatencyStats::dump() const
+{
+    QString text=QStringLiteral("job:\n")+dumpStages(jobStages);
+    QMutexLocker lock_mutex(&mutex);
+    QStringList drives=devices.keys();
+    drives.sort();
+    int index=0;
+    while(index<drives.size())
+    {
+        const QString &drive=drives.at(index);
+        if(drive.isEmpty())
+            text+=QStringLiteral("unknown device:\n");
+        else
+            text+=QStringLiteral("device %1:\n").arg(drive);
+        text+=dumpStages(*devices.value(drive));
+        index++;
+    }
+    return text;
+}
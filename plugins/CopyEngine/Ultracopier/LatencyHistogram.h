@@ -0,0 +1,113 @@
+/** \file LatencyHistogram.h
+\brief Latency histograms of the transfer stages, by job and by device
+\author alpha_one_x86
+\licence GPL3, see the file COPYING */
+
+#ifndef LATENCYHISTOGRAM_H
+#define LATENCYHISTOGRAM_H
+
+#include <QAtomicInteger>
+#include <QAtomicInt>
+#include <QElapsedTimer>
+#include <QString>
+#include <QHash>
+#include <QMutex>
+
+/// \brief number of bit of the sub-bucket, 32 sub-buckets by power of two, then ~3% of precision
+#define LATENCYHISTOGRAM_SUB_BITS 5
+#define LATENCYHISTOGRAM_SUB_COUNT (1<<LATENCYHISTOGRAM_SUB_BITS)
+/// \brief highest bit of the recorded value in us, the greater values (more than 38h) are counted at the max
+#define LATENCYHISTOGRAM_MAX_BIT 36
+#define LATENCYHISTOGRAM_BUCKET_COUNT ((LATENCYHISTOGRAM_MAX_BIT-LATENCYHISTOGRAM_SUB_BITS+2)*LATENCYHISTOGRAM_SUB_COUNT)
+
+/// \brief the measured stages of a transfer
+enum LatencyStage
+{
+    LatencyStage_Open=0,        ///< open() of the source or the destination
+    LatencyStage_FirstByte=1,   ///< from the open of the source to its first block read
+    LatencyStage_ReadBlock=2,   ///< read() of one block
+    LatencyStage_WriteBlock=3,  ///< write() of one block
+    LatencyStage_Close=4,       ///< flush, resize and close()
+    LatencyStage_Metadata=5,    ///< date and rights of the destination
+    LatencyStage_Checksum=6,    ///< checksum of the whole file
+    LatencyStage_Count=7
+};
+
+/** \brief HDR style histogram of latency in us
+ * The buckets are linear into each power of two, then the relative error is the same for all the values.
+ * The record is lock-free and can be done by any thread, the read can be done during the record. */
+class LatencyHistogram
+{
+public:
+    LatencyHistogram();
+    void record(const quint64 &microseconds);
+    quint64 count() const;
+    quint64 mean() const;
+    quint64 maximum() const;
+    /// \brief the value in us under which are percentile % of the recorded values
+    quint64 valueAtPercentile(const double &percentile) const;
+private:
+    Q_DISABLE_COPY(LatencyHistogram)
+    QAtomicInt buckets[LATENCYHISTOGRAM_BUCKET_COUNT];
+    QAtomicInteger<quint64> sum;
+    QAtomicInteger<quint64> maxValue;
+    static int bucketOf(const quint64 &value);
+    /// \brief the middle of the values of this bucket
+    static quint64 bucketValue(const int &bucket);
+};
+
+/// \brief the histograms of all the stages, for one job or one device
+struct LatencyStages
+{
+    LatencyHistogram stages[LatencyStage_Count];
+};
+
+/** \brief where the read or write thread record: the job and the device of the current file
+ * The targets are given with the open request and set by the thread which record when it open the file,
+ * then the close of the previous file is still recorded on its device. */
+class LatencyTarget
+{
+public:
+    LatencyTarget() : job(NULL), device(NULL) {}
+    void set(LatencyStages *job,LatencyStages *device)
+    {
+        this->job=job;
+        this->device=device;
+    }
+    void record(const LatencyStage &stage,const QElapsedTimer &timer) const
+    {
+        if(job==NULL)
+            return;
+        const quint64 microseconds=timer.nsecsElapsed()/1000;
+        job->stages[stage].record(microseconds);
+        if(device!=NULL)
+            device->stages[stage].record(microseconds);
+    }
+private:
+    Q_DISABLE_COPY(LatencyTarget)
+    LatencyStages *job;
+    LatencyStages *device;
+};
+
+/// \brief the latency of one copy engine instance, by device
+class LatencyStats
+{
+public:
+    explicit LatencyStats();
+    ~LatencyStats();
+    LatencyStages *job();
+    /// \brief the histograms of this drive, created at the first call, keep valid until the destructor
+    LatencyStages *device(const QString &drive);
+    /// \brief the text report of the job and of each device
+    QString dump() const;
+    /// \brief the stage name into the report
+    static QString stageName(const LatencyStage &stage);
+private:
+    Q_DISABLE_COPY(LatencyStats)
+    LatencyStages jobStages;
+    mutable QMutex mutex;
+    QHash<QString,LatencyStages *> devices;
+    static QString dumpStages(const LatencyStages &stages);
+};
+
+#endif // LATENCYHISTOGRAM_H
@@ -1,6 +1,13 @@
 #include "ListThread.h"
 #include <QStorageInfo>
 #include <QMutexLocker>
+#include <QDataStream>
+#include <algorithm>
+
+#ifdef Q_OS_UNIX
+#include <sys/types.h>
+#include <sys/stat.h>
+#endif
 
 ListThread::ListThread(FacilityInterface * facilityInterface)
 {
@@ -15,9 +22,15 @@ ListThread::ListThread(FacilityInterface * facilityInterface)
     bytesToTransfer                 = 0;
     bytesTransfered                 = 0;
     idIncrementNumber               = 1;
+    transferSlotUsed                = 0;
+    //the number of transfer the listing can add before wait
+    transferSlot.release(ULTRACOPIER_PLUGIN_MAX_TRANSFER_IN_MEMORY+ULTRACOPIER_PLUGIN_MAX_TRANSFER_SPILLED);
     actualRealByteTransfered        = 0;
+    lastGeneralCurrent              = 0;
+    lastGeneralTotal                = 0;
     numberOfTransferIntoToDoList    = 0;
     numberOfInodeOperation          = 0;
+    runningInodeAction              = 0;
     putAtBottom                     = 0;
     maxSpeed                        = 0;
     inodeThreads                    = 1;
@@ -42,6 +55,9 @@ ListThread::ListThread(FacilityInterface * facilityInterface)
     osBuffer                        = false;
     osBufferLimited                 = false;
     forcedMode                      = false;
+    physicalOrder                   = false;
+    transferListReader              = NULL;
+    importWaitTransferSlot          = false;
     #ifdef ULTRACOPIER_PLUGIN_SPEED_SUPPORT
     clockForTheCopySpeed            = NULL;
     multiForBigSpeed                = 0;
@@ -53,16 +69,20 @@ ListThread::ListThread(FacilityInterface * facilityInterface)
     #endif
     connect(this,           &ListThread::tryCancel,							this,&ListThread::cancel,                               Qt::QueuedConnection);
     connect(this,           &ListThread::askNewTransferThread,				this,&ListThread::createTransferThread,					Qt::QueuedConnection);
-    connect(&mkPathQueue,	&MkPath::firstFolderFinish,						this,&ListThread::mkPathFirstFolderFinish,				Qt::QueuedConnection);
+    connect(&mkPathQueue,	&MkPath::folderFinish,							this,&ListThread::mkPathFolderFinish,					Qt::QueuedConnection);
     connect(&mkPathQueue,	&MkPath::errorOnFolder,							this,&ListThread::mkPathErrorOnFolder,                  Qt::QueuedConnection);
+    connect(&physicalOrderThread,&PhysicalOrder::sorted,					this,&ListThread::physicalOrderSorted,					Qt::QueuedConnection);
     connect(this,           &ListThread::send_syncTransferList,				this,&ListThread::syncTransferList_internal,			Qt::QueuedConnection);
+    connect(this,           &ListThread::send_importTransferListBlock,		this,&ListThread::importTransferListBlock,				Qt::QueuedConnection);
     #ifdef ULTRACOPIER_PLUGIN_DEBUG
     connect(&mkPathQueue,	&MkPath::debugInformation,						this,&ListThread::debugInformation,	Qt::QueuedConnection);
+    connect(&physicalOrderThread,&PhysicalOrder::debugInformation,			this,&ListThread::debugInformation,	Qt::QueuedConnection);
     connect(&driveManagement,&DriveManagement::debugInformation,			this,&ListThread::debugInformation,	Qt::QueuedConnection);
     #endif // ULTRACOPIER_PLUGIN_DEBUG
 
     emit askNewTransferThread();
     mkpathTransfer.release();
+    mkPathQueue.setDestinationFolderCache(&destinationFolderCache);
 }
 
 ListThread::~ListThread()
@@ -95,57 +115,65 @@ void ListThread::transferInodeIsClosed()
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,QStringLiteral("transfer thread not idle!"));
         return;
     }
-    int int_for_internal_loop=0;
-    const int &loop_size=actionToDoListTransfer.size();
-    while(int_for_internal_loop<loop_size)
+    const int int_for_internal_loop=actionToDoListTransfer.indexOfId(temp_transfer_thread->transferId);
+    if(int_for_internal_loop>=0)
     {
-        if(actionToDoListTransfer.at(int_for_internal_loop).id==temp_transfer_thread->transferId)
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("[%1] have finish, put at idle; for id: %2").arg(int_for_internal_loop).arg(temp_transfer_thread->transferId));
+        //the other link of this inode can now be linked on the destination
+        if(hardLinkPending.contains(temp_transfer_thread->transferId))
         {
-            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("[%1] have finish, put at idle; for id: %2").arg(int_for_internal_loop).arg(temp_transfer_thread->transferId));
-            Ultracopier::ReturnActionOnCopyList newAction;
-            newAction.type=Ultracopier::RemoveItem;
-            newAction.userAction.moveAt=0;
-            newAction.addAction=actionToDoTransferToItemOfCopyList(actionToDoListTransfer.at(int_for_internal_loop));
-            newAction.userAction.position=int_for_internal_loop;
-            actionDone << newAction;
-            /// \todo check if item is at the right thread
-            actionToDoListTransfer.removeAt(int_for_internal_loop);
-            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("actionToDoListTransfer.size(): %1, actionToDoListInode: %2, actionToDoListInode_afterTheTransfer: %3").arg(actionToDoListTransfer.size()).arg(actionToDoListInode.size()).arg(actionToDoListInode_afterTheTransfer.size()));
-            if(actionToDoListTransfer.isEmpty() && actionToDoListInode.isEmpty() && actionToDoListInode_afterTheTransfer.isEmpty())
-                updateTheStatus();
-
-            //add the current size of file, to general size because it's finish
-            copiedSize=temp_transfer_thread->copiedSize();
-            if(copiedSize>(qint64)temp_transfer_thread->transferSize)
+            const QString &succeededDestination=temp_transfer_thread->getSucceededDestination();
+            if(!succeededDestination.isEmpty())
             {
-                oversize=copiedSize-temp_transfer_thread->transferSize;
-                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("add oversize of: %1").arg(oversize));
-                bytesToTransfer+=oversize;
-                bytesTransfered+=oversize;
+                hardLinkPending.remove(temp_transfer_thread->transferId);
+                hardLinkDestination[temp_transfer_thread->transferId]=succeededDestination;
+                hardLinkUnblock(temp_transfer_thread->transferId);
             }
-            bytesTransfered+=temp_transfer_thread->transferSize;
+            else
+                hardLinkForget(temp_transfer_thread->transferId);
+        }
+        //the name reserved by the scan or by the auto rename is now into the listing if created
+        destinationFolderCache.release(destinationPath(actionToDoListTransfer.at(int_for_internal_loop)));
+        destinationFolderCache.release(temp_transfer_thread->getReservedDestination());
+        addTransferActionDone(Ultracopier::RemoveItem,actionToDoListTransfer.at(int_for_internal_loop),int_for_internal_loop,0);
+        /// \todo check if item is at the right thread
+        removeTransferAt(int_for_internal_loop);
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("actionToDoListTransfer.size(): %1, actionToDoListInode: %2, waitingMovePath: %3").arg(actionToDoListTransfer.size()).arg(actionToDoListInode.size()).arg(waitingMovePath.size()));
+        if(actionToDoListTransfer.isEmpty() && actionToDoListInode.isEmpty() && waitingMovePath.isEmpty())
+            updateTheStatus();
+
+        //add the current size of file, to general size because it's finish
+        copiedSize=temp_transfer_thread->copiedSize();
+        if(copiedSize>(qint64)temp_transfer_thread->transferSize)
+        {
+            oversize=copiedSize-temp_transfer_thread->transferSize;
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("add oversize of: %1").arg(oversize));
+            bytesToTransfer+=oversize;
+            bytesTransfered+=oversize;
+        }
+        bytesTransfered+=temp_transfer_thread->transferSize;
 
-            if(temp_transfer_thread->haveStartTime)
-            {
-                timeToTransfer << QPair<quint64,quint32>(temp_transfer_thread->transferSize,temp_transfer_thread->startTransferTime.elapsed());
-                temp_transfer_thread->haveStartTime=false;
-            }
-            temp_transfer_thread->transferId=0;
-            temp_transfer_thread->transferSize=0;
-            #ifdef ULTRACOPIER_PLUGIN_DEBUG
-            countLocalParse++;
-            #endif
-            isFound=true;
-            if(actionToDoListTransfer.isEmpty())
-            {
-                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"actionToDoListTransfer==0");
-                actionToDoListInode << actionToDoListInode_afterTheTransfer;
-                actionToDoListInode_afterTheTransfer.clear();
-                doNewActions_inode_manipulation();
-            }
-            break;
+        if(temp_transfer_thread->haveStartTime)
+        {
+            timeToTransfer << QPair<quint64,quint32>(temp_transfer_thread->transferSize,temp_transfer_thread->startTransferTime.elapsed());
+            temp_transfer_thread->haveStartTime=false;
+        }
+        temp_transfer_thread->transferId=0;
+        temp_transfer_thread->transferSize=0;
+        addIdleTransferThread(temp_transfer_thread);
+        #ifdef ULTRACOPIER_PLUGIN_DEBUG
+        countLocalParse++;
+        #endif
+        isFound=true;
+        if(actionToDoListTransfer.isEmpty())
+        {
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"actionToDoListTransfer==0");
+            //no transfer use the folder id
+            folderTable.clear();
+            nameArena.clear();
+            actionDoneFolderIndex.clear();
+            jobTablesClear();
         }
-        int_for_internal_loop++;
     }
     if(isFound)
         deleteTransferThread();
@@ -154,6 +182,7 @@ void ListThread::transferInodeIsClosed()
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,QStringLiteral("unable to found item into the todo list, id: %1, index: %2").arg(temp_transfer_thread->transferId).arg(int_for_internal_loop));
         temp_transfer_thread->transferId=0;
         temp_transfer_thread->transferSize=0;
+        addIdleTransferThread(temp_transfer_thread);
     }
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("countLocalParse: %1, actionToDoList.size(): %2").arg(countLocalParse).arg(actionToDoListTransfer.size()));
     #ifdef ULTRACOPIER_PLUGIN_DEBUG
@@ -177,38 +206,32 @@ void ListThread::transferPutAtBottom()
     #ifdef ULTRACOPIER_PLUGIN_DEBUG
     int countLocalParse=0;
     #endif
-    int indexAction=0;
-    while(indexAction<actionToDoListTransfer.size())
-    {
-        if(actionToDoListTransfer.at(indexAction).id==transfer->transferId)
-        {
-            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("Put at the end: %1").arg(transfer->transferId));
-            //push for interface at the end
-            Ultracopier::ReturnActionOnCopyList newAction;
-            newAction.type=Ultracopier::MoveItem;
-            newAction.addAction.id=transfer->transferId;
-            newAction.userAction.position=actionToDoListTransfer.size()-1;
-            actionDone << newAction;
-            //do the wait stat
-            actionToDoListTransfer[indexAction].isRunning=false;
-            //move at the end
-            actionToDoListTransfer.move(indexAction,actionToDoListTransfer.size()-1);
-            //reset the thread list stat
-            transfer->transferId=0;
-            transfer->transferSize=0;
-            #ifdef ULTRACOPIER_PLUGIN_DEBUG
-            countLocalParse++;
-            #endif
-            isFound=true;
-            break;
-        }
-        indexAction++;
+    const int indexAction=actionToDoListTransfer.indexOfId(transfer->transferId);
+    if(indexAction>=0)
+    {
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("Put at the end: %1").arg(transfer->transferId));
+        //push for interface at the end
+        addActionDone(Ultracopier::MoveItem,transfer->transferId,indexAction,actionToDoListTransfer.size()-1);
+        //do the wait stat
+        actionToDoListTransfer[indexAction].isRunning=false;
+        actionToDoListTransfer.setBlocked(transfer->transferId,false);
+        //move at the end
+        actionToDoListTransfer.move(indexAction,actionToDoListTransfer.size()-1);
+        //reset the thread list stat
+        transfer->transferId=0;
+        transfer->transferSize=0;
+        addIdleTransferThread(transfer);
+        #ifdef ULTRACOPIER_PLUGIN_DEBUG
+        countLocalParse++;
+        #endif
+        isFound=true;
     }
     if(!isFound)
     {
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,QStringLiteral("unable to found item into the todo list, id: %1, index: %2").arg(transfer->transferId));
         transfer->transferId=0;
         transfer->transferSize=0;
+        addIdleTransferThread(transfer);
     }
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("countLocalParse: %1").arg(countLocalParse));
     #ifdef ULTRACOPIER_PLUGIN_DEBUG
@@ -296,11 +319,135 @@ void ListThread::setCheckDestinationFolderExists(const bool checkDestinationFold
 
 void ListThread::fileTransfer(const QFileInfo &sourceFileInfo,const QFileInfo &destinationFileInfo,const Ultracopier::CopyMode &mode)
 {
+    //the listing have taken one slot, given back when the transfer is removed of the list
+    transferSlotUsed++;
     if(stopIt)
         return;
     addToTransfer(sourceFileInfo,destinationFileInfo,mode);
 }
 
+/// \brief remove the transfer of the list, load the next transfer of the temporary file and unblock the listing
+bool ListThread::removeTransferAt(const int &position)
+{
+    bool movePathReady=false;
+    const ActionToDoTransfer &item=actionToDoListTransfer.at(position);
+    //the rmpath of the source folder wait the move of its content
+    if(item.mode==Ultracopier::Move)
+        movePathReady=movePathDependencyDone(folderTable.folder(item.sourceFolder));
+    releaseNames(item);
+    actionToDoListTransfer.removeAt(position);
+    if(transferSlotUsed>0)
+    {
+        transferSlotUsed--;
+        transferSlot.release();
+        if(importWaitTransferSlot)
+        {
+            importWaitTransferSlot=false;
+            emit send_importTransferListBlock();
+        }
+    }
+    QByteArray record;
+    while(actionToDoListTransfer.size()<ULTRACOPIER_PLUGIN_MAX_TRANSFER_IN_MEMORY && transferSpill.takeFirst(record))
+    {
+        const ActionToDoTransfer &temp=actionToDoTransferFromByteArray(record);
+        actionToDoListTransfer << temp;
+        hardLinkWait(temp);
+        addTransferActionDone(Ultracopier::AddingItem,temp);
+    }
+    //the temporary file can't be read, the transfer into it are lost
+    if(actionToDoListTransfer.size()<ULTRACOPIER_PLUGIN_MAX_TRANSFER_IN_MEMORY && !transferSpill.isEmpty())
+    {
+        const quint64 lostCount=transferSpill.count();
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,QStringLiteral("unable to read the temporary transfer list: %1, %2 transfer lost").arg(transferSpill.errorString()).arg(lostCount));
+        emit errorTransferList(tr("Unable to read the temporary transfer list: %1").arg(transferSpill.errorString()));
+        transferSpill.clear();
+        int releasedSlot=transferSlotUsed;
+        if((quint64)releasedSlot>lostCount)
+            releasedSlot=lostCount;
+        transferSlotUsed-=releasedSlot;
+        transferSlot.release(releasedSlot);
+    }
+    if(nameArena.needCompact())
+        compactNames();
+    //all is transfered, the rmpath still waiting can't have dependency
+    if(actionToDoListTransfer.isEmpty() && !waitingMovePath.isEmpty())
+    {
+        releaseWaitingMovePath();
+        movePathReady=true;
+    }
+    return movePathReady;
+}
+
+bool ListThread::movePathDependencyDone(const QString &folder)
+{
+    QHash<QString,int>::iterator i=movePathDependency.find(folder);
+    if(i==movePathDependency.end())
+        return false;
+    i.value()--;
+    if(i.value()>0)
+        return false;
+    movePathDependency.erase(i);
+    if(!waitingMovePathByFolder.contains(folder))
+        return false;
+    actionToDoListInode << waitingMovePath.take(waitingMovePathByFolder.take(folder));
+    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("rmpath ready: %1").arg(folder));
+    //the rmpath of the parent folder wait this one
+    movePathDependencyDone(QFileInfo(folder).absolutePath());
+    return true;
+}
+
+void ListThread::releaseWaitingMovePath()
+{
+    QMap<quint64,ActionToDoInode>::const_iterator i=waitingMovePath.constBegin();
+    while(i!=waitingMovePath.constEnd())
+    {
+        actionToDoListInode << i.value();
+        ++i;
+    }
+    waitingMovePath.clear();
+    waitingMovePathByFolder.clear();
+    movePathDependency.clear();
+}
+
+QByteArray ListThread::actionToDoTransferToByteArray(const ActionToDoTransfer &actionToDoTransfer) const
+{
+    QByteArray record;
+    QDataStream out(&record,QIODevice::WriteOnly);
+    out << actionToDoTransfer.id;
+    out << actionToDoTransfer.size;
+    out << actionToDoTransfer.sourceFolder;
+    out << actionToDoTransfer.destinationFolder;
+    out << nameArena.name(actionToDoTransfer.sourceName);
+    out << nameArena.name(actionToDoTransfer.destinationName);
+    out << (quint8)actionToDoTransfer.mode;
+    out << actionToDoTransfer.hardLinkOf;
+    return record;
+}
+
+ListThread::ActionToDoTransfer ListThread::actionToDoTransferFromByteArray(const QByteArray &record)
+{
+    ActionToDoTransfer actionToDoTransfer;
+    quint8 mode;
+    QString sourceName,destinationName;
+    QDataStream in(record);
+    in >> actionToDoTransfer.id;
+    in >> actionToDoTransfer.size;
+    in >> actionToDoTransfer.sourceFolder;
+    in >> actionToDoTransfer.destinationFolder;
+    in >> sourceName;
+    in >> destinationName;
+    actionToDoTransfer.sourceName=nameArena.add(sourceName);
+    if(destinationName.isEmpty())
+        actionToDoTransfer.destinationName=NAMEARENA_NO_NAME;
+    else
+        actionToDoTransfer.destinationName=nameArena.add(destinationName);
+    in >> mode;
+    in >> actionToDoTransfer.hardLinkOf;
+    actionToDoTransfer.mode=(Ultracopier::CopyMode)mode;
+    actionToDoTransfer.isRunning=false;
+    return actionToDoTransfer;
+}
+
 // -> add thread safe, by Qt::BlockingQueuedConnection
 bool ListThread::haveSameSource(const QStringList &sources)
 {
@@ -394,6 +541,8 @@ ScanFileOrFolder * ListThread::newScanThread(Ultracopier::CopyMode mode)
     scanFileOrFolderThreadsPool.last()->setFilters(include,exclude);
     scanFileOrFolderThreadsPool.last()->setCheckDestinationFolderExists(checkDestinationFolderExists && alwaysDoThisActionForFolderExists!=FolderExists_Merge);
     scanFileOrFolderThreadsPool.last()->setMoveTheWholeFolder(moveTheWholeFolder);
+    scanFileOrFolderThreadsPool.last()->setDestinationFolderCache(&destinationFolderCache);
+    scanFileOrFolderThreadsPool.last()->setTransferSlot(&transferSlot);
     #ifdef ULTRACOPIER_PLUGIN_RSYNC
     scanFileOrFolderThreadsPool.last()->setRsync(rsync);
     #endif
@@ -438,7 +587,83 @@ void ListThread::scanThreadHaveFinish(bool skipFirstRemove)
             ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,"The listing thread is already running");
     }
     else
+    {
+        if(physicalOrder && !sourceDriveMultiple && driveManagement.isRotational(sourceDrive))
+            sortTransferByPhysicalOffset();
+        jobTablesClear();
         autoStartAndCheckSpace();
+    }
+}
+
+void ListThread::sortTransferByPhysicalOffset()
+{
+    /* only the top of the in memory list is sorted, it's what will be started first: the FIEMAP is done
+     * by physicalOrderThread, the spilled transfer and the rest of the list keep the list order */
+    int loop_size=actionToDoListTransfer.size();
+    if(loop_size>ULTRACOPIER_PLUGIN_PHYSICAL_ORDER_MAX_TRANSFER)
+        loop_size=ULTRACOPIER_PLUGIN_PHYSICAL_ORDER_MAX_TRANSFER;
+    QList<quint64> idList;
+    QStringList pathList;
+    int index=0;
+    while(index<loop_size)
+    {
+        const ActionToDoTransfer &item=actionToDoListTransfer.at(index);
+        if(!item.isRunning)
+        {
+            idList << item.id;
+            pathList << sourcePath(item);
+        }
+        index++;
+    }
+    if(idList.size()<=1)
+        return;
+    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("sort %1 transfer by physical offset on %2").arg(idList.size()).arg(sourceDrive));
+    physicalOrderThread.sort(idList,pathList);
+}
+
+void ListThread::physicalOrderSorted(const QList<quint64> &sortedIdList)
+{
+    if(stopIt)
+        return;
+    /* the transfers have continued during the sort: the running transfer stay first, then the sorted transfer
+     * still into the list and not started */
+    int loop_size=actionToDoListTransfer.size();
+    if(loop_size>ULTRACOPIER_PLUGIN_PHYSICAL_ORDER_MAX_TRANSFER)
+        loop_size=ULTRACOPIER_PLUGIN_PHYSICAL_ORDER_MAX_TRANSFER;
+    QList<quint64> idList;
+    int index=0;
+    while(index<loop_size)
+    {
+        if(actionToDoListTransfer.at(index).isRunning)
+            idList << actionToDoListTransfer.at(index).id;
+        index++;
+    }
+    //only the misplaced transfer are moved, the moves are sent to the interface into the same action batch
+    int moved=0;
+    int target=0;
+    index=0;
+    while(index<(idList.size()+sortedIdList.size()))
+    {
+        quint64 id;
+        if(index<idList.size())
+            id=idList.at(index);
+        else
+            id=sortedIdList.at(index-idList.size());
+        index++;
+        const int position=actionToDoListTransfer.indexOfId(id);
+        //finished or started during the sort
+        if(position<0 || (index>idList.size() && actionToDoListTransfer.at(position).isRunning))
+            continue;
+        if(position!=target)
+        {
+            addActionDone(Ultracopier::MoveItem,id,position,target);
+            actionToDoListTransfer.move(position,target);
+            moved++;
+        }
+        target++;
+    }
+    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("%1 transfer moved by the physical order").arg(moved));
+    sendActionDone();
 }
 
 void ListThread::autoStartAndCheckSpace()
@@ -648,7 +873,7 @@ void ListThread::set_osBufferLimited(bool osBufferLimited)
     }
 }
 
-void ListThread::realByteTransfered()
+quint64 ListThread::realByteTransfered() const
 {
     quint64 totalRealByteTransfered=0;
     int index=0;
@@ -658,7 +883,12 @@ void ListThread::realByteTransfered()
         totalRealByteTransfered+=transferThreadList.at(index)->realByteTransfered();
         index++;
     }
-    emit send_realBytesTransfered(totalRealByteTransfered);
+    return totalRealByteTransfered;
+}
+
+quint64 ListThread::getRealByteTransfered() const
+{
+    return progressSnapshot.readRealByteTransfered();
 }
 
 void ListThread::pause()
@@ -720,26 +950,20 @@ bool ListThread::skipInternal(const quint64 &id)
         }
         index++;
     }
-    int int_for_internal_loop=0;
-    const int &loop_size=actionToDoListTransfer.size();
-    while(int_for_internal_loop<loop_size)
-    {
-        if(actionToDoListTransfer.at(int_for_internal_loop).id==id)
-        {
-            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("[%1] remove at not running, for id: %2").arg(int_for_internal_loop).arg(id));
-            Ultracopier::ReturnActionOnCopyList newAction;
-            newAction.type=Ultracopier::RemoveItem;
-            newAction.userAction.moveAt=1;
-            newAction.addAction=actionToDoTransferToItemOfCopyList(actionToDoListTransfer.at(int_for_internal_loop));
-            newAction.userAction.position=int_for_internal_loop;
-            actionDone << newAction;
-            actionToDoListTransfer.removeAt(int_for_internal_loop);
-            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("actionToDoListTransfer.size(): %1, actionToDoListInode: %2, actionToDoListInode_afterTheTransfer: %3").arg(actionToDoListTransfer.size()).arg(actionToDoListInode.size()).arg(actionToDoListInode_afterTheTransfer.size()));
-            if(actionToDoListTransfer.isEmpty() && actionToDoListInode.isEmpty() && actionToDoListInode_afterTheTransfer.isEmpty())
-                updateTheStatus();
-            return true;
-        }
-        int_for_internal_loop++;
+    const int int_for_internal_loop=actionToDoListTransfer.indexOfId(id);
+    if(int_for_internal_loop>=0)
+    {
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("[%1] remove at not running, for id: %2").arg(int_for_internal_loop).arg(id));
+        addTransferActionDone(Ultracopier::RemoveItem,actionToDoListTransfer.at(int_for_internal_loop),int_for_internal_loop,1);
+        destinationFolderCache.release(destinationPath(actionToDoListTransfer.at(int_for_internal_loop)));
+        const bool movePathReady=removeTransferAt(int_for_internal_loop);
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("actionToDoListTransfer.size(): %1, actionToDoListInode: %2, waitingMovePath: %3").arg(actionToDoListTransfer.size()).arg(actionToDoListInode.size()).arg(waitingMovePath.size()));
+        if(actionToDoListTransfer.isEmpty() && actionToDoListInode.isEmpty() && waitingMovePath.isEmpty())
+            updateTheStatus();
+        //the other link of this inode will be copied
+        if(hardLinkForget(id) || movePathReady)
+            doNewActions_inode_manipulation();
+        return true;
     }
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("skip transfer not found: %1").arg(id));
     return false;
@@ -754,6 +978,13 @@ void ListThread::cancel()
         return;
     }
     stopIt=true;
+    dumpLatency();
+    if(transferListReader!=NULL)
+    {
+        delete transferListReader;
+        transferListReader=NULL;
+    }
+    importWaitTransferSlot=false;
     int index=0;
     int loop_size=transferThreadList.size();
     while(index<loop_size)
@@ -782,6 +1013,17 @@ void ListThread::cancel()
     checkIfReadyToCancel();
 }
 
+void ListThread::dumpLatency()
+{
+    const QStringList lines=latencyStats.dump().split(QLatin1Char('\n'),QString::SkipEmptyParts);
+    int index=0;
+    while(index<lines.size())
+    {
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Information,QStringLiteral("latency ")+lines.at(index));
+        index++;
+    }
+}
+
 void ListThread::checkIfReadyToCancel()
 {
     if(!stopIt)
@@ -794,6 +1036,8 @@ void ListThread::checkIfReadyToCancel()
         {
             if(transferThreadList.at(index)->transferId!=0)
                 return;
+            idleTransferThreadSet.remove(transferThreadList.at(index));
+            idleTransferThreadList.removeOne(transferThreadList.at(index));
             delete transferThreadList.at(index);//->deleteLayer();
             transferThreadList[index]=NULL;
             transferThreadList.removeAt(index);
@@ -803,9 +1047,24 @@ void ListThread::checkIfReadyToCancel()
         index++;
     }
     actionToDoListTransfer.clear();
+    transferSpill.clear();
+    folderTable.clear();
+    nameArena.clear();
+    actionDoneFolderIndex.clear();
+    hardLinkClear();
+    destinationFolderCache.clear();
+    //unblock the listing
+    transferSlot.release(transferSlotUsed);
+    transferSlotUsed=0;
     actionToDoListInode.clear();
-    actionToDoListInode_afterTheTransfer.clear();
+    runningInodeAction=0;
+    waitingMovePath.clear();
+    waitingMovePathByFolder.clear();
+    movePathDependency.clear();
+    idleTransferThreadList.clear();
+    idleTransferThreadSet.clear();
     actionDone.clear();
+    actionDoneFolderIndex.clear();
     progressionList.clear();
     returnListItemOfCopyListToCopyEngine.clear();
     quit();
@@ -922,8 +1181,8 @@ void ListThread::updateTheStatus()
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"start");
     sendActionDone();
-    bool updateTheStatus_listing=scanFileOrFolderThreadsPool.size()>0;
-    bool updateTheStatus_copying=actionToDoListTransfer.size()>0 || actionToDoListInode.size()>0 || actionToDoListInode_afterTheTransfer.size()>0;
+    bool updateTheStatus_listing=scanFileOrFolderThreadsPool.size()>0 || transferListReader!=NULL;
+    bool updateTheStatus_copying=actionToDoListTransfer.size()>0 || actionToDoListInode.size()>0 || waitingMovePath.size()>0;
     Ultracopier::EngineActionInProgress updateTheStatus_action_in_progress;
     if(updateTheStatus_copying && updateTheStatus_listing)
         updateTheStatus_action_in_progress=Ultracopier::CopyingAndListing;
@@ -981,7 +1240,16 @@ void ListThread::addToMovePath(const QFileInfo& source, const QFileInfo &destina
     temp.source     = source;
     temp.destination= destination;
     temp.isRunning	= false;
-    actionToDoListInode << temp;
+    const QString &folder=source.absoluteFilePath();
+    if(movePathDependency.value(folder,0)>0)
+    {
+        //wait the move of the content, and the parent folder wait this rmpath
+        waitingMovePath.insert(temp.id,temp);
+        waitingMovePathByFolder.insert(folder,temp.id);
+        movePathDependency[QFileInfo(folder).absolutePath()]++;
+    }
+    else
+        actionToDoListInode << temp;
 }
 
 void ListThread::addToRealMove(const QFileInfo& source,const QFileInfo& destination)
@@ -1020,6 +1288,7 @@ void ListThread::sendActionDone()
     {
         emit newActionOnList(actionDone);
         actionDone.clear();
+        actionDoneFolderIndex.clear();
     }
     if(!timeToTransfer.isEmpty())
     {
@@ -1029,6 +1298,8 @@ void ListThread::sendActionDone()
 }
 
 //send progression
+/** \brief poll the counters of all the transfer threads at each tick, without lock
+ * Only the emission is by delta: the transfers which have not changed are not sent. */
 void ListThread::sendProgression()
 {
     if(actionToDoListTransfer.isEmpty())
@@ -1065,7 +1336,12 @@ void ListThread::sendProgression()
                 tempItem.currentWrite=progression.second;
                 tempItem.id=temp_transfer_thread->transferId;
                 tempItem.total=totalSize;
-                progressionList << tempItem;
+                //only the changed progression is sent
+                const QHash<quint64,Ultracopier::ProgressionItem>::const_iterator i=lastProgression.constFind(tempItem.id);
+                if(i==lastProgression.constEnd() || i.value().currentRead!=tempItem.currentRead ||
+                        i.value().currentWrite!=tempItem.currentWrite || i.value().total!=tempItem.total)
+                    progressionList << tempItem;
+                newProgression.insert(tempItem.id,tempItem);
 
                 //add the oversize to the general progression
                 oversize+=localOverSize;
@@ -1076,10 +1352,22 @@ void ListThread::sendProgression()
         }
         int_for_loop++;
     }
-    emit pushFileProgression(progressionList);
-    progressionList.clear();
-    emit pushGeneralProgression(bytesTransfered+currentProgression,bytesToTransfer+oversize);
-    realByteTransfered();
+    lastProgression.swap(newProgression);
+    newProgression.clear();
+    if(!progressionList.isEmpty())
+    {
+        emit pushFileProgression(progressionList);
+        progressionList.clear();
+    }
+    const quint64 generalCurrent=bytesTransfered+currentProgression;
+    const quint64 generalTotal=bytesToTransfer+oversize;
+    if(generalCurrent!=lastGeneralCurrent || generalTotal!=lastGeneralTotal)
+    {
+        lastGeneralCurrent=generalCurrent;
+        lastGeneralTotal=generalTotal;
+        emit pushGeneralProgression(generalCurrent,generalTotal);
+    }
+    progressSnapshot.publish(generalCurrent,generalTotal,realByteTransfered());
 }
 
 //send the progression, after full reset of the interface (then all is empty)
@@ -1088,6 +1376,7 @@ void ListThread::syncTransferList_internal()
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"start");
     emit syncReady();
     actionDone.clear();
+    actionDoneFolderIndex.clear();
     //do list operation
     TransferThread *transferThread;
     const int &loop_size=actionToDoListTransfer.size();
@@ -1096,50 +1385,29 @@ void ListThread::syncTransferList_internal()
     int int_for_internal_loop;
     for(int int_for_loop=0; int_for_loop<loop_size; ++int_for_loop) {
         const ActionToDoTransfer &item=actionToDoListTransfer.at(int_for_loop);
-        Ultracopier::ReturnActionOnCopyList newAction;
-        newAction.type				= Ultracopier::PreOperation;
-        newAction.addAction.id			= item.id;
-        newAction.addAction.sourceFullPath	= item.source.absoluteFilePath();
-        newAction.addAction.sourceFileName	= item.source.fileName();
-        newAction.addAction.destinationFullPath	= item.destination.absoluteFilePath();
-        newAction.addAction.destinationFileName	= item.destination.fileName();
-        newAction.addAction.size		= item.size;
-        newAction.addAction.mode		= item.mode;
-        actionDone << newAction;
-        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("id: %1, size: %2, name: %3, size2: %4").arg(item.id).arg(item.size).arg(item.source.absoluteFilePath()).arg(newAction.addAction.size));
+        addTransferActionDone(Ultracopier::PreOperation,item);
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("id: %1, size: %2, name: %3, size2: %4").arg(item.id).arg(item.size).arg(sourcePath(item)));
         if(item.isRunning)
         {
             for(int_for_internal_loop=0; int_for_internal_loop<loop_sub_size; ++int_for_internal_loop) {
                 transferThread=transferThreadList.at(int_for_internal_loop);
-                Ultracopier::ReturnActionOnCopyList newAction;
-                newAction.type				= Ultracopier::PreOperation;
-                newAction.addAction.id			= item.id;
-                newAction.addAction.sourceFullPath	= item.source.absoluteFilePath();
-                newAction.addAction.sourceFileName	= item.source.fileName();
-                newAction.addAction.destinationFullPath	= item.destination.absoluteFilePath();
-                newAction.addAction.destinationFileName	= item.destination.fileName();
-                newAction.addAction.size		= item.size;
-                newAction.addAction.mode		= item.mode;
-                actionDone << newAction;
+                addTransferActionDone(Ultracopier::PreOperation,item);
                 if(transferThread->getStat()!=TransferStat_PreOperation)
                 {
-                    Ultracopier::ReturnActionOnCopyList newAction;
                     switch(transferThread->getStat())
                     {
                         case TransferStat_Transfer:
-                            newAction.type=Ultracopier::Transfer;
+                            addActionDone(Ultracopier::Transfer,item.id);
                         break;
                         /*case TransferStat_PostTransfer:
-                            newAction.type=Ultracopier::PostOperation;
+                            addActionDone(Ultracopier::PostOperation,item.id);
                         break;*/
                         case TransferStat_PostOperation:
-                            newAction.type=Ultracopier::PostOperation;
+                            addActionDone(Ultracopier::PostOperation,item.id);
                         break;
                         default:
                         break;
                     }
-                    newAction.addAction.id			= item.id;
-                    actionDone << newAction;
                 }
             }
         }
@@ -1147,19 +1415,37 @@ void ListThread::syncTransferList_internal()
 }
 
 //add file transfer to do
-quint64 ListThread::addToTransfer(const QFileInfo& source,const QFileInfo& destination,const Ultracopier::CopyMode& mode)
+quint64 ListThread::addToTransfer(const QFileInfo& source,const QFileInfo& destination,const Ultracopier::CopyMode& mode,const qint64 &knownSize)
 {
     if(stopIt)
         return 0;
     //add to transfer list
     numberOfTransferIntoToDoList++;
     quint64 size=0;
-    if(!source.isSymLink())
+    //the size of the imported list is used, the source is only lstat() for the drive and the hard link
+    if(knownSize>=0)
+        size=knownSize;
+    else if(!source.isSymLink())
         size=source.size();
+    //one stat of the source, for the drive and the hard link detection, the imported list too
+    #ifdef Q_OS_UNIX
+    struct stat sourceStat;
+    const bool haveSourceStat=!source.isSymLink() && lstat(QFile::encodeName(source.absoluteFilePath()).constData(),&sourceStat)==0;
+    #endif
     const QString &drive=driveManagement.getDrive(destination.absoluteFilePath());
     if(drive.isEmpty())
         abort();
-    if(mode!=Ultracopier::Move || drive!=driveManagement.getDrive(source.absoluteFilePath()))
+    QString sourceDrive;
+    if(mode==Ultracopier::Move)
+    {
+        #ifdef Q_OS_UNIX
+        if(haveSourceStat)
+            sourceDrive=driveManagement.getDrive(source.absoluteFilePath(),sourceStat.st_dev);
+        else
+        #endif
+            sourceDrive=driveManagement.getDrive(source.absoluteFilePath());
+    }
+    if(mode!=Ultracopier::Move || drive!=sourceDrive)
     {
         if(requiredSpace.contains(drive))
         {
@@ -1175,32 +1461,194 @@ quint64 ListThread::addToTransfer(const QFileInfo& source,const QFileInfo& desti
     bytesToTransfer+= size;
     ActionToDoTransfer temp;
     temp.id		= generateIdNumber();
+    temp.hardLinkOf	= 0;
+    #ifdef Q_OS_UNIX
+    if(haveSourceStat && S_ISREG(sourceStat.st_mode) && sourceStat.st_nlink>1)
+        temp.hardLinkOf	= hardLinkFirstTransferId(source,sourceStat.st_dev,sourceStat.st_ino,temp.id);
+    #endif
     temp.size	= size;
-    temp.source	= source;
-    temp.destination= destination;
+    //only the folder id and the name are stored, the QFileInfo is created when a transfer thread take it
+    temp.sourceFolder	= folderTable.add(source.absolutePath());
+    temp.sourceName	= nameArena.add(source.fileName());
+    temp.destinationFolder	= folderTable.add(destination.absolutePath());
+    if(destination.fileName()!=source.fileName())
+        temp.destinationName=nameArena.add(destination.fileName());
+    else
+        temp.destinationName=NAMEARENA_NO_NAME;
     temp.mode	= mode;
     temp.isRunning	= false;
+    //the rmpath of the source folder wait this transfer
+    if(mode==Ultracopier::Move)
+        movePathDependency[source.absolutePath()]++;
+    //the tail of the big job go into the temporary file, it's shown into the interface when it's loaded into the list
+    if(!transferSpill.isEmpty() || actionToDoListTransfer.size()>=ULTRACOPIER_PLUGIN_MAX_TRANSFER_IN_MEMORY)
+        if(transferSpill.append(actionToDoTransferToByteArray(temp)))
+        {
+            releaseNames(temp);
+            return temp.id;
+        }
     actionToDoListTransfer << temp;
+    hardLinkWait(temp);
     //push the new transfer to interface
-    Ultracopier::ReturnActionOnCopyList newAction;
-    newAction.type				= Ultracopier::AddingItem;
-    newAction.addAction=actionToDoTransferToItemOfCopyList(temp);
-    actionDone << newAction;
+    addTransferActionDone(Ultracopier::AddingItem,temp);
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("source: %1, destination: %2, add entry: %3, size: %4, size2: %5, isSymLink: %6").arg(source.absoluteFilePath()).arg(destination.absoluteFilePath()).arg(temp.id).arg(temp.size).arg(size).arg(source.isSymLink()));
     return temp.id;
 }
 
-Ultracopier::ItemOfCopyList ListThread::actionToDoTransferToItemOfCopyList(const ListThread::ActionToDoTransfer &actionToDoTransfer)
+#ifdef Q_OS_UNIX
+/** \brief return the id of the first transfer of the same source inode
+ * The first transfer is registred here, and the next will do link() on its destination */
+quint64 ListThread::hardLinkFirstTransferId(const QFileInfo &source,const quint64 &device,const quint64 &inode,const quint64 &id)
+{
+    const QPair<quint64,quint64> key(device,inode);
+    if(hardLinkFirstTransfer.contains(key))
+    {
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("hard link detected: %1, first transfer: %2").arg(source.absoluteFilePath()).arg(hardLinkFirstTransfer.value(key)));
+        return hardLinkFirstTransfer.value(key);
+    }
+    hardLinkFirstTransfer[key]=id;
+    hardLinkInode[id]=key;
+    hardLinkPending << id;
+    return 0;
+}
+#endif
+
+/** \brief the first transfer is removed or have failed
+ * The waiting links see no destination and are copied, the next added link of this inode become a new first transfer */
+bool ListThread::hardLinkForget(const quint64 &id)
+{
+    #ifdef Q_OS_UNIX
+    if(hardLinkInode.contains(id))
+        hardLinkFirstTransfer.remove(hardLinkInode.take(id));
+    #endif
+    hardLinkDestination.remove(id);
+    hardLinkUnblock(id);
+    return hardLinkPending.remove(id);
+}
+
+void ListThread::hardLinkClear()
+{
+    #ifdef Q_OS_UNIX
+    hardLinkFirstTransfer.clear();
+    hardLinkInode.clear();
+    #endif
+    hardLinkPending.clear();
+    hardLinkDestination.clear();
+    hardLinkWaiting.clear();
+}
+
+void ListThread::jobTablesClear()
+{
+    //the listing can still add a link of an already copied inode or a name into a folder in reservation
+    if(!actionToDoListTransfer.isEmpty() || !transferSpill.isEmpty() || !scanFileOrFolderThreadsPool.isEmpty() || transferListReader!=NULL)
+        return;
+    hardLinkClear();
+    destinationFolderCache.clear();
+}
+
+void ListThread::hardLinkWait(const ActionToDoTransfer &item)
+{
+    if(item.hardLinkOf==0 || !hardLinkPending.contains(item.hardLinkOf))
+        return;
+    actionToDoListTransfer.setBlocked(item.id,true);
+    hardLinkWaiting[item.hardLinkOf] << item.id;
+}
+
+void ListThread::hardLinkUnblock(const quint64 &id)
+{
+    const QList<quint64> &waitingList=hardLinkWaiting.take(id);
+    int index=0;
+    while(index<waitingList.size())
+    {
+        //not blocked if removed from the list
+        actionToDoListTransfer.setBlocked(waitingList.at(index),false);
+        index++;
+    }
+}
+
+void ListThread::addActionDone(const Ultracopier::ActionTypeCopyList &type,const quint64 &id,const int &position,const int &moveAt)
+{
+    Ultracopier::CopyListEvent event;
+    event.id=id;
+    event.size=0;
+    event.position=position;
+    event.moveAt=moveAt;
+    event.sourceFolder=Ultracopier::CopyListEvents::noString;
+    event.sourceFileName=Ultracopier::CopyListEvents::noString;
+    event.destinationFolder=Ultracopier::CopyListEvents::noString;
+    event.destinationFileName=Ultracopier::CopyListEvents::noString;
+    event.type=type;
+    event.mode=0;
+    actionDone.append(event);
+}
+
+void ListThread::addTransferActionDone(const Ultracopier::ActionTypeCopyList &type,const ActionToDoTransfer &actionToDoTransfer,const int &position,const int &moveAt)
+{
+    Ultracopier::CopyListEvent event;
+    event.id=actionToDoTransfer.id;
+    event.size=actionToDoTransfer.size;
+    event.position=position;
+    event.moveAt=moveAt;
+    event.sourceFolder=actionDoneFolder(actionToDoTransfer.sourceFolder);
+    event.sourceFileName=actionDone.addString(nameArena.name(actionToDoTransfer.sourceName));
+    event.destinationFolder=actionDoneFolder(actionToDoTransfer.destinationFolder);
+    if(actionToDoTransfer.destinationName==NAMEARENA_NO_NAME)
+        event.destinationFileName=event.sourceFileName;
+    else
+        event.destinationFileName=actionDone.addString(nameArena.name(actionToDoTransfer.destinationName));
+    event.type=type;
+    event.mode=actionToDoTransfer.mode;
+    actionDone.append(event);
+}
+
+quint32 ListThread::actionDoneFolder(const quint32 &folderId)
+{
+    QHash<quint32,quint32>::const_iterator i=actionDoneFolderIndex.constFind(folderId);
+    if(i!=actionDoneFolderIndex.constEnd())
+        return i.value();
+    const quint32 index=actionDone.addString(folderTable.folder(folderId));
+    actionDoneFolderIndex[folderId]=index;
+    return index;
+}
+
+QString ListThread::sourcePath(const ActionToDoTransfer &actionToDoTransfer) const
 {
-    Ultracopier::ItemOfCopyList itemOfCopyList;
-    itemOfCopyList.id			= actionToDoTransfer.id;
-    itemOfCopyList.sourceFullPath	= actionToDoTransfer.source.absoluteFilePath();
-    itemOfCopyList.sourceFileName	= actionToDoTransfer.source.fileName();
-    itemOfCopyList.destinationFullPath	= actionToDoTransfer.destination.absoluteFilePath();
-    itemOfCopyList.destinationFileName	= actionToDoTransfer.destination.fileName();
-    itemOfCopyList.size		= actionToDoTransfer.size;
-    itemOfCopyList.mode		= actionToDoTransfer.mode;
-    return itemOfCopyList;
+    return folderTable.filePath(actionToDoTransfer.sourceFolder,nameArena.name(actionToDoTransfer.sourceName));
+}
+
+QString ListThread::destinationName(const ActionToDoTransfer &actionToDoTransfer) const
+{
+    if(actionToDoTransfer.destinationName==NAMEARENA_NO_NAME)
+        return nameArena.name(actionToDoTransfer.sourceName);
+    return nameArena.name(actionToDoTransfer.destinationName);
+}
+
+void ListThread::releaseNames(const ActionToDoTransfer &actionToDoTransfer)
+{
+    nameArena.release(actionToDoTransfer.sourceName);
+    nameArena.release(actionToDoTransfer.destinationName);
+}
+
+void ListThread::compactNames()
+{
+    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("compact the names of %1 transfer").arg(actionToDoListTransfer.size()));
+    NameArena compactedArena;
+    int index=0;
+    const int loop_size=actionToDoListTransfer.size();
+    while(index<loop_size)
+    {
+        ActionToDoTransfer &item=actionToDoListTransfer[index];
+        item.sourceName=compactedArena.add(nameArena.name(item.sourceName));
+        if(item.destinationName!=NAMEARENA_NO_NAME)
+            item.destinationName=compactedArena.add(nameArena.name(item.destinationName));
+        index++;
+    }
+    nameArena.swap(compactedArena);
+}
+
+QString ListThread::destinationPath(const ActionToDoTransfer &actionToDoTransfer) const
+{
+    return folderTable.filePath(actionToDoTransfer.destinationFolder,destinationName(actionToDoTransfer));
 }
 
 //generate id number
@@ -1219,6 +1667,23 @@ void ListThread::removeItems(const QList<int> &ids)
         skipInternal(ids.at(i));
 }
 
+QList<int> ListThread::positionOfIds(const QList<int> &ids) const
+{
+    QList<int> positionList;
+    positionList.reserve(ids.size());
+    int index=0;
+    const int loop_size=ids.size();
+    while(index<loop_size)
+    {
+        const int position=actionToDoListTransfer.indexOfId(ids.at(index));
+        if(position>=0)
+            positionList << position;
+        index++;
+    }
+    std::sort(positionList.begin(),positionList.end());
+    return positionList;
+}
+
 //put on top
 void ListThread::moveItemsOnTop(QList<int> ids)
 {
@@ -1228,25 +1693,17 @@ void ListThread::moveItemsOnTop(QList<int> ids)
         return;
     }
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"start");
-    //do list operation
+    //do list operation, in the current order: the item after the moved item don't change of position
+    const QList<int> &positionList=positionOfIds(ids);
     int indexToMove=0;
-    const int &loop_size=actionToDoListTransfer.size();
-    for (int i=0; i<loop_size; ++i) {
-        if(ids.contains(actionToDoListTransfer.at(i).id))
-        {
-            ids.removeOne(actionToDoListTransfer.at(i).id);
-            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("move item ")+QString::number(i)+QStringLiteral(" to ")+QString::number(indexToMove));
-            Ultracopier::ReturnActionOnCopyList newAction;
-            newAction.type=Ultracopier::MoveItem;
-            newAction.addAction.id=actionToDoListTransfer.at(i).id;
-            newAction.userAction.moveAt=indexToMove;
-            newAction.userAction.position=i;
-            actionDone << newAction;
-            actionToDoListTransfer.move(i,indexToMove);
-            indexToMove++;
-            if(ids.isEmpty())
-                return;
-        }
+    const int &loop_size=positionList.size();
+    while(indexToMove<loop_size)
+    {
+        const int &position=positionList.at(indexToMove);
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("move item ")+QString::number(position)+QStringLiteral(" to ")+QString::number(indexToMove));
+        addActionDone(Ultracopier::MoveItem,actionToDoListTransfer.at(position).id,position,indexToMove);
+        actionToDoListTransfer.move(position,indexToMove);
+        indexToMove++;
     }
     sendActionDone();
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"stop");
@@ -1261,38 +1718,27 @@ void ListThread::moveItemsUp(QList<int> ids)
         return;
     }
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"start");
-    //do list operation
-    int lastGoodPositionReal=0;
-    bool haveGoodPosition=false;
-    const int &loop_size=actionToDoListTransfer.size();
-    for (int i=0; i<loop_size; ++i) {
-        if(ids.contains(actionToDoListTransfer.at(i).id))
+    //do list operation, the first position where a selected item can go
+    const QList<int> &positionList=positionOfIds(ids);
+    int firstFreePosition=0;
+    int index=0;
+    const int &loop_size=positionList.size();
+    while(index<loop_size)
+    {
+        const int &position=positionList.at(index);
+        if(position>firstFreePosition)
         {
-            if(haveGoodPosition)
-            {
-                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("move item ")+QString::number(i)+QStringLiteral(" to ")+QString::number(i-1));
-                Ultracopier::ReturnActionOnCopyList newAction;
-                newAction.type=Ultracopier::MoveItem;
-                newAction.addAction.id=actionToDoListTransfer.at(i).id;
-                newAction.userAction.moveAt=lastGoodPositionReal;
-                newAction.userAction.position=i;
-                actionDone << newAction;
-                actionToDoListTransfer.swap(i,lastGoodPositionReal);
-            }
-            else
-                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("Try move up false, item ")+QString::number(i));
-            ids.removeOne(actionToDoListTransfer.at(i).id);
-            if(ids.isEmpty())
-            {
-                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"stop with return");
-                return;
-            }
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("move item ")+QString::number(position)+QStringLiteral(" to ")+QString::number(position-1));
+            addActionDone(Ultracopier::MoveItem,actionToDoListTransfer.at(position).id,position,position-1);
+            actionToDoListTransfer.swap(position,position-1);
+            firstFreePosition=position;
         }
         else
         {
-            lastGoodPositionReal=i;
-            haveGoodPosition=true;
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("Try move up false, item ")+QString::number(position));
+            firstFreePosition=position+1;
         }
+        index++;
     }
     sendActionDone();
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"stop");
@@ -1307,39 +1753,26 @@ void ListThread::moveItemsDown(QList<int> ids)
         return;
     }
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"start");
-    //do list operation
-    int lastGoodPositionReal=0;
-    bool haveGoodPosition=false;
-    for (int i=actionToDoListTransfer.size()-1; i>=0; --i) {
-        if(ids.contains(actionToDoListTransfer.at(i).id))
+    //do list operation, the last position where a selected item can go
+    const QList<int> &positionList=positionOfIds(ids);
+    int lastFreePosition=actionToDoListTransfer.size()-1;
+    int index=positionList.size()-1;
+    while(index>=0)
+    {
+        const int &position=positionList.at(index);
+        if(position<lastFreePosition)
         {
-            if(haveGoodPosition)
-            {
-                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("move item ")+QString::number(i)+QStringLiteral(" to ")+QString::number(i+1));
-                Ultracopier::ReturnActionOnCopyList newAction;
-                newAction.type=Ultracopier::MoveItem;
-                newAction.addAction.id=actionToDoListTransfer.at(i).id;
-                newAction.userAction.moveAt=lastGoodPositionReal;
-                newAction.userAction.position=i;
-                actionDone << newAction;
-                actionToDoListTransfer.swap(i,lastGoodPositionReal);
-            }
-            else
-            {
-                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("Try move up false, item ")+QString::number(i));
-            }
-            ids.removeOne(actionToDoListTransfer.at(i).id);
-            if(ids.isEmpty())
-            {
-                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"stop with return");
-                return;
-            }
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("move item ")+QString::number(position)+QStringLiteral(" to ")+QString::number(position+1));
+            addActionDone(Ultracopier::MoveItem,actionToDoListTransfer.at(position).id,position,position+1);
+            actionToDoListTransfer.swap(position,position+1);
+            lastFreePosition=position;
         }
         else
         {
-            lastGoodPositionReal=i;
-            haveGoodPosition=true;
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("Try move down false, item ")+QString::number(position));
+            lastFreePosition=position-1;
         }
+        index--;
     }
     sendActionDone();
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"stop");
@@ -1354,28 +1787,18 @@ void ListThread::moveItemsOnBottom(QList<int> ids)
         return;
     }
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"start");
-    //do list operation
+    //do list operation, in the reverse order: the item before the moved item don't change of position
+    const QList<int> &positionList=positionOfIds(ids);
     int lastGoodPositionReal=actionToDoListTransfer.size()-1;
-    for (int i=lastGoodPositionReal; i>=0; --i) {
-        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("Check action on item ")+QString::number(i));
-        if(ids.contains(actionToDoListTransfer.at(i).id))
-        {
-            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("move item ")+QString::number(i)+QStringLiteral(" to ")+QString::number(lastGoodPositionReal));
-            ids.removeOne(actionToDoListTransfer.at(i).id);
-            Ultracopier::ReturnActionOnCopyList newAction;
-            newAction.type=Ultracopier::MoveItem;
-            newAction.addAction.id=actionToDoListTransfer.at(i).id;
-            newAction.userAction.moveAt=lastGoodPositionReal;
-            newAction.userAction.position=i;
-            actionDone << newAction;
-            actionToDoListTransfer.move(i,lastGoodPositionReal);
-            lastGoodPositionReal--;
-            if(ids.isEmpty())
-            {
-                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"stop with return");
-                return;
-            }
-        }
+    int index=positionList.size()-1;
+    while(index>=0)
+    {
+        const int &position=positionList.at(index);
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("move item ")+QString::number(position)+QStringLiteral(" to ")+QString::number(lastGoodPositionReal));
+        addActionDone(Ultracopier::MoveItem,actionToDoListTransfer.at(position).id,position,lastGoodPositionReal);
+        actionToDoListTransfer.move(position,lastGoodPositionReal);
+        lastGoodPositionReal--;
+        index--;
     }
     sendActionDone();
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"stop");
@@ -1396,9 +1819,44 @@ void ListThread::forceMode(const Ultracopier::CopyMode &mode)
     forcedMode=true;
 }
 
+/// \brief write one transfer into the transfer list, return false if not compatible with the forced mode
+bool ListThread::exportTransfer(QFile &transferFile,const ActionToDoTransfer &item) const
+{
+    if(item.mode==Ultracopier::Copy)
+    {
+        if(!forcedMode || mode==Ultracopier::Copy)
+        {
+            if(forcedMode)
+                transferFile.write(QStringLiteral("%1;%2\n").arg(sourcePath(item)).arg(destinationPath(item)).toUtf8());
+            else
+                transferFile.write(QStringLiteral("Copy;%1;%2\n").arg(sourcePath(item)).arg(destinationPath(item)).toUtf8());
+        }
+        else
+            return false;
+    }
+    else if(item.mode==Ultracopier::Move)
+    {
+        if(!forcedMode || mode==Ultracopier::Move)
+        {
+            if(forcedMode)
+                transferFile.write(QStringLiteral("%1;%2\n").arg(sourcePath(item)).arg(destinationPath(item)).toUtf8());
+            else
+                transferFile.write(QStringLiteral("Move;%1;%2\n").arg(sourcePath(item)).arg(destinationPath(item)).toUtf8());
+        }
+        else
+            return false;
+    }
+    return true;
+}
+
 void ListThread::exportTransferList(const QString &fileName)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"start");
+    if(fileName.endsWith(QStringLiteral(TRANSFERLISTFILE_SUFFIX)))
+    {
+        exportBinaryTransferList(fileName);
+        return;
+    }
     QFile transferFile(fileName);
     if(transferFile.open(QIODevice::WriteOnly|QIODevice::Truncate))
     {
@@ -1416,30 +1874,18 @@ void ListThread::exportTransferList(const QString &fileName)
         bool haveError=false;
         int size=actionToDoListTransfer.size();
         for (int index=0;index<size;++index) {
-            if(actionToDoListTransfer.at(index).mode==Ultracopier::Copy)
-            {
-                if(!forcedMode || mode==Ultracopier::Copy)
-                {
-                    if(forcedMode)
-                        transferFile.write(QStringLiteral("%1;%2\n").arg(actionToDoListTransfer.at(index).source.absoluteFilePath()).arg(actionToDoListTransfer.at(index).destination.absoluteFilePath()).toUtf8());
-                    else
-                        transferFile.write(QStringLiteral("Copy;%1;%2\n").arg(actionToDoListTransfer.at(index).source.absoluteFilePath()).arg(actionToDoListTransfer.at(index).destination.absoluteFilePath()).toUtf8());
-                }
-                else
-                    haveError=true;
-            }
-            else if(actionToDoListTransfer.at(index).mode==Ultracopier::Move)
-            {
-                if(!forcedMode || mode==Ultracopier::Move)
-                {
-                    if(forcedMode)
-                        transferFile.write(QStringLiteral("%1;%2\n").arg(actionToDoListTransfer.at(index).source.absoluteFilePath()).arg(actionToDoListTransfer.at(index).destination.absoluteFilePath()).toUtf8());
-                    else
-                        transferFile.write(QStringLiteral("Move;%1;%2\n").arg(actionToDoListTransfer.at(index).source.absoluteFilePath()).arg(actionToDoListTransfer.at(index).destination.absoluteFilePath()).toUtf8());
-                }
-                else
-                    haveError=true;
-            }
+            if(!exportTransfer(transferFile,actionToDoListTransfer.at(index)))
+                haveError=true;
+        }
+        //the tail of the list into the temporary file
+        quint64 offset=transferSpill.firstOffset();
+        QByteArray record;
+        while(transferSpill.readAt(offset,record))
+        {
+            const ActionToDoTransfer &item=actionToDoTransferFromByteArray(record);
+            if(!exportTransfer(transferFile,item))
+                haveError=true;
+            releaseNames(item);
         }
         if(haveError)
         {
@@ -1456,115 +1902,181 @@ void ListThread::exportTransferList(const QString &fileName)
     }
 }
 
+bool ListThread::exportBinaryTransfer(TransferListWriter &writer,const ActionToDoTransfer &item,bool &wrongMode) const
+{
+    if(forcedMode && item.mode!=mode)
+    {
+        wrongMode=true;
+        return true;
+    }
+    TransferListEntry entry;
+    entry.source=sourcePath(item);
+    entry.destination=destinationPath(item);
+    entry.mode=item.mode;
+    entry.size=item.size;
+    entry.mtime=0;
+    return writer.write(entry);
+}
+
+void ListThread::exportBinaryTransferList(const QString &fileName)
+{
+    TransferListMode listMode=TransferListMode_Transfer;
+    if(forcedMode)
+    {
+        if(mode==Ultracopier::Copy)
+            listMode=TransferListMode_Copy;
+        else
+            listMode=TransferListMode_Move;
+    }
+    TransferListWriter writer;
+    //the size is known, the import will not need stat() the source
+    if(!writer.open(fileName,listMode,TransferListFlag_Size))
+    {
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("Unable to save the transfer list: %1").arg(writer.errorString()));
+        emit errorTransferList(tr("Unable to save the transfer list: %1").arg(writer.errorString()));
+        return;
+    }
+    bool haveError=false;
+    bool writeError=false;
+    int size=actionToDoListTransfer.size();
+    for (int index=0;index<size && !writeError;++index) {
+        if(!exportBinaryTransfer(writer,actionToDoListTransfer.at(index),haveError))
+            writeError=true;
+    }
+    //the tail of the list into the temporary file
+    quint64 offset=transferSpill.firstOffset();
+    QByteArray record;
+    while(!writeError && transferSpill.readAt(offset,record))
+    {
+        const ActionToDoTransfer &item=actionToDoTransferFromByteArray(record);
+        if(!exportBinaryTransfer(writer,item,haveError))
+            writeError=true;
+        releaseNames(item);
+    }
+    if(writeError)
+    {
+        //don't keep a truncated list
+        const QString &errorString=writer.errorString();
+        writer.close();
+        QFile::remove(fileName);
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("Unable to save the transfer list: %1").arg(errorString));
+        emit errorTransferList(tr("Unable to save the transfer list: %1").arg(errorString));
+        return;
+    }
+    if(!writer.close())
+    {
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("Unable to save the transfer list: %1").arg(writer.errorString()));
+        emit errorTransferList(tr("Unable to save the transfer list: %1").arg(writer.errorString()));
+        return;
+    }
+    if(haveError)
+    {
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("Unable do to move or copy item into wrong forced mode: %1").arg(fileName));
+        emit errorTransferList(tr("Unable do to move or copy item into wrong forced mode: %1").arg(fileName));
+    }
+}
+
+/** \brief open the binary or the text transfer list
+ * The entries are imported by block like the listing, each one take a transfer slot */
 void ListThread::importTransferList(const QString &fileName)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"start");
-    QFile transferFile(fileName);
-    if(transferFile.open(QIODevice::ReadOnly))
+    if(transferListReader!=NULL)
     {
-        QString content;
-        QByteArray data=transferFile.readLine(64);
-        if(data.size()<=0)
-        {
-            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("Problem reading file, or file-size is 0"));
-            emit errorTransferList(tr("Problem reading file, or file-size is 0"));
-            return;
-        }
-        content=QString::fromUtf8(data);
-        if(content!="Ultracopier;Transfer-list;Transfer;Ultracopier\n" && content!="Ultracopier;Transfer-list;Copy;Ultracopier\n" && content!="Ultracopier;Transfer-list;Move;Ultracopier\n")
-        {
-            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("Wrong header: \"%1\"").arg(content));
-            emit errorTransferList(tr("Wrong header: \"%1\"").arg(content));
-            return;
-        }
-        bool transferListMixedMode=false;
-        if(content=="Ultracopier;Transfer-list;Transfer;Ultracopier\n")
-        {
-            if(forcedMode)
-            {
-                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("The transfer list is in mixed mode, but this instance is not"));
-                emit errorTransferList(tr("The transfer list is in mixed mode, but this instance is not in this mode"));
-                return;
-            }
-            else
-                transferListMixedMode=true;
-        }
-        if(content=="Ultracopier;Transfer-list;Copy;Ultracopier\n" && (forcedMode && mode==Ultracopier::Move))
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("An import of transfer list is already in progress"));
+        emit errorTransferList(tr("An import of transfer list is already in progress"));
+        return;
+    }
+    transferListReader=new TransferListReader();
+    if(!transferListReader->open(fileName))
+    {
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("Unable to open the transfer list: %1").arg(transferListReader->errorString()));
+        emit errorTransferList(tr("Unable to open the transfer list: %1").arg(transferListReader->errorString()));
+        delete transferListReader;
+        transferListReader=NULL;
+        return;
+    }
+    QString error;
+    if(transferListReader->mode()==TransferListMode_Transfer && forcedMode)
+        error=tr("The transfer list is in mixed mode, but this instance is not in this mode");
+    else if(transferListReader->mode()==TransferListMode_Copy && forcedMode && mode==Ultracopier::Move)
+        error=tr("The transfer list is in copy mode, but this instance is not in this mode");
+    else if(transferListReader->mode()==TransferListMode_Move && forcedMode && mode==Ultracopier::Copy)
+        error=tr("The transfer list is in move mode, but this instance is not in this mode");
+    if(!error.isEmpty())
+    {
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("Wrong mode: %1, forcedMode: %2, mode: %3").arg(transferListReader->mode()).arg(forcedMode).arg(mode));
+        emit errorTransferList(error);
+        delete transferListReader;
+        transferListReader=NULL;
+        return;
+    }
+    bool updateTheStatus_copying=actionToDoListTransfer.size()>0 || actionToDoListInode.size()>0 || waitingMovePath.size()>0;
+    if(updateTheStatus_copying)
+        emit actionInProgess(Ultracopier::CopyingAndListing);
+    else
+        emit actionInProgess(Ultracopier::Listing);
+    emit send_importTransferListBlock();
+}
+
+/** \brief import one block of the transfer list
+ * The next block is asked via the event loop, then the transfer events are done between two blocks */
+void ListThread::importTransferListBlock()
+{
+    if(transferListReader==NULL)
+        return;
+    if(stopIt)
+    {
+        delete transferListReader;
+        transferListReader=NULL;
+        return;
+    }
+    const bool haveSize=(transferListReader->flags() & TransferListFlag_Size);
+    TransferListEntry entry;
+    int index=0;
+    while(index<ULTRACOPIER_PLUGIN_TRANSFER_LIST_IMPORT_BLOCK)
+    {
+        //like the listing, one slot by transfer, without block this thread which release them
+        if(!transferSlot.tryAcquire())
         {
-            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("The transfer list is in copy mode, but this instance is not: forcedMode: %1, mode: %2").arg(forcedMode).arg(mode));
-            emit errorTransferList(tr("The transfer list is in copy mode, but this instance is not in this mode"));
+            importWaitTransferSlot=true;
+            sendActionDone();
             return;
         }
-        if(content=="Ultracopier;Transfer-list;Move;Ultracopier\n" && (forcedMode && mode==Ultracopier::Copy))
+        if(!transferListReader->next(entry))
         {
-            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("The transfer list is in move mode, but this instance is not: forcedMode: %1, mode: %2").arg(forcedMode).arg(mode));
-            emit errorTransferList(tr("The transfer list is in move mode, but this instance is not in this mode"));
+            transferSlot.release();
+            importTransferListFinished();
             return;
         }
-
-        bool updateTheStatus_copying=actionToDoListTransfer.size()>0 || actionToDoListInode.size()>0 || actionToDoListInode_afterTheTransfer.size()>0;
-        Ultracopier::EngineActionInProgress updateTheStatus_action_in_progress;
-        if(updateTheStatus_copying)
-            updateTheStatus_action_in_progress=Ultracopier::CopyingAndListing;
+        transferSlotUsed++;
+        Ultracopier::CopyMode tempMode=entry.mode;
+        if(forcedMode)
+            tempMode=mode;
+        if(haveSize)
+            addToTransfer(QFileInfo(entry.source),QFileInfo(entry.destination),tempMode,entry.size);
         else
-            updateTheStatus_action_in_progress=Ultracopier::Listing;
-        emit actionInProgess(updateTheStatus_action_in_progress);
-
-        bool errorFound=false;
-        QRegularExpression correctLine;
-        if(transferListMixedMode)
-            correctLine=QRegularExpression(QStringLiteral("^(Copy|Move);[^;]+;[^;]+[\n\r]*$"));
-        else
-            correctLine=QRegularExpression(QStringLiteral("^[^;]+;[^;]+[\n\r]*$"));
-        QStringList args;
-        Ultracopier::CopyMode tempMode;
-        do
-        {
-            data=transferFile.readLine(65535*2);
-            if(data.size()>0)
-            {
-                content=QString::fromUtf8(data);
-                //do the import here
-                if(content.contains(correctLine))
-                {
-                    content.remove(QStringLiteral("\n"));
-                    args=content.split(QStringLiteral(";"));
-                    if(forcedMode)
-                    {
-                        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("New data to import in forced mode: %2,%3").arg(args.at(0)).arg(args.at(1)));
-                        addToTransfer(QFileInfo(args.at(0)),QFileInfo(args.at(1)),mode);
-                    }
-                    else
-                    {
-                        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("New data to import: %1,%2,%3").arg(args.at(0)).arg(args.at(1)).arg(args.at(2)));
-                        if(args.at(0)==QStringLiteral("Copy"))
-                            tempMode=Ultracopier::Copy;
-                        else
-                            tempMode=Ultracopier::Move;
-                        addToTransfer(QFileInfo(args.at(1)),QFileInfo(args.at(2)),tempMode);
-                    }
-                }
-                else
-                {
-                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("Wrong line syntax: %1").arg(content));
-                    errorFound=true;
-                }
-            }
-        }
-        while(data.size()>0);
-        transferFile.close();
-        if(errorFound)
-            emit warningTransferList(tr("Some errors have been found during the line parsing"));
-
-        updateTheStatus();//->sendActionDone(); into this
-        autoStartAndCheckSpace();
+            addToTransfer(QFileInfo(entry.source),QFileInfo(entry.destination),tempMode);
+        index++;
     }
-    else
+    sendActionDone();
+    emit send_importTransferListBlock();
+}
+
+void ListThread::importTransferListFinished()
+{
+    const bool errorFound=transferListReader->hasError();
+    const QString &errorString=transferListReader->errorString();
+    delete transferListReader;
+    transferListReader=NULL;
+    if(errorFound)
     {
-        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("Unable to open the transfer list: %1").arg(transferFile.errorString()));
-        emit errorTransferList(tr("Unable to open the transfer list: %1").arg(transferFile.errorString()));
-        return;
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("Error into the transfer list: %1").arg(errorString));
+        emit warningTransferList(tr("Some errors have been found during the line parsing"));
     }
+    jobTablesClear();
+    updateTheStatus();//->sendActionDone(); into this
+    autoStartAndCheckSpace();
 }
 
 int ListThread::getNumberOfTranferRuning() const
@@ -1686,10 +2198,9 @@ void ListThread::doNewActions_start_transfer()
 }
 
 /** \brief lunch the pre-op or inode op
-  1) locate the next next item to do into the both list
-    1a) optimisation posible on the mkpath/rmpath
-  2) determine what need be lunched
-  3) lunch it, rerun the 2)
+  1) take the next not running inode action and the next transfer which can start
+  2) lunch the one with the lower id, the transfer need an idle thread
+  3) rerun the 1) while the inode threads are not all used
   */
 void ListThread::doNewActions_inode_manipulation()
 {
@@ -1703,126 +2214,143 @@ void ListThread::doNewActions_inode_manipulation()
     #ifdef ULTRACOPIER_PLUGIN_DEBUG_SCHEDULER
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"start");
     #endif
-    //lunch the pre-op or inode op
-    TransferThread *currentTransferThread;
-    int int_for_loop=0;
-    int int_for_internal_loop=0;
-    int int_for_transfer_thread_search=0;
-    actionToDoListTransfer_count=actionToDoListTransfer.size();
-    actionToDoListInode_count=actionToDoListInode.size();
-    int loop_sub_size_transfer_thread_search=transferThreadList.size();
-    //search the next transfer action to do
-    while(int_for_loop<actionToDoListTransfer_count)
-    {
-        if(!actionToDoListTransfer.at(int_for_loop).isRunning)
+    //lunch the inode op, MkPath have its own threads and do them in the dependency order
+    while(runningInodeAction<actionToDoListInode.size() && runningInodeAction<ULTRACOPIER_PLUGIN_MKPATH_THREADS)
+        startNextInodeAction();
+    //lunch the pre-op
+    int transferPosition=nextPendingTransfer(0);
+    while(numberOfInodeOperation<inodeThreads && transferPosition>=0)
+    {
+        //the inode action added before the transfer is lunched first
+        if(runningInodeAction<actionToDoListInode.size() && actionToDoListInode.at(runningInodeAction).id<actionToDoListTransfer.at(transferPosition).id)
+            break;
+        TransferThread *currentTransferThread=takeIdleTransferThread();
+        if(currentTransferThread==NULL)
         {
-            //search the next inode action to do
-            while(int_for_internal_loop<actionToDoListInode_count)
-            {
-                if(!actionToDoListInode.at(int_for_internal_loop).isRunning)
-                {
-                    if(actionToDoListTransfer.at(int_for_loop).id<actionToDoListInode.at(int_for_internal_loop).id)
-                    {
-                        //do the tranfer action in the next code
-                        break;
-                    }
-                    else
-                    {
-                        //do the inode action
-                        #include "ListThread_InodeAction.cpp"
-                    }
-                }
-                int_for_internal_loop++;
-            }
-            ActionToDoTransfer& currentActionToDoTransfer=actionToDoListTransfer[int_for_loop];
-            //do the tranfer action
-            while(int_for_transfer_thread_search<loop_sub_size_transfer_thread_search)
-            {
-                /**
-                    transferThreadList.at(int_for_transfer_thread_search)->transferId==0) /!\ important!
-                    Because the other thread can have call doNewAction before than this thread have the finish event parsed!
-                    I this case it lose all data
-                    */
-                currentTransferThread=transferThreadList.at(int_for_transfer_thread_search);
-                if(currentTransferThread->getStat()==TransferStat_Idle && currentTransferThread->transferId==0) // /!\ important!
-                {
-                    QString drive=driveManagement.getDrive(actionToDoListTransfer.at(int_for_internal_loop).destination.absoluteFilePath());
-                    if(requiredSpace.contains(drive) && (actionToDoListTransfer.at(int_for_internal_loop).mode!=Ultracopier::Move || drive!=driveManagement.getDrive(actionToDoListTransfer.at(int_for_internal_loop).source.absoluteFilePath())))
-                    {
-                        requiredSpace[drive]-=actionToDoListTransfer.at(int_for_internal_loop).size;
-                        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("space needed removed: %1, space needed: %2, on: %3").arg(actionToDoListTransfer.at(int_for_internal_loop).size).arg(requiredSpace.value(drive)).arg(drive));
-                    }
-                    currentTransferThread->transferId=currentActionToDoTransfer.id;
-                    currentTransferThread->transferSize=currentActionToDoTransfer.size;
-                    if(!currentTransferThread->setFiles(
-                        currentActionToDoTransfer.source,
-                        currentActionToDoTransfer.size,
-                        currentActionToDoTransfer.destination,
-                        currentActionToDoTransfer.mode
-                        ))
-                    {
-                        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("[%1] id: %2 is idle, but seam busy at set name: %3").arg(int_for_loop).arg(currentTransferThread->transferId).arg(currentActionToDoTransfer.destination.absoluteFilePath()));
-                        break;
-                    }
-                    currentActionToDoTransfer.isRunning=true;
-
-                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("[%1] id: %2 is idle, use it for %3").arg(int_for_loop).arg(currentTransferThread->transferId).arg(currentActionToDoTransfer.destination.absoluteFilePath()));
-
-                    /// \note wrong position? Else write why it's here
-                    Ultracopier::ReturnActionOnCopyList newAction;
-                    newAction.type				= Ultracopier::PreOperation;
-                    newAction.addAction.id			= currentActionToDoTransfer.id;
-                    newAction.addAction.sourceFullPath	= currentActionToDoTransfer.source.absoluteFilePath();
-                    newAction.addAction.sourceFileName	= currentActionToDoTransfer.source.fileName();
-                    newAction.addAction.destinationFullPath	= currentActionToDoTransfer.destination.absoluteFilePath();
-                    newAction.addAction.destinationFileName	= currentActionToDoTransfer.destination.fileName();
-                    newAction.addAction.size		= currentActionToDoTransfer.size;
-                    newAction.addAction.mode		= currentActionToDoTransfer.mode;
-                    actionDone << newAction;
-                    int_for_transfer_thread_search++;
-                    numberOfInodeOperation++;
-                    #ifdef ULTRACOPIER_PLUGIN_DEBUG_SCHEDULER
-                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("numberOfInodeOperation: %1").arg(numberOfInodeOperation));
-                    #endif
-                    break;
-                }
-                int_for_transfer_thread_search++;
-            }
-            if(int_for_internal_loop==loop_sub_size_transfer_thread_search)
-            {
-                /// \note Can be normal when all thread is not initialized
-                #ifdef ULTRACOPIER_PLUGIN_DEBUG_SCHEDULER
-                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"unable to found free thread to do the transfer");
-                #endif
-                break;
-            }
+            /// \note Can be normal when all thread is not initialized
             #ifdef ULTRACOPIER_PLUGIN_DEBUG_SCHEDULER
-            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("numberOfInodeOperation: %1").arg(numberOfInodeOperation));
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"unable to found free thread to do the transfer");
             #endif
-            if(numberOfInodeOperation>=inodeThreads)
-                break;
-            if(followTheStrictOrder)
-                break;
+            break;
         }
-        int_for_loop++;
+        ActionToDoTransfer& currentActionToDoTransfer=actionToDoListTransfer[transferPosition];
+        currentTransferThread->transferId=currentActionToDoTransfer.id;
+        currentTransferThread->transferSize=currentActionToDoTransfer.size;
+        if(currentActionToDoTransfer.hardLinkOf!=0)
+            currentTransferThread->setHardLinkTarget(hardLinkDestination.value(currentActionToDoTransfer.hardLinkOf));
+        else
+            currentTransferThread->setHardLinkTarget(QString());
+        if(!currentTransferThread->setFiles(
+            QFileInfo(sourcePath(currentActionToDoTransfer)),
+            currentActionToDoTransfer.size,
+            QFileInfo(destinationPath(currentActionToDoTransfer)),
+            currentActionToDoTransfer.mode
+            ))
+        {
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("[%1] id: %2 is idle, but seam busy at set name: %3").arg(transferPosition).arg(currentTransferThread->transferId).arg(destinationPath(currentActionToDoTransfer)));
+            currentTransferThread->transferId=0;
+            currentTransferThread->transferSize=0;
+            addIdleTransferThread(currentTransferThread);
+            break;
+        }
+        const QString &drive=driveManagement.getDrive(destinationPath(currentActionToDoTransfer));
+        if(requiredSpace.contains(drive) && (currentActionToDoTransfer.mode!=Ultracopier::Move || drive!=driveManagement.getDrive(sourcePath(currentActionToDoTransfer))))
+        {
+            requiredSpace[drive]-=currentActionToDoTransfer.size;
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("space needed removed: %1, space needed: %2, on: %3").arg(currentActionToDoTransfer.size).arg(requiredSpace.value(drive)).arg(drive));
+        }
+        currentActionToDoTransfer.isRunning=true;
+        actionToDoListTransfer.setBlocked(currentActionToDoTransfer.id,true);
+
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("[%1] id: %2 is idle, use it for %3").arg(transferPosition).arg(currentTransferThread->transferId).arg(destinationPath(currentActionToDoTransfer)));
+
+        /// \note wrong position? Else write why it's here
+        addTransferActionDone(Ultracopier::PreOperation,currentActionToDoTransfer);
+        numberOfInodeOperation++;
+        #ifdef ULTRACOPIER_PLUGIN_DEBUG_SCHEDULER
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("numberOfInodeOperation: %1").arg(numberOfInodeOperation));
+        #endif
+        if(followTheStrictOrder)
+            transferPosition=-1;
+        else
+            transferPosition=nextPendingTransfer(transferPosition+1);
     }
-    //search the next inode action to do
-    int_for_internal_loop=0;
-    while(int_for_internal_loop<actionToDoListInode_count)
+}
+
+/** \brief the running transfer and the hard link waiting the end of the first transfer of the same inode are blocked
+ * into the list, then they are not walked */
+int ListThread::nextPendingTransfer(int position) const
+{
+    return actionToDoListTransfer.nextReady(position);
+}
+
+void ListThread::addIdleTransferThread(TransferThread *transferThread)
+{
+    if(idleTransferThreadSet.contains(transferThread))
+        return;
+    idleTransferThreadSet.insert(transferThread);
+    idleTransferThreadList << transferThread;
+}
+
+TransferThread *ListThread::takeIdleTransferThread()
+{
+    int loop_size=idleTransferThreadList.size();
+    while(loop_size>0)
     {
-        if(!actionToDoListInode.at(int_for_internal_loop).isRunning)
+        TransferThread *transferThread=idleTransferThreadList.takeFirst();
+        loop_size--;
+        /**
+            transferThread->transferId==0) /!\ important!
+            Because the other thread can have call doNewAction before than this thread have the finish event parsed!
+            I this case it lose all data
+            */
+        if(transferThread->transferId!=0)
+            idleTransferThreadSet.remove(transferThread);
+        else if(transferThread->getStat()==TransferStat_Idle)
         {
-            //do the inode action
-            #include "ListThread_InodeAction.cpp"
+            idleTransferThreadSet.remove(transferThread);
+            return transferThread;
         }
-        int_for_internal_loop++;
+        else//not finished, retry at the next call
+            idleTransferThreadList << transferThread;
     }
-    //error  checking
-    if(actionToDoListInode_count>inodeThreads)
+    return NULL;
+}
+
+void ListThread::startNextInodeAction()
+{
+    ActionToDoInode& currentActionToDoInode=actionToDoListInode[runningInodeAction];
+    switch(currentActionToDoInode.type)
     {
-        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("The index have been detected as out of max range: %1>%2").arg(actionToDoListInode_count).arg(inodeThreads));
+        case ActionType_RealMove:
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("launch real move, source: %1, destination: %2").arg(currentActionToDoInode.source.absoluteFilePath()).arg(currentActionToDoInode.destination.absoluteFilePath()));
+            mkPathQueue.addPath(currentActionToDoInode.id,currentActionToDoInode.source.absoluteFilePath(),currentActionToDoInode.destination.absoluteFilePath(),currentActionToDoInode.type);
+        break;
+        case ActionType_MkPath:
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("launch mkpath, source: %1, destination: %2").arg(currentActionToDoInode.source.absoluteFilePath()).arg(currentActionToDoInode.destination.absoluteFilePath()));
+            mkPathQueue.addPath(currentActionToDoInode.id,currentActionToDoInode.source.absoluteFilePath(),currentActionToDoInode.destination.absoluteFilePath(),currentActionToDoInode.type);
+        break;
+        #ifdef ULTRACOPIER_PLUGIN_RSYNC
+        case ActionType_RmSync:
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QString("launch rmsync, destination: %1").arg(currentActionToDoInode.destination.absoluteFilePath()));
+            mkPathQueue.addPath(currentActionToDoInode.id,currentActionToDoInode.destination.absoluteFilePath(),currentActionToDoInode.destination.absoluteFilePath(),currentActionToDoInode.type);
+        break;
+        #endif
+        case ActionType_MovePath:
+            //into this list only when the content is moved, see movePathDependency
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("launch rmpath: %1").arg(currentActionToDoInode.source.absoluteFilePath()));
+            mkPathQueue.addPath(currentActionToDoInode.id,currentActionToDoInode.source.absoluteFilePath(),currentActionToDoInode.destination.absoluteFilePath(),currentActionToDoInode.type);
+        break;
+        default:
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("Wrong type at inode action"));
+            actionToDoListInode.removeAt(runningInodeAction);
         return;
     }
+    currentActionToDoInode.isRunning=true;
+    runningInodeAction++;
+    #ifdef ULTRACOPIER_PLUGIN_DEBUG_SCHEDULER
+    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("runningInodeAction: %1").arg(runningInodeAction));
+    #endif
 }
 
 //restart transfer if it can
@@ -1845,7 +2373,7 @@ void ListThread::restartTransferIfItCan()
 void ListThread::newTransferStat(const TransferStat &stat,const quint64 &id)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("TransferStat: %1").arg(stat));
-    Ultracopier::ReturnActionOnCopyList newAction;
+    Ultracopier::ActionTypeCopyList type;
     switch(stat)
     {
         case TransferStat_Idle:
@@ -1858,21 +2386,20 @@ void ListThread::newTransferStat(const TransferStat &stat,const quint64 &id)
             return;
         break;
         case TransferStat_Transfer:
-            newAction.type=Ultracopier::Transfer;
+            type=Ultracopier::Transfer;
         break;
         case TransferStat_PostTransfer:
         case TransferStat_PostOperation:
-            newAction.type=Ultracopier::PostOperation;
+            type=Ultracopier::PostOperation;
         break;
         case TransferStat_Checksum:
-            newAction.type=Ultracopier::CustomOperation;
+            type=Ultracopier::CustomOperation;
         break;
         default:
             return;
         break;
     }
-    newAction.addAction.id			= id;
-    actionDone << newAction;
+    addActionDone(type,id);
 }
 
 void ListThread::set_osBufferLimit(const unsigned int &osBufferLimit)
@@ -1913,13 +2440,17 @@ void ListThread::set_updateMount()
     emit send_updateMount();
 }
 
-void ListThread::mkPathFirstFolderFinish()
+//the folder actions are done in parallel, then not finished in the list order
+void ListThread::mkPathFolderFinish(const quint64 &id)
 {
+    //the running inode actions are at the start of the list, at most ULTRACOPIER_PLUGIN_MKPATH_THREADS
     int int_for_loop=0;
-    const int &loop_size=actionToDoListInode.size();
+    int loop_size=runningInodeAction;
+    if(loop_size>actionToDoListInode.size())
+        loop_size=actionToDoListInode.size();
     while(int_for_loop<loop_size)
     {
-        if(actionToDoListInode.at(int_for_loop).isRunning)
+        if(actionToDoListInode.at(int_for_loop).isRunning && actionToDoListInode.at(int_for_loop).id==id)
         {
             if(actionToDoListInode.at(int_for_loop).type==ActionType_MkPath)
             {
@@ -1927,12 +2458,12 @@ void ListThread::mkPathFirstFolderFinish()
                 emit mkPath(actionToDoListInode.at(int_for_loop).destination.absoluteFilePath());
                 ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("stop mkpath: %1").arg(actionToDoListInode.at(int_for_loop).destination.absoluteFilePath()));
                 actionToDoListInode.removeAt(int_for_loop);
-                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("actionToDoListTransfer.size(): %1, actionToDoListInode: %2, actionToDoListInode_afterTheTransfer: %3").arg(actionToDoListTransfer.size()).arg(actionToDoListInode.size()).arg(actionToDoListInode_afterTheTransfer.size()));
-                if(actionToDoListTransfer.isEmpty() && actionToDoListInode.isEmpty() && actionToDoListInode_afterTheTransfer.isEmpty())
+                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("actionToDoListTransfer.size(): %1, actionToDoListInode: %2, waitingMovePath: %3").arg(actionToDoListTransfer.size()).arg(actionToDoListInode.size()).arg(waitingMovePath.size()));
+                if(actionToDoListTransfer.isEmpty() && actionToDoListInode.isEmpty() && waitingMovePath.isEmpty())
                     updateTheStatus();
-                numberOfInodeOperation--;
+                runningInodeAction--;
                 #ifdef ULTRACOPIER_PLUGIN_DEBUG_SCHEDULER
-                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("numberOfInodeOperation: %1").arg(numberOfInodeOperation));
+                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("runningInodeAction: %1").arg(runningInodeAction));
                 #endif
                 doNewActions_inode_manipulation();
                 return;
@@ -1953,12 +2484,12 @@ void ListThread::mkPathFirstFolderFinish()
                 emit rmPath(actionToDoListInode.at(int_for_loop).source.absoluteFilePath());
                 ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("stop mkpath: %1").arg(actionToDoListInode.at(int_for_loop).destination.absoluteFilePath()));
                 actionToDoListInode.removeAt(int_for_loop);
-                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("actionToDoListTransfer.size(): %1, actionToDoListInode: %2, actionToDoListInode_afterTheTransfer: %3").arg(actionToDoListTransfer.size()).arg(actionToDoListInode.size()).arg(actionToDoListInode_afterTheTransfer.size()));
-                if(actionToDoListTransfer.isEmpty() && actionToDoListInode.isEmpty() && actionToDoListInode_afterTheTransfer.isEmpty())
+                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("actionToDoListTransfer.size(): %1, actionToDoListInode: %2, waitingMovePath: %3").arg(actionToDoListTransfer.size()).arg(actionToDoListInode.size()).arg(waitingMovePath.size()));
+                if(actionToDoListTransfer.isEmpty() && actionToDoListInode.isEmpty() && waitingMovePath.isEmpty())
                     updateTheStatus();
-                numberOfInodeOperation--;
+                runningInodeAction--;
                 #ifdef ULTRACOPIER_PLUGIN_DEBUG_SCHEDULER
-                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("numberOfInodeOperation: %1").arg(numberOfInodeOperation));
+                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("runningInodeAction: %1").arg(runningInodeAction));
                 #endif
                 doNewActions_inode_manipulation();
                 return;
@@ -2020,9 +2551,9 @@ void ListThread::timedUpdateDebugDialog()
     while(index<loop_size)
     {
         newList2 << QStringLiteral("%1 %2 %3")
-            .arg(actionToDoListTransfer.at(index).source.absoluteFilePath())
+            .arg(sourcePath(actionToDoListTransfer.at(index)))
             .arg(actionToDoListTransfer.at(index).size)
-            .arg(actionToDoListTransfer.at(index).destination.absoluteFilePath());
+            .arg(destinationPath(actionToDoListTransfer.at(index)));
         if(index>((inodeThreads+ULTRACOPIER_PLUGIN_MAXPARALLELTRANFER)*2+1))
         {
             newList2 << QStringLiteral("...");
@@ -2176,10 +2707,13 @@ void ListThread::createTransferThread()
     last->start();
     last->setObjectName(QStringLiteral("transfer %1").arg(transferThreadList.size()-1));
     last->setMkpathTransfer(&mkpathTransfer);
+    last->setDestinationFolderCache(&destinationFolderCache);
+    last->setLatencyStats(&latencyStats);
     last->setRenamingRules(firstRenamingRule,otherRenamingRule);
     #ifdef ULTRACOPIER_PLUGIN_DEBUG
     last->setId(transferThreadList.size()-1);
     #endif
+    addIdleTransferThread(last);
     if(transferThreadList.size()>=inodeThreads)
     {
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("create the last of the ")+QString::number(inodeThreads)+QStringLiteral(" transferThread"));
@@ -2202,6 +2736,8 @@ void ListThread::deleteTransferThread()
             if(transferThreadList.at(index)->getStat()==TransferStat_Idle && transferThreadList.at(index)->transferId==0)
             {
                 transferThreadList.at(index)->stop();
+                idleTransferThreadSet.remove(transferThreadList.at(index));
+                idleTransferThreadList.removeOne(transferThreadList.at(index));
                 delete transferThreadList.at(index);//->deleteLayer();
                 transferThreadList[index]=NULL;
                 transferThreadList.removeAt(index);
@@ -2318,6 +2854,11 @@ void ListThread::setCopyListOrder(const bool &order)
         scanFileOrFolderThreadsPool.at(i)->setCopyListOrder(this->copyListOrder);
 }
 
+void ListThread::setPhysicalOrder(const bool &physicalOrder)
+{
+    this->physicalOrder=physicalOrder;
+}
+
 void ListThread::exportErrorIntoTransferList(const QString &fileName)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"start");
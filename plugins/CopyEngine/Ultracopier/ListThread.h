@@ -15,13 +15,25 @@
 #include <QTextStream>
 #include <QFile>
 #include <QTimer>
+#include <QHash>
+#include <QSet>
+#include <QPair>
+#include <QMap>
 
 #include "../../../interface/PluginInterface_CopyEngine.h"
 #include "ScanFileOrFolder.h"
 #include "TransferThread.h"
 #include "MkPath.h"
+#include "PhysicalOrder.h"
 #include "Environment.h"
 #include "DriveManagement.h"
+#include "TransferQueue.h"
+#include "FolderTable.h"
+#include "NameArena.h"
+#include "TransferSpill.h"
+#include "TransferProgress.h"
+#include "TransferListFile.h"
+#include "LatencyHistogram.h"
 
 /// \brief Define the list thread, and management to the action to do
 class ListThread : public QThread
@@ -65,13 +77,29 @@ public:
     {
         quint64 id;
         qint64 size;///< Used to set: used in case of transfer or remainingInode for drop folder
-        QFileInfo source;///< Used to set: source for transfer, folder to create, folder to drop
-        QFileInfo destination;
+        quint32 sourceFolder;///< id into folderTable
+        quint32 destinationFolder;///< id into folderTable
+        quint32 sourceName;///< offset into nameArena
+        quint32 destinationName;///< offset into nameArena, NAMEARENA_NO_NAME if same as sourceName
         Ultracopier::CopyMode mode;
         bool isRunning;///< store if the action si running
+        quint64 hardLinkOf;///< id of the first transfer of the same source inode, 0 if not hard link
         //TransferThread * transfer; // -> see transferThreadList
     };
-    QList<ActionToDoTransfer> actionToDoListTransfer;
+    TransferQueue<ActionToDoTransfer> actionToDoListTransfer;
+    /// \brief the folder of the queued transfer, stored one time
+    FolderTable folderTable;
+    /// \brief the file name of the queued transfer
+    NameArena nameArena;
+    /// \brief the transfer after ULTRACOPIER_PLUGIN_MAX_TRANSFER_IN_MEMORY, not into the list and not shown into the interface
+    TransferSpill transferSpill;
+    /// \brief the transfer list in import, NULL if none
+    TransferListReader *transferListReader;
+    /// \brief the import is stopped until a transfer slot is released
+    bool importWaitTransferSlot;
+    /// \brief taken by the listing thread for each transfer, to block it when too many transfer are waiting
+    QSemaphore transferSlot;
+    int transferSlotUsed;
     /// \brief to store one action to do
     struct ActionToDoInode
     {
@@ -83,8 +111,14 @@ public:
         bool isRunning;///< store if the action si running
     };
     QList<ActionToDoInode> actionToDoListInode;
-    QList<ActionToDoInode> actionToDoListInode_afterTheTransfer;
     int numberOfInodeOperation;
+    /// \brief number of inode action running, they are at the start of actionToDoListInode because the mkpath queue is FIFO
+    int runningInodeAction;
+    /// \brief by source folder, number of transfer in move mode and of rmpath of sub folder not finished
+    QHash<QString,int> movePathDependency;
+    /// \brief the rmpath waiting their dependency, by id to be lunched in order
+    QMap<quint64,ActionToDoInode> waitingMovePath;
+    QHash<QString,quint64> waitingMovePathByFolder;
     struct ErrorLogEntry
     {
         QFileInfo source;
@@ -95,10 +129,14 @@ public:
     QList<ErrorLogEntry> errorLog;
     //dir operation thread queue
     MkPath mkPathQueue;
+    //get the physical offset of the source files
+    PhysicalOrder physicalOrderThread;
     //to get the return value from copyEngine
     bool getReturnBoolToCopyEngine() const;
     QPair<quint64,quint64> getReturnPairQuint64ToCopyEngine() const;
     Ultracopier::ItemOfCopyList getReturnItemOfCopyListToCopyEngine() const;
+    /// \brief the real byte transfered, can be called from any thread without lock
+    quint64 getRealByteTransfered() const;
 
     void set_doChecksum(bool doChecksum);
     void set_checksumIgnoreIfImpossible(bool checksumIgnoreIfImpossible);
@@ -120,6 +158,8 @@ public slots:
     bool skipInternal(const quint64 &id);
     /// \brief cancel all the transfer
     void cancel();
+    /// \brief write the latency histograms of each stage into the debug log, by job and by device
+    void dumpLatency();
     //edit the transfer list
     /** \brief remove the selected item
      * \param ids ids is the id list of the selected items */
@@ -168,10 +208,9 @@ public slots:
     /// \brief do new actions, start transfer
     void doNewActions_start_transfer();
     /** \brief lunch the pre-op or inode op
-      1) locate the next next item to do into the both list
-        1a) optimisation posible on the mkpath/rmpath
-      2) determine what need be lunched
-      3) lunch it, rerun the 2)
+      1) take the next not running inode action and the next transfer which can start
+      2) lunch the one with the lower id, the transfer need an idle thread
+      3) rerun the 1) while the inode threads are not all used
       */
     void doNewActions_inode_manipulation();
     /// \brief restart transfer if it can
@@ -202,9 +241,12 @@ public slots:
     void setRenameTheOriginalDestination(const bool &renameTheOriginalDestination);
     void setCheckDiskSpace(const bool &checkDiskSpace);
     void setCopyListOrder(const bool &order);
+    void setPhysicalOrder(const bool &physicalOrder);
     void exportErrorIntoTransferList(const QString &fileName);
 private:
     QSemaphore          mkpathTransfer;
+    DestinationFolderCache destinationFolderCache;
+    LatencyStats        latencyStats;
     QString             sourceDrive;
     bool                sourceDriveMultiple;
     QString             destinationDrive;
@@ -217,6 +259,9 @@ private:
     QList<ScanFileOrFolder *> scanFileOrFolderThreadsPool;
     int                 numberOfTransferIntoToDoList;
     QList<TransferThread *>		transferThreadList;
+    /// \brief the transfer thread without transfer, the set is to not add twice the same thread
+    QList<TransferThread *>		idleTransferThreadList;
+    QSet<TransferThread *>		idleTransferThreadSet;
     ScanFileOrFolder *		newScanThread(Ultracopier::CopyMode mode);
     quint64				bytesToTransfer;
     quint64				bytesTransfered;
@@ -225,7 +270,8 @@ private:
     bool                rsync;
     #endif
     bool				putInPause;
-    QList<Ultracopier::ReturnActionOnCopyList>	actionDone;///< to action to send to the interface
+    Ultracopier::CopyListEvents	actionDone;///< to action to send to the interface
+    QHash<quint32,quint32>	actionDoneFolderIndex;///< folder id into folderTable to string index into actionDone
     quint64				idIncrementNumber;///< to store the last id returned
     qint64				actualRealByteTransfered;
     int                 maxSpeed;///< in KB/s, assume as 0KB/s as default like every where
@@ -246,6 +292,14 @@ private:
     bool                renameTheOriginalDestination;
     bool                checkDiskSpace;
     bool                copyListOrder;
+    bool                physicalOrder;
+    #ifdef Q_OS_UNIX
+    QHash<QPair<quint64,quint64>,quint64> hardLinkFirstTransfer;///< (device, inode) of the source -> id of the first transfer
+    QHash<quint64,QPair<quint64,quint64> > hardLinkInode;///< id of the first transfer -> (device, inode) of the source, to prune hardLinkFirstTransfer
+    #endif
+    QSet<quint64>       hardLinkPending;///< id of the first transfer of hard link not finished
+    QHash<quint64,QString> hardLinkDestination;///< id of the first transfer of hard link -> destination if correctly finished
+    QHash<quint64,QList<quint64> > hardLinkWaiting;///< id of the first transfer of hard link -> id of the transfer blocked until it's finished
     QHash<QString,quint64> requiredSpace;
     QList<QPair<quint64,quint32> > timeToTransfer;
     unsigned int        putAtBottom;
@@ -265,9 +319,21 @@ private:
     QTimer *clockForTheCopySpeed;	///< For the speed throttling
     #endif
 
-    inline static Ultracopier::ItemOfCopyList actionToDoTransferToItemOfCopyList(const ActionToDoTransfer &actionToDoTransfer);
-    //add file transfer to do
-    quint64 addToTransfer(const QFileInfo& source,const QFileInfo& destination,const Ultracopier::CopyMode& mode);
+    /// \brief add an action without path for the interface
+    void addActionDone(const Ultracopier::ActionTypeCopyList &type,const quint64 &id,const int &position=-1,const int &moveAt=0);
+    /// \brief add an action on the transfer with its paths for the interface
+    void addTransferActionDone(const Ultracopier::ActionTypeCopyList &type,const ActionToDoTransfer &actionToDoTransfer,const int &position=-1,const int &moveAt=0);
+    /// \brief return the string index of the folder into actionDone, added only one time by batch
+    quint32 actionDoneFolder(const quint32 &folderId);
+    QString sourcePath(const ActionToDoTransfer &actionToDoTransfer) const;
+    QString destinationPath(const ActionToDoTransfer &actionToDoTransfer) const;
+    QString destinationName(const ActionToDoTransfer &actionToDoTransfer) const;
+    /// \brief the names of this transfer are not used anymore, the name buffer is compacted if needed
+    void releaseNames(const ActionToDoTransfer &actionToDoTransfer);
+    /// \brief add again the names of the transfer list into a new buffer, without the released names
+    void compactNames();
+    //add file transfer to do, the size is taken from the source if knownSize is -1
+    quint64 addToTransfer(const QFileInfo& source,const QFileInfo& destination,const Ultracopier::CopyMode& mode,const qint64 &knownSize=-1);
     //generate id number
     quint64 generateIdNumber();
     //warning the first entry is accessible will copy
@@ -289,12 +355,15 @@ private:
     void detectDrivesOfCurrentTransfer(const QStringList &sources,const QString &destination);
     FacilityInterface * facilityInterface;
     QSemaphore waitConstructor,waitCancel;
-    int actionToDoListTransfer_count,actionToDoListInode_count;
     bool doTransfer,doInode;
     qint64 oversize;//used as temp variable
     qint64 currentProgression;
     qint64 copiedSize,totalSize,localOverSize;
     QList<Ultracopier::ProgressionItem> progressionList;
+    //the last progression sent, to send only what have changed
+    QHash<quint64,Ultracopier::ProgressionItem> lastProgression,newProgression;
+    quint64 lastGeneralCurrent,lastGeneralTotal;
+    ProgressSnapshot progressSnapshot;
     //memory variable for transfer thread creation
     bool doRightTransfer;
     bool keepDate;
@@ -311,17 +380,61 @@ private:
     Ultracopier::ItemOfCopyList returnItemOfCopyListToCopyEngine;
     Ultracopier::ProgressionItem tempItem;
 
-    void realByteTransfered();
+    quint64 realByteTransfered() const;
     int getNumberOfTranferRuning() const;
     bool needMoreSpace() const;
+    #ifdef Q_OS_UNIX
+    /// \brief return the id of the first transfer of the same source inode (st_dev and st_ino), 0 if it's the first
+    quint64 hardLinkFirstTransferId(const QFileInfo &source,const quint64 &device,const quint64 &inode,const quint64 &id);
+    #endif
+    /// \brief drop the hard link tables of this first transfer, the next link of this inode will be copied, return true if it was pending
+    bool hardLinkForget(const quint64 &id);
+    /// \brief drop all the hard link tables, when no transfer remain
+    void hardLinkClear();
+    /// \brief drop the hard link tables and the reserved names at the job end: no transfer, no listing, no import and no spill
+    void jobTablesClear();
+    /// \brief block the transfer put into the list if it wait the first transfer of its inode
+    void hardLinkWait(const ActionToDoTransfer &item);
+    /// \brief unblock the transfer which wait this first transfer
+    void hardLinkUnblock(const quint64 &id);
+    /// \brief sort the not running transfer by physical position on the source disk, to minimize the head seek
+    void sortTransferByPhysicalOffset();
+    /// \brief return the current position of the ids into the transfer list, sorted
+    QList<int> positionOfIds(const QList<int> &ids) const;
+    /** \brief remove the transfer of the list, load the transfer of the temporary file when the list have space, and give back the slot to the listing
+     * \return true if an rmpath is now ready to be lunched */
+    bool removeTransferAt(const int &position);
+    /// \brief return the position of the next transfer to start, -1 if none
+    int nextPendingTransfer(int position) const;
+    void addIdleTransferThread(TransferThread *transferThread);
+    /// \brief return an idle transfer thread, NULL if none
+    TransferThread *takeIdleTransferThread();
+    /// \brief lunch the first not running inode action
+    void startNextInodeAction();
+    /// \brief one dependency of the rmpath of this folder is finished, return true if the rmpath is now ready
+    bool movePathDependencyDone(const QString &folder);
+    /// \brief put all the waiting rmpath into the inode action list
+    void releaseWaitingMovePath();
+    QByteArray actionToDoTransferToByteArray(const ActionToDoTransfer &actionToDoTransfer) const;
+    /// \brief the names are added into nameArena, need releaseNames() if not put into the list
+    ActionToDoTransfer actionToDoTransferFromByteArray(const QByteArray &record);
+    bool exportTransfer(QFile &transferFile,const ActionToDoTransfer &item) const;
+    /// \brief write one transfer, return false if the write have failed, set wrongMode if not compatible with the forced mode
+    bool exportBinaryTransfer(TransferListWriter &writer,const ActionToDoTransfer &item,bool &wrongMode) const;
+    void exportBinaryTransferList(const QString &fileName);
+    void importTransferListFinished();
 private slots:
+    /// \brief import the next block of the transfer list
+    void importTransferListBlock();
     void scanThreadHaveFinishSlot();
     void scanThreadHaveFinish(bool skipFirstRemove=false);
     void autoStartAndCheckSpace();
     void updateTheStatus();
     void fileTransfer(const QFileInfo &sourceFileInfo,const QFileInfo &destinationFileInfo,const Ultracopier::CopyMode &mode);
     //mkpath event
-    void mkPathFirstFolderFinish();
+    void mkPathFolderFinish(const quint64 &id);
+    /// \brief move the transfer not running to the order by physical offset
+    void physicalOrderSorted(const QList<quint64> &sortedIdList);
     /** \brief put the current file at bottom in case of error
     \note ONLY IN CASE OF ERROR */
     void transferPutAtBottom();
@@ -363,7 +476,7 @@ signals:
     //send information about the copy
     void actionInProgess(const Ultracopier::EngineActionInProgress &) const;	//should update interface information on this event
 
-    void newActionOnList(const QList<Ultracopier::ReturnActionOnCopyList> &) const;///very important, need be temporized to group the modification to do and not flood the interface
+    void newActionOnList(const Ultracopier::CopyListEvents &) const;///very important, need be temporized to group the modification to do and not flood the interface
     void syncReady() const;
     void doneTime(const QList<QPair<quint64,quint32> >&) const;
 
@@ -408,6 +521,7 @@ signals:
     void send_errorOnFolder(const QFileInfo &fileInfo,const QString &errorString,ScanFileOrFolder * thread, const ErrorType &errorType) const;
     //send the progression
     void send_syncTransferList() const;
+    void send_importTransferListBlock() const;
     //mkpath error event
     void mkPathErrorOnFolder(const QFileInfo &fileInfo,const QString &errorString,const ErrorType &errorType) const;
     //to close
@@ -418,7 +532,6 @@ signals:
     void warningTransferList(const QString &warning) const;
     void errorTransferList(const QString &error) const;
     void send_sendNewRenamingRules(const QString &firstRenamingRule,const QString &otherRenamingRule) const;
-    void send_realBytesTransfered(const quint64 &) const;
 
     void send_setTransferAlgorithm(TransferAlgorithm transferAlgorithm) const;
     void send_parallelBuffer(const int &parallelBuffer) const;
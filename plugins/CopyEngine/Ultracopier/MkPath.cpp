@@ -1,30 +1,18 @@
 #include "MkPath.h"
 
-#ifdef Q_OS_WIN32
-    #ifndef ULTRACOPIER_PLUGIN_SET_TIME_UNIX_WAY
-        #ifndef NOMINMAX
-            #define NOMINMAX
-        #endif
-        #include <windows.h>
-    #endif
-#endif
+#include <QDir>
 
 QString MkPath::text_slash=QLatin1Literal("/");
 
 MkPath::MkPath()
 {
     stopIt=false;
-    waitAction=false;
     doRightTransfer=false;
-    maxTime=QDateTime(QDate(ULTRACOPIER_PLUGIN_MINIMALYEAR,1,1));
+    keepDate=false;
+    destinationFolderCache=NULL;
     setObjectName("MkPath");
     moveToThread(this);
     start();
-    #ifdef Q_OS_WIN32
-        #ifndef ULTRACOPIER_PLUGIN_SET_TIME_UNIX_WAY
-            regRead=QRegularExpression(QStringLiteral("^[a-z]:"));
-        #endif
-    #endif
 }
 
 MkPath::~MkPath()
@@ -32,14 +20,28 @@ MkPath::~MkPath()
     stopIt=true;
     quit();
     wait();
+    int index=0;
+    while(index<workerList.size())
+    {
+        workerList.at(index)->stop();
+        delete workerList.at(index);
+        index++;
+    }
+    workerList.clear();
+    idleWorkerList.clear();
 }
 
-void MkPath::addPath(const QFileInfo& source, const QFileInfo& destination, const ActionType &actionType)
+void MkPath::addPath(const quint64 &id,const QFileInfo& source, const QFileInfo& destination, const ActionType &actionType)
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("source: %1, destination: %2").arg(source.absoluteFilePath()).arg(destination.absoluteFilePath()));
     if(stopIt)
         return;
-    emit internalStartAddPath(source,destination,actionType);
+    emit internalStartAddPath(id,source,destination,actionType);
+}
+
+void MkPath::setDestinationFolderCache(DestinationFolderCache *destinationFolderCache)
+{
+    this->destinationFolderCache=destinationFolderCache;
 }
 
 void MkPath::skip()
@@ -57,460 +59,206 @@ void MkPath::retry()
 void MkPath::run()
 {
     connect(this,&MkPath::internalStartAddPath,     this,&MkPath::internalAddPath,Qt::QueuedConnection);
-    connect(this,&MkPath::internalStartDoThisPath,	this,&MkPath::internalDoThisPath,Qt::QueuedConnection);
     connect(this,&MkPath::internalStartSkip,        this,&MkPath::internalSkip,Qt::QueuedConnection);
     connect(this,&MkPath::internalStartRetry,       this,&MkPath::internalRetry,Qt::QueuedConnection);
     exec();
 }
 
-void MkPath::internalDoThisPath()
+void MkPath::internalAddPath(const quint64 &id,const QFileInfo& source, const QFileInfo& destination, const ActionType &actionType)
 {
-    if(waitAction || pathList.isEmpty())
-        return;
-    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("source: %1, destination: %2, move: %3").arg(pathList.first().source.absoluteFilePath()).arg(pathList.first().destination.absoluteFilePath()).arg(pathList.first().actionType));
-    #ifdef ULTRACOPIER_PLUGIN_RSYNC
-    if(pathList.first().actionType==ActionType_RmSync)
+    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("id: %1, source: %2, destination: %3").arg(id).arg(source.absoluteFilePath()).arg(destination.absoluteFilePath()));
+    Item tempPath;
+    tempPath.id=id;
+    tempPath.source=source;
+    tempPath.destination=destination;
+    tempPath.actionType=actionType;
+    tempPath.worker=NULL;
+    tempPath.inError=false;
+    //the real move and the move of the content change the two folders, cleaned to be compared with /
+    if(actionType==ActionType_RealMove || actionType==ActionType_MovePath)
+        tempPath.paths << QDir::cleanPath(QDir::fromNativeSeparators(source.absoluteFilePath()));
+    tempPath.paths << QDir::cleanPath(QDir::fromNativeSeparators(destination.absoluteFilePath()));
+    pathList << tempPath;
+    startReadyItems();
+}
+
+int MkPath::indexOfId(const quint64 &id) const
+{
+    int index=0;
+    while(index<pathList.size())
     {
-        if(pathList.first().destination.isFile())
-        {
-            QFile removedFile(pathList.first().destination.absoluteFilePath());
-            if(!removedFile.remove())
-            {
-                if(stopIt)
-                    return;
-                waitAction=true;
-                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to remove the inode: "+pathList.first().destination.absoluteFilePath()+", error: "+removedFile.errorString());
-                emit errorOnFolder(pathList.first().destination,removedFile.errorString());
-                return;
-            }
-        }
-        else if(!rmpath(pathList.first().destination.absoluteFilePath()))
-        {
-            if(stopIt)
-                return;
-            waitAction=true;
-            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to remove the inode: "+pathList.first().destination.absoluteFilePath());
-            emit errorOnFolder(pathList.first().destination,tr("Unable to remove"));
-            return;
-        }
-        pathList.removeFirst();
-        emit firstFolderFinish();
-        checkIfCanDoTheNext();
-        return;
+        if(pathList.at(index).id==id)
+            return index;
+        index++;
     }
-    #endif
-    doTheDateTransfer=false;
-    if(keepDate)
+    return -1;
+}
+
+bool MkPath::isParentOrSame(const QString &parent,const QString &path)
+{
+    if(!path.startsWith(parent))
+        return false;
+    if(path.size()==parent.size() || parent.endsWith(text_slash))
+        return true;
+    //only on full folder name: /a/b is not the parent of /a/bc, the paths are cleaned then the separator is /
+    return path.at(parent.size())==QLatin1Char('/');
+}
+
+bool MkPath::dependOn(const Item &item,const Item &previous)
+{
+    int index=0;
+    while(index<item.paths.size())
     {
-        if(!pathList.first().source.exists())
-        {
-            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"the sources not exists: "+pathList.first().source.absoluteFilePath());
-            doTheDateTransfer=false;
-        }
-        else if(maxTime>=pathList.first().source.lastModified())
+        const QString &path=item.paths.at(index);
+        int previousIndex=0;
+        while(previousIndex<previous.paths.size())
         {
-            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"the sources is older to copy the time: "+pathList.first().source.absoluteFilePath()+": "+maxTime.toString("dd.MM.yyyy hh:mm:ss.zzz")+">="+pathList.first().source.lastModified().toString("dd.MM.yyyy hh:mm:ss.zzz"));
-            doTheDateTransfer=false;
-        }
-        else
-        {
-            doTheDateTransfer=readFileDateTime(pathList.first().source);
-            /*if(!doTheDateTransfer)
-            {
-                if(stopIt)
-                    return;
-                waitAction=true;
-                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to get source folder time: "+pathList.first().source.absoluteFilePath());
-                emit errorOnFolder(pathList.first().source,tr("Unable to get time"));
-                return;
-            }*/
+            const QString &previousPath=previous.paths.at(previousIndex);
+            if(isParentOrSame(previousPath,path) || isParentOrSame(path,previousPath))
+                return true;
+            previousIndex++;
         }
+        index++;
     }
-    if(dir.exists(pathList.first().destination.absoluteFilePath()) && pathList.first().actionType==ActionType_RealMove)
-        pathList.first().actionType=ActionType_MovePath;
-    if(pathList.first().actionType!=ActionType_RealMove)
-    {
-        if(!dir.exists(pathList.first().destination.absoluteFilePath()))
-            if(!dir.mkpath(pathList.first().destination.absoluteFilePath()))
-            {
-                if(!dir.exists(pathList.first().destination.absoluteFilePath()))
-                {
-                    if(stopIt)
-                        return;
-                    waitAction=true;
-                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to make the folder: "+pathList.first().destination.absoluteFilePath());
-                    emit errorOnFolder(pathList.first().destination,tr("Unable to create the folder"));
-                    return;
-                }
-            }
-    }
-    else
+    return false;
+}
+
+MkPathWorker *MkPath::takeIdleWorker()
+{
+    if(!idleWorkerList.isEmpty())
+        return idleWorkerList.takeLast();
+    if(workerList.size()>=ULTRACOPIER_PLUGIN_MKPATH_THREADS)
+        return NULL;
+    MkPathWorker *worker=new MkPathWorker(destinationFolderCache);
+    connect(worker,&MkPathWorker::finished,         this,&MkPath::workerFinished,Qt::QueuedConnection);
+    connect(worker,&MkPathWorker::errorOnFolder,    this,&MkPath::workerErrorOnFolder,Qt::QueuedConnection);
+    #ifdef ULTRACOPIER_PLUGIN_DEBUG
+    connect(worker,&MkPathWorker::debugInformation, this,&MkPath::debugInformation,Qt::QueuedConnection);
+    #endif
+    workerList << worker;
+    return worker;
+}
+
+void MkPath::startReadyItems()
+{
+    if(stopIt)
+        return;
+    int index=0;
+    while(index<pathList.size())
     {
-        if(!pathList.first().source.exists())
+        Item &item=pathList[index];
+        if(item.worker==NULL && !item.inError)
         {
-            if(stopIt)
-                return;
-            waitAction=true;
-            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"The source folder don't exists: "+pathList.first().source.absoluteFilePath());
-            emit errorOnFolder(pathList.first().destination,tr("The source folder don't exists"));
-            return;
-        }
-        if(!pathList.first().source.isDir())//it's really an error?
-        {
-            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"The source is not a folder: "+pathList.first().source.absoluteFilePath());
-            /*if(stopIt)
-                return;
-            waitAction=true;
-            emit errorOnFolder(pathList.first().destination,tr("The source is not a folder"));
-            return;*/
-        }
-        if(pathList.first().destination.absoluteFilePath().startsWith(pathList.first().source.absoluteFilePath()+text_slash))
-        {
-            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"move into it self: "+pathList.first().destination.absoluteFilePath());
-            int random=rand();
-            QFileInfo tempFolder=pathList.first().source.absolutePath()+text_slash+QString::number(random);
-            while(tempFolder.exists())
-            {
-                random=rand();
-                tempFolder=pathList.first().source.absolutePath()+text_slash+QString::number(random);
-            }
-            if(!dir.rename(pathList.first().source.absoluteFilePath(),tempFolder.absoluteFilePath()))
+            //wait the previous action on the same sub-tree, in the add order
+            bool ready=true;
+            int previousIndex=0;
+            while(previousIndex<index)
             {
-                if(stopIt)
-                    return;
-                waitAction=true;
-                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to temporary rename the folder: "+pathList.first().destination.absoluteFilePath());
-                emit errorOnFolder(pathList.first().destination,tr("Unable to temporary rename the folder"));
-                return;
-            }
-            /* http://doc.qt.io/qt-5/qdir.html#rename
-             * On most file systems, rename() fails only if oldName does not exist, or if a file with the new name already exists.
-            if(!dir.mkpath(pathList.first().destination.absolutePath()))
-            {
-                if(!dir.exists(pathList.first().destination.absolutePath()))
+                if(dependOn(item,pathList.at(previousIndex)))
                 {
-                    if(stopIt)
-                        return;
-                    waitAction=true;
-                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to make the folder: "+pathList.first().destination.absoluteFilePath());
-                    emit errorOnFolder(pathList.first().destination,tr("Unable to create the folder"));
-                    return;
+                    ready=false;
+                    break;
                 }
-            }*/
-            if(!dir.rename(tempFolder.absoluteFilePath(),pathList.first().destination.absoluteFilePath()))
-            {
-                if(stopIt)
-                    return;
-                waitAction=true;
-                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to do the final real move the folder: "+pathList.first().destination.absoluteFilePath());
-                emit errorOnFolder(pathList.first().destination,tr("Unable to do the final real move the folder"));
-                return;
+                previousIndex++;
             }
-        }
-        else
-        {
-            /* http://doc.qt.io/qt-5/qdir.html#rename
-             * On most file systems, rename() fails only if oldName does not exist, or if a file with the new name already exists.
-            if(!dir.mkpath(pathList.first().destination.absolutePath()))
+            if(ready)
             {
-                if(!dir.exists(pathList.first().destination.absolutePath()))
-                {
-                    if(stopIt)
-                        return;
-                    waitAction=true;
-                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to make the folder: "+pathList.first().destination.absoluteFilePath());
-                    emit errorOnFolder(pathList.first().destination,tr("Unable to create the folder"));
+                MkPathWorker *worker=takeIdleWorker();
+                if(worker==NULL)
                     return;
-                }
-            }*/
-            if(!dir.rename(pathList.first().source.absoluteFilePath(),pathList.first().destination.absoluteFilePath()))
-            {
-                if(stopIt)
-                    return;
-                waitAction=true;
-                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to make the folder: from: "+pathList.first().source.absoluteFilePath()+", soruce exists: "+QString::number(QDir(pathList.first().source.absoluteFilePath()).exists())+", to: "+pathList.first().destination.absoluteFilePath()+", destination exist: "+QString::number(QDir(pathList.first().destination.absoluteFilePath()).exists()));
-                emit errorOnFolder(pathList.first().destination,tr("Unable to move the folder"));
-                return;
+                item.worker=worker;
+                worker->doThisPath(item.id,item.source,item.destination,item.actionType,doRightTransfer,keepDate);
             }
         }
+        index++;
     }
-    if(doTheDateTransfer)
-        if(!writeFileDateTime(pathList.first().destination))
-        {
-            if(!pathList.first().destination.exists())
-                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to set destination folder time (not exists): "+pathList.first().destination.absoluteFilePath());
-            else if(!pathList.first().destination.isDir())
-                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to set destination folder time (not a dir): "+pathList.first().destination.absoluteFilePath());
-            else
-                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to set destination folder time: "+pathList.first().destination.absoluteFilePath());
-            /*if(stopIt)
-                return;
-            waitAction=true;
-
-            emit errorOnFolder(pathList.first().source,tr("Unable to set time"));
-            return;*/
-        }
-    if(doRightTransfer && pathList.first().actionType!=ActionType_RealMove)
-    {
-        QFile source(pathList.first().source.absoluteFilePath());
-        QFile destination(pathList.first().destination.absoluteFilePath());
-        if(!destination.setPermissions(source.permissions()))
-        {
-            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to set the right: "+pathList.first().destination.absoluteFilePath());
-            /*if(stopIt)
-                return;
-            waitAction=true;
-            emit errorOnFolder(pathList.first().source,tr("Unable to set the access-right"));
-            return;*/
-        }
-    }
-    if(pathList.first().actionType==ActionType_MovePath)
-    {
-        if(!rmpath(pathList.first().source.absoluteFilePath()))
-        {
-            if(stopIt)
-                return;
-            waitAction=true;
-            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to remove the source folder: "+pathList.first().destination.absoluteFilePath());
-            emit errorOnFolder(pathList.first().source,tr("Unable to remove"));
-            return;
-        }
-    }
-    pathList.removeFirst();
-    emit firstFolderFinish();
-    checkIfCanDoTheNext();
 }
 
-void MkPath::internalAddPath(const QFileInfo& source, const QFileInfo& destination, const ActionType &actionType)
+void MkPath::workerFinished(const quint64 &id)
 {
-    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("source: %1, destination: %2").arg(source.absoluteFilePath()).arg(destination.absoluteFilePath()));
-    Item tempPath;
-    tempPath.source=source;
-    tempPath.destination=destination;
-    tempPath.actionType=actionType;
-    pathList << tempPath;
-    if(!waitAction)
-        checkIfCanDoTheNext();
+    const int index=indexOfId(id);
+    if(index==-1)
+    {
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,QStringLiteral("unable to found the id: %1").arg(id));
+        return;
+    }
+    idleWorkerList << pathList.at(index).worker;
+    pathList.removeAt(index);
+    emit folderFinish(id);
+    startReadyItems();
 }
 
-void MkPath::checkIfCanDoTheNext()
+void MkPath::workerErrorOnFolder(const quint64 &id,const QFileInfo &fileInfo,const QString &errorString)
 {
-    if(!waitAction && !stopIt && pathList.size()>0)
-        emit internalStartDoThisPath();
+    const int index=indexOfId(id);
+    if(index==-1)
+    {
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,QStringLiteral("unable to found the id: %1").arg(id));
+        return;
+    }
+    Item &item=pathList[index];
+    idleWorkerList << item.worker;
+    item.worker=NULL;
+    item.inError=true;
+    item.errorFileInfo=fileInfo;
+    item.errorString=errorString;
+    errorList << id;
+    //one error at time to the user, the action which don't depend on it continue
+    if(errorList.size()==1)
+        emit errorOnFolder(fileInfo,errorString);
+    startReadyItems();
 }
 
 void MkPath::internalSkip()
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"start");
-    waitAction=false;
-    pathList.removeFirst();
-    emit firstFolderFinish();
-    checkIfCanDoTheNext();
+    if(errorList.isEmpty())
+        return;
+    const quint64 id=errorList.takeFirst();
+    const int index=indexOfId(id);
+    if(index!=-1)
+    {
+        pathList.removeAt(index);
+        emit folderFinish(id);
+    }
+    showNextError();
+    startReadyItems();
 }
 
 void MkPath::internalRetry()
 {
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"start");
-    waitAction=false;
-    checkIfCanDoTheNext();
-}
-
-void MkPath::setRightTransfer(const bool doRightTransfer)
-{
-    this->doRightTransfer=doRightTransfer;
-}
-
-void MkPath::setKeepDate(const bool keepDate)
-{
-    this->keepDate=keepDate;
+    if(errorList.isEmpty())
+        return;
+    const int index=indexOfId(errorList.takeFirst());
+    if(index!=-1)
+        pathList[index].inError=false;
+    showNextError();
+    startReadyItems();
 }
 
-bool MkPath::rmpath(const QDir &dir
-                    #ifdef ULTRACOPIER_PLUGIN_RSYNC
-                    ,const bool &toSync
-                    #endif
-                    )
+void MkPath::showNextError()
 {
-    if(!dir.exists())
-        return true;
-    bool allHaveWork=true;
-    QFileInfoList list = dir.entryInfoList(QDir::AllEntries|QDir::NoDotAndDotDot|QDir::Hidden|QDir::System,QDir::DirsFirst);
-    for (int i = 0; i < list.size(); ++i)
+    while(!errorList.isEmpty())
     {
-        QFileInfo fileInfo(list.at(i));
-        if(!fileInfo.isDir())
-        {
-            #ifdef ULTRACOPIER_PLUGIN_RSYNC
-            if(toSync)
-            {
-                QFile file(fileInfo.absoluteFilePath());
-                if(!file.remove())
-                {
-                    if(toSync)
-                    {
-                        QFile file(fileInfo.absoluteFilePath());
-                        if(!file.remove())
-                        {
-                            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"unable to remove a file: "+fileInfo.absoluteFilePath()+", due to: "+file.errorString());
-                            allHaveWork=false;
-                        }
-                    }
-                    else
-                    {
-                        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"found a file: "+fileInfo.fileName());
-                        allHaveWork=false;
-                    }
-                }
-            }
-            else
-            {
-                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"found a file: "+fileInfo.fileName());
-                allHaveWork=false;
-            }
-            #else
-            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"found a file: "+fileInfo.fileName());
-            allHaveWork=false;
-            #endif
-        }
-        else
+        const int index=indexOfId(errorList.first());
+        if(index!=-1)
         {
-            //return the fonction for scan the new folder
-            if(!rmpath(dir.absolutePath()+'/'+fileInfo.fileName()+'/'))
-                allHaveWork=false;
+            const Item &item=pathList.at(index);
+            emit errorOnFolder(item.errorFileInfo,item.errorString);
+            return;
         }
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,QStringLiteral("the id in error is not found: %1").arg(errorList.first()));
+        errorList.removeFirst();
     }
-    if(!allHaveWork)
-        return false;
-    allHaveWork=dir.rmdir(dir.absolutePath());
-    if(!allHaveWork)
-        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"unable to remove the folder: "+dir.absolutePath());
-    return allHaveWork;
 }
 
-//fonction to edit the file date time
-bool MkPath::readFileDateTime(const QFileInfo &source)
+void MkPath::setRightTransfer(const bool doRightTransfer)
 {
-    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"readFileDateTime("+source.absoluteFilePath()+")");
-    /** Why not do it with Qt? Because it not support setModificationTime(), and get the time with Qt, that's mean use local time where in C is UTC time */
-    #ifdef Q_OS_UNIX
-        #ifdef Q_OS_LINUX
-            struct stat info;
-            if(stat(source.absoluteFilePath().toLatin1().data(),&info)!=0)
-                return false;
-            time_t ctime=info.st_ctim.tv_sec;
-            time_t actime=info.st_atim.tv_sec;
-            time_t modtime=info.st_mtim.tv_sec;
-            //this function avalaible on unix and mingw
-            butime.actime=actime;
-            butime.modtime=modtime;
-            Q_UNUSED(ctime);
-            return true;
-        #else //mainly for mac
-            QFileInfo fileInfo(source);
-            time_t ctime=fileInfo.created().toTime_t();
-            time_t actime=fileInfo.lastRead().toTime_t();
-            time_t modtime=fileInfo.lastModified().toTime_t();
-            //this function avalaible on unix and mingw
-            utimbuf butime;
-            butime.actime=actime;
-            butime.modtime=modtime;
-            Q_UNUSED(ctime);
-            return true;
-        #endif
-    #else
-        #ifdef Q_OS_WIN32
-            #ifdef ULTRACOPIER_PLUGIN_SET_TIME_UNIX_WAY
-                struct stat info;
-                if(stat(source.toLatin1().data(),&info)!=0)
-                    return false;
-                time_t ctime=info.st_ctim.tv_sec;
-                time_t actime=info.st_atim.tv_sec;
-                time_t modtime=info.st_mtim.tv_sec;
-                //this function avalaible on unix and mingw
-                butime.actime=actime;
-                butime.modtime=modtime;
-                Q_UNUSED(ctime);
-                return true;
-            #else
-                wchar_t filePath[65535];
-                if(source.absoluteFilePath().contains(regRead))
-                    filePath[QDir::toNativeSeparators(QStringLiteral("\\\\?\\")+source.absoluteFilePath()).toWCharArray(filePath)]=L'\0';
-                else
-                    filePath[QDir::toNativeSeparators(source.absoluteFilePath()).toWCharArray(filePath)]=L'\0';
-                HANDLE hFileSouce = CreateFileW(filePath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_READONLY | FILE_FLAG_BACKUP_SEMANTICS, NULL);
-                if(hFileSouce == INVALID_HANDLE_VALUE)
-                {
-                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"open failed to read: "+QString::fromWCharArray(filePath)+", error: "+QString::number(GetLastError()));
-                    return false;
-                }
-                FILETIME ftCreate, ftAccess, ftWrite;
-                if(!GetFileTime(hFileSouce, &ftCreate, &ftAccess, &ftWrite))
-                {
-                    CloseHandle(hFileSouce);
-                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"unable to get the file time");
-                    return false;
-                }
-                this->ftCreateL=ftCreate.dwLowDateTime;
-                this->ftCreateH=ftCreate.dwHighDateTime;
-                this->ftAccessL=ftAccess.dwLowDateTime;
-                this->ftAccessH=ftAccess.dwHighDateTime;
-                this->ftWriteL=ftWrite.dwLowDateTime;
-                this->ftWriteH=ftWrite.dwHighDateTime;
-                CloseHandle(hFileSouce);
-                return true;
-            #endif
-        #else
-            return false;
-        #endif
-    #endif
-    return false;
+    this->doRightTransfer=doRightTransfer;
 }
 
-bool MkPath::writeFileDateTime(const QFileInfo &destination)
+void MkPath::setKeepDate(const bool keepDate)
 {
-    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"writeFileDateTime("+destination.absoluteFilePath()+")");
-    /** Why not do it with Qt? Because it not support setModificationTime(), and get the time with Qt, that's mean use local time where in C is UTC time */
-    #ifdef Q_OS_UNIX
-        #ifdef Q_OS_LINUX
-            return utime(destination.absoluteFilePath().toLatin1().data(),&butime)==0;
-        #else //mainly for mac
-            return utime(destination.absoluteFilePath().toLatin1().data(),&butime)==0;
-        #endif
-    #else
-        #ifdef Q_OS_WIN32
-            #ifdef ULTRACOPIER_PLUGIN_SET_TIME_UNIX_WAY
-                return utime(destination.toLatin1().data(),&butime)==0;
-            #else
-                wchar_t filePath[65535];
-                if(destination.absoluteFilePath().contains(regRead))
-                    filePath[QDir::toNativeSeparators(QStringLiteral("\\\\?\\")+destination.absoluteFilePath()).toWCharArray(filePath)]=L'\0';
-                else
-                    filePath[QDir::toNativeSeparators(destination.absoluteFilePath()).toWCharArray(filePath)]=L'\0';
-                HANDLE hFileDestination = CreateFileW(filePath, GENERIC_WRITE, 0, NULL, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, NULL);
-                if(hFileDestination == INVALID_HANDLE_VALUE)
-                {
-                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"open failed to write: "+QString::fromWCharArray(filePath)+", error: "+QString::number(GetLastError()));
-                    return false;
-                }
-                FILETIME ftCreate, ftAccess, ftWrite;
-                ftCreate.dwLowDateTime=this->ftCreateL;
-                ftCreate.dwHighDateTime=this->ftCreateH;
-                ftAccess.dwLowDateTime=this->ftAccessL;
-                ftAccess.dwHighDateTime=this->ftAccessH;
-                ftWrite.dwLowDateTime=this->ftWriteL;
-                ftWrite.dwHighDateTime=this->ftWriteH;
-                if(!SetFileTime(hFileDestination, &ftCreate, &ftAccess, &ftWrite))
-                {
-                    CloseHandle(hFileDestination);
-                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"unable to set the file time");
-                    return false;
-                }
-                CloseHandle(hFileDestination);
-                return true;
-            #endif
-        #else
-            return false;
-        #endif
-    #endif
-    return false;
+    this->keepDate=keepDate;
 }
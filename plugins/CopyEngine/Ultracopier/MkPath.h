@@ -9,30 +9,17 @@
 #include <QThread>
 #include <QFileInfo>
 #include <QString>
-#include <QSemaphore>
 #include <QStringList>
-#include <QDir>
-#include <QDateTime>
+#include <QList>
 
 #include "Environment.h"
+#include "DestinationFolderCache.h"
+#include "MkPathWorker.h"
 
-#ifdef Q_OS_UNIX
-    #include <utime.h>
-    #include <time.h>
-    #include <unistd.h>
-    #include <sys/stat.h>
-#else
-    #ifdef Q_OS_WIN32
-        #ifdef ULTRACOPIER_PLUGIN_SET_TIME_UNIX_WAY
-            #include <utime.h>
-            #include <time.h>
-            #include <unistd.h>
-            #include <sys/stat.h>
-        #endif
-    #endif
-#endif
-
-/// \brief Make the path given as queued mkpath
+/** \brief Make the path given as queued mkpath
+ * The actions are a dependency graph: an action wait the previous actions on the same folder, on its parent
+ * or on its content (the parent is created before the children, the children are removed before the parent).
+ * The actions on independent sub-trees are done at the same time by a pool of MkPathWorker. */
 class MkPath : public QThread
 {
     Q_OBJECT
@@ -40,14 +27,15 @@ public:
     explicit MkPath();
     ~MkPath();
     /// \brief add path to make
-    void addPath(const QFileInfo& source,const QFileInfo& destination,const ActionType &actionType);
+    void addPath(const quint64 &id,const QFileInfo& source,const QFileInfo& destination,const ActionType &actionType);
     void setRightTransfer(const bool doRightTransfer);
     void setKeepDate(const bool keepDate);
+    void setDestinationFolderCache(DestinationFolderCache *destinationFolderCache);
 signals:
     void errorOnFolder(const QFileInfo &,const QString &,const ErrorType &errorType=ErrorType_FolderWithRety) const;
-    void firstFolderFinish();
-    void internalStartAddPath(const QFileInfo& source,const QFileInfo& destination, const ActionType &actionType) const;
-    void internalStartDoThisPath() const;
+    /// \brief the action with this id is finished or skipped
+    void folderFinish(const quint64 &id) const;
+    void internalStartAddPath(const quint64 &id,const QFileInfo& source,const QFileInfo& destination, const ActionType &actionType) const;
     void internalStartSkip() const;
     void internalStartRetry() const;
     void debugInformation(const Ultracopier::DebugLevel &level,const QString &fonction,const QString &text,const QString &file,const int &ligne) const;
@@ -58,49 +46,41 @@ public slots:
     void retry();
 private:
     void run();
-    bool waitAction;
     bool stopIt;
-    bool skipIt;
-    QDateTime		maxTime;
     struct Item
     {
+        quint64 id;
         QFileInfo source;
         QFileInfo destination;
         ActionType actionType;
+        QStringList paths;///< the folders changed by this action
+        MkPathWorker *worker;///< NULL if not running
+        bool inError;
+        QFileInfo errorFileInfo;
+        QString errorString;
     };
-    QList<Item> pathList;
-    void checkIfCanDoTheNext();
-    QDir dir;
+    QList<Item> pathList;///< the waiting, running and in error action, in the add order
+    QList<MkPathWorker *> workerList;
+    QList<MkPathWorker *> idleWorkerList;
+    QList<quint64> errorList;///< the action in error, the first is shown to the user
     bool doRightTransfer;
     bool keepDate;
-    bool doTheDateTransfer;
-    #ifdef Q_OS_UNIX
-            utimbuf butime;
-    #else
-        #ifdef Q_OS_WIN32
-            #ifdef ULTRACOPIER_PLUGIN_SET_TIME_UNIX_WAY
-                utimbuf butime;
-            #else
-                quint32 ftCreateL, ftAccessL, ftWriteL;
-                quint32 ftCreateH, ftAccessH, ftWriteH;
-                QRegularExpression regRead;
-            #endif
-        #endif
-    #endif
-    //fonction to edit the file date time
-    bool readFileDateTime(const QFileInfo &source);
-    bool writeFileDateTime(const QFileInfo &destination);
+    DestinationFolderCache *destinationFolderCache;
+    int indexOfId(const quint64 &id) const;
+    /// \brief start the waiting action without dependency on a previous action, while a worker is free
+    void startReadyItems();
+    MkPathWorker *takeIdleWorker();
+    /// \brief show the first action in error to the user, drop the id no longer into the list
+    void showNextError();
+    static bool dependOn(const Item &item,const Item &previous);
+    static bool isParentOrSame(const QString &parent,const QString &path);
     static QString text_slash;
 private slots:
-    void internalDoThisPath();
-    void internalAddPath(const QFileInfo& source, const QFileInfo& destination,const ActionType &actionType);
+    void internalAddPath(const quint64 &id,const QFileInfo& source, const QFileInfo& destination,const ActionType &actionType);
     void internalSkip();
     void internalRetry();
-    bool rmpath(const QDir &dir
-                #ifdef ULTRACOPIER_PLUGIN_RSYNC
-                , const bool &toSync=false
-                #endif
-            );
+    void workerFinished(const quint64 &id);
+    void workerErrorOnFolder(const quint64 &id,const QFileInfo &fileInfo,const QString &errorString);
 };
 
 #endif // MKPATH_H
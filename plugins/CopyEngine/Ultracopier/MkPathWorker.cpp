@@ -0,0 +1,554 @@
+#include "MkPathWorker.h"
+
+#ifdef Q_OS_UNIX
+    #include <fcntl.h>
+    #include <dirent.h>
+    #include <errno.h>
+    #include <string.h>
+#endif
+
+#ifdef Q_OS_WIN32
+    #ifndef ULTRACOPIER_PLUGIN_SET_TIME_UNIX_WAY
+        #ifndef NOMINMAX
+            #define NOMINMAX
+        #endif
+        #include <windows.h>
+    #endif
+#endif
+
+QString MkPathWorker::text_slash=QLatin1Literal("/");
+
+MkPathWorker::MkPathWorker(DestinationFolderCache *destinationFolderCache)
+{
+    stopIt=false;
+    this->destinationFolderCache=destinationFolderCache;
+    maxTime=QDateTime(QDate(ULTRACOPIER_PLUGIN_MINIMALYEAR,1,1));
+    setObjectName("MkPathWorker");
+    moveToThread(this);
+    //connected before start(), the first action can be sent just after the creation
+    connect(this,&MkPathWorker::internalStartDoThisPath,this,&MkPathWorker::internalDoThisPath,Qt::QueuedConnection);
+    start();
+    #ifdef Q_OS_WIN32
+        #ifndef ULTRACOPIER_PLUGIN_SET_TIME_UNIX_WAY
+            regRead=QRegularExpression(QStringLiteral("^[a-z]:"));
+        #endif
+    #endif
+}
+
+MkPathWorker::~MkPathWorker()
+{
+    stopIt=true;
+    quit();
+    wait();
+}
+
+void MkPathWorker::doThisPath(const quint64 &id,const QFileInfo& source,const QFileInfo& destination,const ActionType &actionType,const bool &doRightTransfer,const bool &keepDate)
+{
+    if(stopIt)
+        return;
+    emit internalStartDoThisPath(id,source,destination,actionType,doRightTransfer,keepDate);
+}
+
+void MkPathWorker::stop()
+{
+    stopIt=true;
+}
+
+void MkPathWorker::run()
+{
+    exec();
+}
+
+void MkPathWorker::internalDoThisPath(const quint64 &id,const QFileInfo& source,const QFileInfo& destination,const ActionType &actionType,const bool &doRightTransfer,const bool &keepDate)
+{
+    if(stopIt)
+        return;
+    Path item;
+    item.source=source;
+    item.destination=destination;
+    item.actionType=actionType;
+    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("source: %1, destination: %2, move: %3").arg(item.source.absoluteFilePath()).arg(item.destination.absoluteFilePath()).arg(item.actionType));
+    #ifdef ULTRACOPIER_PLUGIN_RSYNC
+    if(item.actionType==ActionType_RmSync)
+    {
+        if(item.destination.isFile())
+        {
+            QFile removedFile(item.destination.absoluteFilePath());
+            if(!removedFile.remove())
+            {
+                if(stopIt)
+                    return;
+                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to remove the inode: "+item.destination.absoluteFilePath()+", error: "+removedFile.errorString());
+                emit errorOnFolder(id,item.destination,removedFile.errorString());
+                return;
+            }
+        }
+        else if(!rmpath(item.destination.absoluteFilePath()))
+        {
+            if(stopIt)
+                return;
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to remove the inode: "+item.destination.absoluteFilePath());
+            emit errorOnFolder(id,item.destination,tr("Unable to remove"));
+            return;
+        }
+        emit finished(id);
+        return;
+    }
+    #endif
+    bool doTheDateTransfer=false;
+    if(keepDate)
+    {
+        if(!item.source.exists())
+        {
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"the sources not exists: "+item.source.absoluteFilePath());
+            doTheDateTransfer=false;
+        }
+        else if(maxTime>=item.source.lastModified())
+        {
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"the sources is older to copy the time: "+item.source.absoluteFilePath()+": "+maxTime.toString("dd.MM.yyyy hh:mm:ss.zzz")+">="+item.source.lastModified().toString("dd.MM.yyyy hh:mm:ss.zzz"));
+            doTheDateTransfer=false;
+        }
+        else
+        {
+            doTheDateTransfer=readFileDateTime(item.source);
+            /*if(!doTheDateTransfer)
+            {
+                if(stopIt)
+                    return;
+                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to get source folder time: "+item.source.absoluteFilePath());
+                emit errorOnFolder(id,item.source,tr("Unable to get time"));
+                return;
+            }*/
+        }
+    }
+    if(dir.exists(item.destination.absoluteFilePath()) && item.actionType==ActionType_RealMove)
+        item.actionType=ActionType_MovePath;
+    if(item.actionType!=ActionType_RealMove)
+    {
+        if(!dir.exists(item.destination.absoluteFilePath()))
+            if(!dir.mkpath(item.destination.absoluteFilePath()))
+            {
+                if(!dir.exists(item.destination.absoluteFilePath()))
+                {
+                    if(stopIt)
+                        return;
+                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to make the folder: "+item.destination.absoluteFilePath());
+                    emit errorOnFolder(id,item.destination,tr("Unable to create the folder"));
+                    return;
+                }
+            }
+    }
+    else
+    {
+        if(!item.source.exists())
+        {
+            if(stopIt)
+                return;
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"The source folder don't exists: "+item.source.absoluteFilePath());
+            emit errorOnFolder(id,item.destination,tr("The source folder don't exists"));
+            return;
+        }
+        if(!item.source.isDir())//it's really an error?
+        {
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"The source is not a folder: "+item.source.absoluteFilePath());
+            /*if(stopIt)
+                return;
+            emit errorOnFolder(id,item.destination,tr("The source is not a folder"));
+            return;*/
+        }
+        if(item.destination.absoluteFilePath().startsWith(item.source.absoluteFilePath()+text_slash))
+        {
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"move into it self: "+item.destination.absoluteFilePath());
+            int random=rand();
+            QFileInfo tempFolder=item.source.absolutePath()+text_slash+QString::number(random);
+            while(tempFolder.exists())
+            {
+                random=rand();
+                tempFolder=item.source.absolutePath()+text_slash+QString::number(random);
+            }
+            if(!dir.rename(item.source.absoluteFilePath(),tempFolder.absoluteFilePath()))
+            {
+                if(stopIt)
+                    return;
+                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to temporary rename the folder: "+item.destination.absoluteFilePath());
+                emit errorOnFolder(id,item.destination,tr("Unable to temporary rename the folder"));
+                return;
+            }
+            /* http://doc.qt.io/qt-5/qdir.html#rename
+             * On most file systems, rename() fails only if oldName does not exist, or if a file with the new name already exists.
+            if(!dir.mkpath(item.destination.absolutePath()))
+            {
+                if(!dir.exists(item.destination.absolutePath()))
+                {
+                    if(stopIt)
+                        return;
+                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to make the folder: "+item.destination.absoluteFilePath());
+                    emit errorOnFolder(id,item.destination,tr("Unable to create the folder"));
+                    return;
+                }
+            }*/
+            if(!dir.rename(tempFolder.absoluteFilePath(),item.destination.absoluteFilePath()))
+            {
+                if(stopIt)
+                    return;
+                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to do the final real move the folder: "+item.destination.absoluteFilePath());
+                emit errorOnFolder(id,item.destination,tr("Unable to do the final real move the folder"));
+                return;
+            }
+        }
+        else
+        {
+            /* http://doc.qt.io/qt-5/qdir.html#rename
+             * On most file systems, rename() fails only if oldName does not exist, or if a file with the new name already exists.
+            if(!dir.mkpath(item.destination.absolutePath()))
+            {
+                if(!dir.exists(item.destination.absolutePath()))
+                {
+                    if(stopIt)
+                        return;
+                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to make the folder: "+item.destination.absoluteFilePath());
+                    emit errorOnFolder(id,item.destination,tr("Unable to create the folder"));
+                    return;
+                }
+            }*/
+            if(!dir.rename(item.source.absoluteFilePath(),item.destination.absoluteFilePath()))
+            {
+                if(stopIt)
+                    return;
+                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to make the folder: from: "+item.source.absoluteFilePath()+", soruce exists: "+QString::number(QDir(item.source.absoluteFilePath()).exists())+", to: "+item.destination.absoluteFilePath()+", destination exist: "+QString::number(QDir(item.destination.absoluteFilePath()).exists()));
+                emit errorOnFolder(id,item.destination,tr("Unable to move the folder"));
+                return;
+            }
+        }
+    }
+    if(destinationFolderCache!=NULL)
+    {
+        if(item.actionType==ActionType_RealMove)
+        {
+            destinationFolderCache->remove(item.source.absoluteFilePath());
+            destinationFolderCache->addTree(item.destination.absoluteFilePath());
+        }
+        else
+            destinationFolderCache->add(item.destination.absoluteFilePath());
+    }
+    if(doTheDateTransfer)
+        if(!writeFileDateTime(item.destination))
+        {
+            if(!item.destination.exists())
+                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to set destination folder time (not exists): "+item.destination.absoluteFilePath());
+            else if(!item.destination.isDir())
+                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to set destination folder time (not a dir): "+item.destination.absoluteFilePath());
+            else
+                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to set destination folder time: "+item.destination.absoluteFilePath());
+            /*if(stopIt)
+                return;
+
+            emit errorOnFolder(id,item.source,tr("Unable to set time"));
+            return;*/
+        }
+    if(doRightTransfer && item.actionType!=ActionType_RealMove)
+    {
+        QFile source(item.source.absoluteFilePath());
+        QFile destination(item.destination.absoluteFilePath());
+        if(!destination.setPermissions(source.permissions()))
+        {
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to set the right: "+item.destination.absoluteFilePath());
+            /*if(stopIt)
+                return;
+            emit errorOnFolder(id,item.source,tr("Unable to set the access-right"));
+            return;*/
+        }
+    }
+    if(item.actionType==ActionType_MovePath)
+    {
+        if(!rmpath(item.source.absoluteFilePath()))
+        {
+            if(stopIt)
+                return;
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"Unable to remove the source folder: "+item.destination.absoluteFilePath());
+            emit errorOnFolder(id,item.source,tr("Unable to remove"));
+            return;
+        }
+    }
+    emit finished(id);
+}
+
+bool MkPathWorker::rmpath(const QDir &dir
+                    #ifdef ULTRACOPIER_PLUGIN_RSYNC
+                    ,const bool &toSync
+                    #endif
+                    )
+{
+    #ifdef Q_OS_UNIX
+    return rmpathAt(AT_FDCWD,QFile::encodeName(dir.absolutePath()),dir.absolutePath()
+                    #ifdef ULTRACOPIER_PLUGIN_RSYNC
+                    ,toSync
+                    #endif
+                    );
+    #else
+    if(!dir.exists())
+        return true;
+    bool allHaveWork=true;
+    QFileInfoList list = dir.entryInfoList(QDir::AllEntries|QDir::NoDotAndDotDot|QDir::Hidden|QDir::System,QDir::DirsFirst);
+    for (int i = 0; i < list.size(); ++i)
+    {
+        QFileInfo fileInfo(list.at(i));
+        if(!fileInfo.isDir())
+        {
+            #ifdef ULTRACOPIER_PLUGIN_RSYNC
+            if(toSync)
+            {
+                QFile file(fileInfo.absoluteFilePath());
+                if(!file.remove())
+                {
+                    if(toSync)
+                    {
+                        QFile file(fileInfo.absoluteFilePath());
+                        if(!file.remove())
+                        {
+                            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"unable to remove a file: "+fileInfo.absoluteFilePath()+", due to: "+file.errorString());
+                            allHaveWork=false;
+                        }
+                    }
+                    else
+                    {
+                        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"found a file: "+fileInfo.fileName());
+                        allHaveWork=false;
+                    }
+                }
+            }
+            else
+            {
+                ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"found a file: "+fileInfo.fileName());
+                allHaveWork=false;
+            }
+            #else
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"found a file: "+fileInfo.fileName());
+            allHaveWork=false;
+            #endif
+        }
+        else
+        {
+            //return the fonction for scan the new folder
+            if(!rmpath(dir.absolutePath()+'/'+fileInfo.fileName()+'/'))
+                allHaveWork=false;
+        }
+    }
+    if(!allHaveWork)
+        return false;
+    allHaveWork=dir.rmdir(dir.absolutePath());
+    if(!allHaveWork)
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"unable to remove the folder: "+dir.absolutePath());
+    return allHaveWork;
+    #endif
+}
+
+#ifdef Q_OS_UNIX
+/** \brief remove the folder name into the folder parentFd, with its sub-folders
+ * All is relative to the folder fd: the path is not resolved again for each entry, and the listing is not stat() entry by entry
+ * when the file system give the type. The path is only for the debug. */
+bool MkPathWorker::rmpathAt(const int &parentFd,const QByteArray &name,const QString &path
+                    #ifdef ULTRACOPIER_PLUGIN_RSYNC
+                    ,const bool &toSync
+                    #endif
+                    )
+{
+    const int fd=openat(parentFd,name.constData(),O_RDONLY|O_DIRECTORY|O_NOFOLLOW|O_CLOEXEC);
+    if(fd<0)
+    {
+        if(errno==ENOENT)
+            return true;
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"unable to open the folder: "+path+", due to: "+QString::fromLocal8Bit(strerror(errno)));
+        return false;
+    }
+    DIR *folder=fdopendir(fd);
+    if(folder==NULL)
+    {
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"unable to list the folder: "+path+", due to: "+QString::fromLocal8Bit(strerror(errno)));
+        ::close(fd);
+        return false;
+    }
+    bool allHaveWork=true;
+    struct dirent *entry;
+    while((entry=readdir(folder))!=NULL)
+    {
+        if(strcmp(entry->d_name,".")==0 || strcmp(entry->d_name,"..")==0)
+            continue;
+        bool isDir=(entry->d_type==DT_DIR);
+        if(entry->d_type==DT_UNKNOWN)
+        {
+            struct stat info;
+            if(fstatat(fd,entry->d_name,&info,AT_SYMLINK_NOFOLLOW)!=0)
+            {
+                allHaveWork=false;
+                continue;
+            }
+            isDir=S_ISDIR(info.st_mode);
+        }
+        const QString &entryPath=path+text_slash+QFile::decodeName(entry->d_name);
+        if(isDir)
+        {
+            if(!rmpathAt(fd,QByteArray(entry->d_name),entryPath
+                         #ifdef ULTRACOPIER_PLUGIN_RSYNC
+                         ,toSync
+                         #endif
+                         ))
+                allHaveWork=false;
+        }
+        else
+        {
+            #ifdef ULTRACOPIER_PLUGIN_RSYNC
+            if(toSync)
+            {
+                if(unlinkat(fd,entry->d_name,0)!=0)
+                {
+                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"unable to remove a file: "+entryPath+", due to: "+QString::fromLocal8Bit(strerror(errno)));
+                    allHaveWork=false;
+                }
+                continue;
+            }
+            #endif
+            ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"found a file: "+entryPath);
+            allHaveWork=false;
+        }
+    }
+    //close the fd too
+    closedir(folder);
+    if(!allHaveWork)
+        return false;
+    if(unlinkat(parentFd,name.constData(),AT_REMOVEDIR)!=0)
+    {
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"unable to remove the folder: "+path+", due to: "+QString::fromLocal8Bit(strerror(errno)));
+        return false;
+    }
+    return true;
+}
+#endif
+
+//fonction to edit the file date time
+bool MkPathWorker::readFileDateTime(const QFileInfo &source)
+{
+    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"readFileDateTime("+source.absoluteFilePath()+")");
+    /** Why not do it with Qt? Because it not support setModificationTime(), and get the time with Qt, that's mean use local time where in C is UTC time */
+    #ifdef Q_OS_UNIX
+        #ifdef Q_OS_LINUX
+            struct stat info;
+            if(stat(source.absoluteFilePath().toLatin1().data(),&info)!=0)
+                return false;
+            time_t ctime=info.st_ctim.tv_sec;
+            time_t actime=info.st_atim.tv_sec;
+            time_t modtime=info.st_mtim.tv_sec;
+            //this function avalaible on unix and mingw
+            butime.actime=actime;
+            butime.modtime=modtime;
+            Q_UNUSED(ctime);
+            return true;
+        #else //mainly for mac
+            QFileInfo fileInfo(source);
+            time_t ctime=fileInfo.created().toTime_t();
+            time_t actime=fileInfo.lastRead().toTime_t();
+            time_t modtime=fileInfo.lastModified().toTime_t();
+            //this function avalaible on unix and mingw
+            utimbuf butime;
+            butime.actime=actime;
+            butime.modtime=modtime;
+            Q_UNUSED(ctime);
+            return true;
+        #endif
+    #else
+        #ifdef Q_OS_WIN32
+            #ifdef ULTRACOPIER_PLUGIN_SET_TIME_UNIX_WAY
+                struct stat info;
+                if(stat(source.toLatin1().data(),&info)!=0)
+                    return false;
+                time_t ctime=info.st_ctim.tv_sec;
+                time_t actime=info.st_atim.tv_sec;
+                time_t modtime=info.st_mtim.tv_sec;
+                //this function avalaible on unix and mingw
+                butime.actime=actime;
+                butime.modtime=modtime;
+                Q_UNUSED(ctime);
+                return true;
+            #else
+                wchar_t filePath[65535];
+                if(source.absoluteFilePath().contains(regRead))
+                    filePath[QDir::toNativeSeparators(QStringLiteral("\\\\?\\")+source.absoluteFilePath()).toWCharArray(filePath)]=L'\0';
+                else
+                    filePath[QDir::toNativeSeparators(source.absoluteFilePath()).toWCharArray(filePath)]=L'\0';
+                HANDLE hFileSouce = CreateFileW(filePath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_READONLY | FILE_FLAG_BACKUP_SEMANTICS, NULL);
+                if(hFileSouce == INVALID_HANDLE_VALUE)
+                {
+                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"open failed to read: "+QString::fromWCharArray(filePath)+", error: "+QString::number(GetLastError()));
+                    return false;
+                }
+                FILETIME ftCreate, ftAccess, ftWrite;
+                if(!GetFileTime(hFileSouce, &ftCreate, &ftAccess, &ftWrite))
+                {
+                    CloseHandle(hFileSouce);
+                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"unable to get the file time");
+                    return false;
+                }
+                this->ftCreateL=ftCreate.dwLowDateTime;
+                this->ftCreateH=ftCreate.dwHighDateTime;
+                this->ftAccessL=ftAccess.dwLowDateTime;
+                this->ftAccessH=ftAccess.dwHighDateTime;
+                this->ftWriteL=ftWrite.dwLowDateTime;
+                this->ftWriteH=ftWrite.dwHighDateTime;
+                CloseHandle(hFileSouce);
+                return true;
+            #endif
+        #else
+            return false;
+        #endif
+    #endif
+    return false;
+}
+
+bool MkPathWorker::writeFileDateTime(const QFileInfo &destination)
+{
+    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"writeFileDateTime("+destination.absoluteFilePath()+")");
+    /** Why not do it with Qt? Because it not support setModificationTime(), and get the time with Qt, that's mean use local time where in C is UTC time */
+    #ifdef Q_OS_UNIX
+        #ifdef Q_OS_LINUX
+            return utime(destination.absoluteFilePath().toLatin1().data(),&butime)==0;
+        #else //mainly for mac
+            return utime(destination.absoluteFilePath().toLatin1().data(),&butime)==0;
+        #endif
+    #else
+        #ifdef Q_OS_WIN32
+            #ifdef ULTRACOPIER_PLUGIN_SET_TIME_UNIX_WAY
+                return utime(destination.toLatin1().data(),&butime)==0;
+            #else
+                wchar_t filePath[65535];
+                if(destination.absoluteFilePath().contains(regRead))
+                    filePath[QDir::toNativeSeparators(QStringLiteral("\\\\?\\")+destination.absoluteFilePath()).toWCharArray(filePath)]=L'\0';
+                else
+                    filePath[QDir::toNativeSeparators(destination.absoluteFilePath()).toWCharArray(filePath)]=L'\0';
+                HANDLE hFileDestination = CreateFileW(filePath, GENERIC_WRITE, 0, NULL, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, NULL);
+                if(hFileDestination == INVALID_HANDLE_VALUE)
+                {
+                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"open failed to write: "+QString::fromWCharArray(filePath)+", error: "+QString::number(GetLastError()));
+                    return false;
+                }
+                FILETIME ftCreate, ftAccess, ftWrite;
+                ftCreate.dwLowDateTime=this->ftCreateL;
+                ftCreate.dwHighDateTime=this->ftCreateH;
+                ftAccess.dwLowDateTime=this->ftAccessL;
+                ftAccess.dwHighDateTime=this->ftAccessH;
+                ftWrite.dwLowDateTime=this->ftWriteL;
+                ftWrite.dwHighDateTime=this->ftWriteH;
+                if(!SetFileTime(hFileDestination, &ftCreate, &ftAccess, &ftWrite))
+                {
+                    CloseHandle(hFileDestination);
+                    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Warning,"unable to set the file time");
+                    return false;
+                }
+                CloseHandle(hFileDestination);
+                return true;
+            #endif
+        #else
+            return false;
+        #endif
+    #endif
+    return false;
+}
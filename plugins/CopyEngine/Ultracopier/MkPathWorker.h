@@ -0,0 +1,95 @@
+/** \file MkPathWorker.h
+\brief Thread which do one folder action at time for MkPath
+\author alpha_one_x86
+\licence GPL3, see the file COPYING */
+
+#ifndef MKPATHWORKER_H
+#define MKPATHWORKER_H
+
+#include <QThread>
+#include <QFileInfo>
+#include <QString>
+#include <QDir>
+#include <QDateTime>
+
+#include "Environment.h"
+#include "DestinationFolderCache.h"
+
+#ifdef Q_OS_UNIX
+    #include <utime.h>
+    #include <time.h>
+    #include <unistd.h>
+    #include <sys/stat.h>
+#else
+    #ifdef Q_OS_WIN32
+        #ifdef ULTRACOPIER_PLUGIN_SET_TIME_UNIX_WAY
+            #include <utime.h>
+            #include <time.h>
+            #include <unistd.h>
+            #include <sys/stat.h>
+        #endif
+    #endif
+#endif
+
+/** \brief Thread which do one folder action at time: mkpath, rmpath, real move
+ * MkPath give it only the action without dependency on a running action */
+class MkPathWorker : public QThread
+{
+    Q_OBJECT
+public:
+    explicit MkPathWorker(DestinationFolderCache *destinationFolderCache);
+    ~MkPathWorker();
+    /// \brief do the action into the worker thread, finished() or errorOnFolder() is emitted at the end
+    void doThisPath(const quint64 &id,const QFileInfo& source,const QFileInfo& destination,const ActionType &actionType,const bool &doRightTransfer,const bool &keepDate);
+    void stop();
+signals:
+    void finished(const quint64 &id) const;
+    void errorOnFolder(const quint64 &id,const QFileInfo &fileInfo,const QString &errorString) const;
+    void internalStartDoThisPath(const quint64 &id,const QFileInfo& source,const QFileInfo& destination,const ActionType &actionType,const bool &doRightTransfer,const bool &keepDate) const;
+    void debugInformation(const Ultracopier::DebugLevel &level,const QString &fonction,const QString &text,const QString &file,const int &ligne) const;
+private:
+    void run();
+    volatile bool stopIt;
+    QDateTime		maxTime;
+    struct Path
+    {
+        QFileInfo source;
+        QFileInfo destination;
+        ActionType actionType;
+    };
+    QDir dir;
+    DestinationFolderCache *destinationFolderCache;
+    #ifdef Q_OS_UNIX
+            utimbuf butime;
+    #else
+        #ifdef Q_OS_WIN32
+            #ifdef ULTRACOPIER_PLUGIN_SET_TIME_UNIX_WAY
+                utimbuf butime;
+            #else
+                quint32 ftCreateL, ftAccessL, ftWriteL;
+                quint32 ftCreateH, ftAccessH, ftWriteH;
+                QRegularExpression regRead;
+            #endif
+        #endif
+    #endif
+    //fonction to edit the file date time
+    bool readFileDateTime(const QFileInfo &source);
+    bool writeFileDateTime(const QFileInfo &destination);
+    bool rmpath(const QDir &dir
+                #ifdef ULTRACOPIER_PLUGIN_RSYNC
+                , const bool &toSync=false
+                #endif
+            );
+    #ifdef Q_OS_UNIX
+    bool rmpathAt(const int &parentFd,const QByteArray &name,const QString &path
+                #ifdef ULTRACOPIER_PLUGIN_RSYNC
+                , const bool &toSync
+                #endif
+            );
+    #endif
+    static QString text_slash;
+private slots:
+    void internalDoThisPath(const quint64 &id,const QFileInfo& source,const QFileInfo& destination,const ActionType &actionType,const bool &doRightTransfer,const bool &keepDate);
+};
+
+#endif // MKPATHWORKER_H
@@ -0,0 +1,55 @@
+#include "NameArena.h"
+#include "Variable.h"
+
+#include <string.h>
+
+NameArena::NameArena()
+{
+    releasedSize=0;
+}
+
+quint32 NameArena::add(const QString &name)
+{
+    const QByteArray &utf8=name.toUtf8();
+    //the file name is limited to 255 characters, then less than 1024 bytes
+    const quint16 size=utf8.size();
+    const quint32 offset=data.size();
+    data.append((const char *)&size,sizeof(size));
+    data.append(utf8.constData(),size);
+    return offset;
+}
+
+QString NameArena::name(const quint32 &offset) const
+{
+    if(offset==NAMEARENA_NO_NAME)
+        return QString();
+    quint16 size;
+    memcpy(&size,data.constData()+offset,sizeof(size));
+    return QString::fromUtf8(data.constData()+offset+sizeof(size),size);
+}
+
+void NameArena::release(const quint32 &offset)
+{
+    if(offset==NAMEARENA_NO_NAME)
+        return;
+    quint16 size;
+    memcpy(&size,data.constData()+offset,sizeof(size));
+    releasedSize+=sizeof(size)+size;
+}
+
+bool NameArena::needCompact() const
+{
+    return data.size()>ULTRACOPIER_PLUGIN_NAME_ARENA_COMPACT_SIZE && releasedSize>data.size()/2;
+}
+
+void NameArena::swap(NameArena &other)
+{
+    data.swap(other.data);
+    qSwap(releasedSize,other.releasedSize);
+}
+
+void NameArena::clear()
+{
+    data.clear();
+    releasedSize=0;
+}
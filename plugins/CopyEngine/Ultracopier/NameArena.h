@@ -0,0 +1,38 @@
+/** \file NameArena.h
+\brief Storage of the file name of the queued transfer into one buffer
+\author alpha_one_x86
+\licence GPL3, see the file COPYING */
+
+#ifndef NAMEARENA_H
+#define NAMEARENA_H
+
+#include <QString>
+#include <QByteArray>
+
+/// \brief the offset of no name, the destination name is the same as the source name
+#define NAMEARENA_NO_NAME 0xFFFFFFFF
+
+/** \brief The names are stored one after the other in UTF-8 with their size, the transfer keep only the offset
+ * Then no QString header and no allocation by name. The released names stay into the buffer until the
+ * owner add again the used names into a new arena and swap it, when needCompact() return true. */
+class NameArena
+{
+public:
+    explicit NameArena();
+    /// \brief store the name, return its offset
+    quint32 add(const QString &name);
+    /// \brief return the name at this offset, empty for NAMEARENA_NO_NAME
+    QString name(const quint32 &offset) const;
+    /// \brief the name at this offset is not used anymore
+    void release(const quint32 &offset);
+    /// \brief true if the released names use the most of the buffer
+    bool needCompact() const;
+    void swap(NameArena &other);
+    /// \brief drop all the names, only when no transfer use them
+    void clear();
+private:
+    QByteArray data;
+    int releasedSize;
+};
+
+#endif // NAMEARENA_H
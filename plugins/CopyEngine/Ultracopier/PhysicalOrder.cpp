@@ -0,0 +1,66 @@
+#include "PhysicalOrder.h"
+#include "DriveManagement.h"
+
+#include <algorithm>
+
+PhysicalOrder::PhysicalOrder()
+{
+    stopIt=false;
+    setObjectName("PhysicalOrder");
+    moveToThread(this);
+    //connected before start(), the first sort can be asked just after the creation
+    connect(this,&PhysicalOrder::internalStartSort,this,&PhysicalOrder::internalSort,Qt::QueuedConnection);
+    start();
+}
+
+PhysicalOrder::~PhysicalOrder()
+{
+    stopIt=true;
+    quit();
+    wait();
+}
+
+void PhysicalOrder::sort(const QList<quint64> &idList,const QStringList &pathList)
+{
+    if(stopIt)
+        return;
+    emit internalStartSort(idList,pathList);
+}
+
+void PhysicalOrder::stop()
+{
+    stopIt=true;
+}
+
+void PhysicalOrder::run()
+{
+    exec();
+}
+
+void PhysicalOrder::internalSort(const QList<quint64> &idList,const QStringList &pathList)
+{
+    QList<QPair<quint64,quint64> > offsetList;
+    offsetList.reserve(idList.size());
+    int index=0;
+    while(index<idList.size())
+    {
+        if(stopIt)
+            return;
+        offsetList << QPair<quint64,quint64>(DriveManagement::getPhysicalOffset(pathList.at(index)),idList.at(index));
+        index++;
+    }
+    //stable to keep the list order for the unknown offset (max value)
+    std::stable_sort(offsetList.begin(),offsetList.end(),[](const QPair<quint64,quint64> &a,const QPair<quint64,quint64> &b) {
+        return a.first<b.first;
+    });
+    QList<quint64> sortedIdList;
+    sortedIdList.reserve(offsetList.size());
+    index=0;
+    while(index<offsetList.size())
+    {
+        sortedIdList << offsetList.at(index).second;
+        index++;
+    }
+    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("%1 transfer sorted by physical offset").arg(sortedIdList.size()));
+    emit sorted(sortedIdList);
+}
@@ -0,0 +1,41 @@
+/** \file PhysicalOrder.h
+\brief Thread which get the physical offset of the source files, to sort the transfer list without block the list thread
+\author alpha_one_x86
+\licence GPL3, see the file COPYING */
+
+#ifndef PHYSICALORDER_H
+#define PHYSICALORDER_H
+
+#include <QThread>
+#include <QString>
+#include <QStringList>
+#include <QList>
+#include <QPair>
+
+#include "Environment.h"
+
+/** \brief Thread which get the physical offset of the source files
+ * The list thread give the ids and the paths, and receive the ids sorted by physical offset, the FIEMAP of
+ * each file is done into this thread. */
+class PhysicalOrder : public QThread
+{
+    Q_OBJECT
+public:
+    explicit PhysicalOrder();
+    ~PhysicalOrder();
+    /// \brief get the offset of these files into this thread, sorted() is emitted at the end
+    void sort(const QList<quint64> &idList,const QStringList &pathList);
+    void stop();
+signals:
+    /// \brief the ids sorted by physical offset, stable for the unknown offset
+    void sorted(const QList<quint64> &idList) const;
+    void internalStartSort(const QList<quint64> &idList,const QStringList &pathList) const;
+    void debugInformation(const Ultracopier::DebugLevel &level,const QString &fonction,const QString &text,const QString &file,const int &ligne) const;
+private:
+    void run();
+    volatile bool stopIt;
+private slots:
+    void internalSort(const QList<quint64> &idList,const QStringList &pathList);
+};
+
+#endif // PHYSICALORDER_H
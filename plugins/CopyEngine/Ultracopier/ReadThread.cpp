@@ -14,6 +14,9 @@ ReadThread::ReadThread()
     isInReadLoop=false;
     tryStartRead=false;
     lastGoodPosition=0;
+    firstByteRecorded=true;
+    openLatencyJob=NULL;
+    openLatencyDevice=NULL;
     isOpen.release();
 }
 
@@ -47,7 +50,7 @@ void ReadThread::run()
     exec();
 }
 
-void ReadThread::open(const QFileInfo &file, const Ultracopier::CopyMode &mode)
+void ReadThread::open(const QFileInfo &file, const Ultracopier::CopyMode &mode,LatencyStages *latencyJob,LatencyStages *latencyDevice)
 {
     if(!isRunning())
     {
@@ -81,6 +84,8 @@ void ReadThread::open(const QFileInfo &file, const Ultracopier::CopyMode &mode)
     lastGoodPosition=0;
     this->file.setFileName(file.absoluteFilePath());
     this->mode=mode;
+    openLatencyJob=latencyJob;
+    openLatencyDevice=latencyDevice;
     emit internalStartOpen();
 }
 
@@ -151,6 +156,8 @@ void ReadThread::checkSum()
 {
     QByteArray blockArray;
     QCryptographicHash hash(QCryptographicHash::Sha1);
+    QElapsedTimer checksumTime;
+    checksumTime.start();
     isInReadLoop=true;
     lastGoodPosition=0;
     #ifdef ULTRACOPIER_PLUGIN_SPEED_SUPPORT
@@ -242,6 +249,7 @@ void ReadThread::checkSum()
         stopIt=false;
         return;
     }
+    latency.record(LatencyStage_Checksum,checksumTime);
     emit checksumFinish(hash.result());
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("[")+QString::number(id)+QStringLiteral("] stop the read"));
 }
@@ -277,8 +285,13 @@ bool ReadThread::internalOpen(bool resetLastGoodPosition)
      * if(mode==Ultracopier::Move)
         openMode=QIODevice::ReadWrite;*/
     seekToZero=false;
+    //the previous file is closed, its latency is no longer recorded
+    latency.set(openLatencyJob,openLatencyDevice);
+    openTime.start();
     if(file.open(openMode))
     {
+        latency.record(LatencyStage_Open,openTime);
+        firstByteRecorded=false;
         if(stopIt)
         {
             file.close();
@@ -358,6 +371,7 @@ void ReadThread::internalRead()
         return;
     }
     QByteArray blockArray;
+    QElapsedTimer blockTime;
     #ifdef ULTRACOPIER_PLUGIN_SPEED_SUPPORT
     numberOfBlockCopied=0;
     #endif
@@ -398,10 +412,17 @@ void ReadThread::internalRead()
         #ifdef ULTRACOPIER_PLUGIN_DEBUG
         stat=Read;
         #endif
+        blockTime.start();
         blockArray=file.read(blockSize);
+        latency.record(LatencyStage_ReadBlock,blockTime);
         #ifdef ULTRACOPIER_PLUGIN_DEBUG
         stat=Idle;
         #endif
+        if(!firstByteRecorded && !blockArray.isEmpty())
+        {
+            firstByteRecorded=true;
+            latency.record(LatencyStage_FirstByte,openTime);
+        }
 
         if(file.error()!=QFile::NoError)
         {
@@ -501,7 +522,10 @@ void ReadThread::internalClose(bool callByTheDestructor)
         if(file.isOpen())
         {
             closeTheFile=true;
+            QElapsedTimer closeTime;
+            closeTime.start();
             file.close();
+            latency.record(LatencyStage_Close,closeTime);
             isInReadLoop=false;
         }
     }
@@ -590,7 +614,7 @@ qint64 ReadThread::getLastGoodPosition() const
         return file.size();
     }
     else*/
-    return lastGoodPosition;
+    return lastGoodPosition.value();
 }
 
 //reopen after an error
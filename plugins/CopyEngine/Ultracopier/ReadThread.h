@@ -12,11 +12,14 @@
 #include <QDateTime>
 #include <QFileInfo>
 #include <QCryptographicHash>
+#include <QElapsedTimer>
 
 #include "WriteThread.h"
 #include "Environment.h"
 #include "StructEnumDefinition_CopyEngine.h"
 #include "AvancedQFile.h"
+#include "TransferProgress.h"
+#include "LatencyHistogram.h"
 
 /// \brief Thread changed to open/close and read the source file
 class ReadThread : public QThread
@@ -28,8 +31,8 @@ public:
 protected:
     void run();
 public:
-    /// \brief open with the name and copy mode
-    void open(const QFileInfo &file, const Ultracopier::CopyMode &mode);
+    /// \brief open with the name and copy mode, the latency of this file is recorded into latencyJob and latencyDevice
+    void open(const QFileInfo &file, const Ultracopier::CopyMode &mode,LatencyStages *latencyJob=NULL,LatencyStages *latencyDevice=NULL);
     /// \brief return the error string
     QString errorString() const;
     //QByteArray read(qint64 position,qint64 maxSize);
@@ -41,7 +44,7 @@ public:
     void resume();
     /// \brief get the size of the source file
     qint64 size() const;
-    /// \brief get the last good position
+    /// \brief get the last good position, can be called from an other thread
     qint64 getLastGoodPosition() const;
     /// \brief start the reading of the source file
     void startRead();
@@ -114,7 +117,7 @@ private:
     AvancedQFile	file;
     volatile bool	stopIt;
     Ultracopier::CopyMode	mode;
-    qint64          lastGoodPosition;
+    TransferCounter<qint64> lastGoodPosition;///< read by the transfer and list thread without lock
     volatile int	blockSize;//in Bytes
     #ifdef ULTRACOPIER_PLUGIN_SPEED_SUPPORT
     QSemaphore      waitNewClockForSpeed;
@@ -132,6 +135,10 @@ private:
     qint64          size_at_open;
     QDateTime       mtime_at_open;
     bool            fakeMode;
+    LatencyTarget   latency;
+    LatencyStages   *openLatencyJob,*openLatencyDevice;///< given by open(), set into latency by internalOpen()
+    QElapsedTimer   openTime;///< to have the latency to the first byte
+    bool            firstByteRecorded;
     //internal function
     bool seek(const qint64 &position);/// \todo search if is use full
 private slots:
@@ -22,6 +22,8 @@ ScanFileOrFolder::ScanFileOrFolder(const Ultracopier::CopyMode &mode)
     moveTheWholeFolder  = true;
     stopped             = true;
     stopIt              = false;
+    destinationFolderCache = NULL;
+    transferSlot        = NULL;
     this->mode          = mode;
     folder_isolation    = QRegularExpression(QStringLiteral("^(.*/)?([^/]+)/$"));
     setObjectName(QStringLiteral("ScanFileOrFolder"));
@@ -235,7 +237,7 @@ void ScanFileOrFolder::run()
         else
         {
             ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("source: %1 is file or symblink").arg(source.absoluteFilePath()));
-            emit fileTransfer(source,destination+text_slash+source.fileName(),mode);
+            sendFileTransfer(source,destination+text_slash+source.fileName());
         }
         sourceIndex++;
     }
@@ -313,7 +315,10 @@ void ScanFileOrFolder::listFolder(QFileInfo source,QFileInfo destination)
             break;
             case FolderExists_Rename:
                 ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"destination before rename: "+destination.absoluteFilePath());
-                if(newName.isEmpty())
+                //the suffix is not added after, like the probe loop
+                if(newName.isEmpty() && destinationFolderCache!=NULL)
+                    destinationSuffixPath=reserveRenamedName(destination,false);
+                else if(newName.isEmpty())
                 {
                     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"pattern: "+folder_isolation.pattern());
                     //resolv the new name
@@ -380,7 +385,14 @@ void ScanFileOrFolder::listFolder(QFileInfo source,QFileInfo destination)
                 break;
                 case FolderExists_Rename:
                     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,"destination before rename: "+destination.absoluteFilePath());
-                    if(newName.isEmpty())
+                    if(newName.isEmpty() && destinationFolderCache!=NULL)
+                    {
+                        //the suffix is added after
+                        destinationSuffixPath=reserveRenamedName(destination,true);
+                        if(!destination.completeSuffix().isEmpty())
+                            destinationSuffixPath.chop(destination.completeSuffix().size()+1);
+                    }
+                    else if(newName.isEmpty())
                     {
                         //resolv the new name
                         QFileInfo destinationInfo;
@@ -564,7 +576,7 @@ void ScanFileOrFolder::listFolder(QFileInfo source,QFileInfo destination)
                     {}
                     else
                         #ifndef ULTRACOPIER_PLUGIN_RSYNC
-                        emit fileTransfer(fileInfo,destination.absoluteFilePath()+text_slash+fileInfo.fileName(),mode);
+                        sendFileTransfer(fileInfo,destination.absoluteFilePath()+text_slash+fileInfo.fileName());
                         #else
                         {
                             bool sendToTransfer=false;
@@ -575,7 +587,7 @@ void ScanFileOrFolder::listFolder(QFileInfo source,QFileInfo destination)
                             else if(fileInfo.lastModified()!=QFileInfo(destination.absoluteFilePath()+"/"+fileInfo.fileName()).lastModified())
                                 sendToTransfer=true;
                             if(sendToTransfer)
-                                emit fileTransfer(fileInfo.absoluteFilePath(),destination.absoluteFilePath()+"/"+fileInfo.fileName(),mode);
+                                sendFileTransfer(fileInfo.absoluteFilePath(),destination.absoluteFilePath()+"/"+fileInfo.fileName());
                         }
                         #endif
                 }
@@ -588,7 +600,7 @@ void ScanFileOrFolder::listFolder(QFileInfo source,QFileInfo destination)
                 listFolder(fileInfo,destination.absoluteFilePath()+text_slash+fileInfo.fileName());//put unix separator because it's transformed into that's under windows too
             else
                 #ifndef ULTRACOPIER_PLUGIN_RSYNC
-                emit fileTransfer(fileInfo,destination.absoluteFilePath()+text_slash+fileInfo.fileName(),mode);
+                sendFileTransfer(fileInfo,destination.absoluteFilePath()+text_slash+fileInfo.fileName());
                 #else
                 {
                     bool sendToTransfer=false;
@@ -599,7 +611,7 @@ void ScanFileOrFolder::listFolder(QFileInfo source,QFileInfo destination)
                     else if(fileInfo.lastModified()!=QFileInfo(destination.absoluteFilePath()+"/"+fileInfo.fileName()).lastModified())
                         sendToTransfer=true;
                     if(sendToTransfer)
-                        emit fileTransfer(fileInfo.absoluteFilePath(),destination.absoluteFilePath()+"/"+fileInfo.fileName(),mode);
+                        sendFileTransfer(fileInfo.absoluteFilePath(),destination.absoluteFilePath()+"/"+fileInfo.fileName());
                 }
                 #endif
         }
@@ -646,6 +658,51 @@ void ScanFileOrFolder::setCheckDestinationFolderExists(const bool checkDestinati
     this->checkDestinationExists=checkDestinationFolderExists;
 }
 
+void ScanFileOrFolder::setTransferSlot(QSemaphore *transferSlot)
+{
+    this->transferSlot=transferSlot;
+}
+
+void ScanFileOrFolder::sendFileTransfer(const QFileInfo &source,const QFileInfo &destination)
+{
+    if(transferSlot!=NULL)
+        while(!transferSlot->tryAcquire(1,100))
+            if(stopIt)
+                return;
+    emit fileTransfer(source,destination,mode);
+}
+
+void ScanFileOrFolder::setDestinationFolderCache(DestinationFolderCache *destinationFolderCache)
+{
+    this->destinationFolderCache=destinationFolderCache;
+}
+
+/// \brief one pass on the listing of the parent folder, instead of check each candidate name on the file system
+QString ScanFileOrFolder::reserveRenamedName(const QFileInfo &destination,const bool &withSuffix)
+{
+    QString firstName,otherName;
+    if(firstRenamingRule.isEmpty())
+        firstName=tr("%1 - copy").arg(destination.baseName());
+    else
+    {
+        firstName=firstRenamingRule;
+        firstName.replace(QStringLiteral("%name%"),destination.baseName());
+    }
+    if(otherRenamingRule.isEmpty())
+        otherName=tr("%1 - copy (%2)").arg(destination.baseName(),QStringLiteral("%number%"));
+    else
+    {
+        otherName=otherRenamingRule;
+        otherName.replace(QStringLiteral("%name%"),destination.baseName());
+    }
+    if(withSuffix && !destination.completeSuffix().isEmpty())
+    {
+        firstName+=text_dot+destination.completeSuffix();
+        otherName+=text_dot+destination.completeSuffix();
+    }
+    return destinationFolderCache->reserveFreeName(destination.absolutePath(),firstName,otherName);
+}
+
 void ScanFileOrFolder::setRenamingRules(const QString &firstRenamingRule, const QString &otherRenamingRule)
 {
     this->firstRenamingRule=firstRenamingRule;
@@ -16,6 +16,7 @@
 
 #include "Environment.h"
 #include "DriveManagement.h"
+#include "DestinationFolderCache.h"
 
 #ifndef SCANFILEORFOLDER_H
 #define SCANFILEORFOLDER_H
@@ -39,6 +40,10 @@ public:
     void setCheckDestinationFolderExists(const bool checkDestinationFolderExists);
     void setRenamingRules(const QString &firstRenamingRule,const QString &otherRenamingRule);
     void setMoveTheWholeFolder(const bool &moveTheWholeFolder);
+    /// \brief to resolv the rename of the folder with the destination listing
+    void setDestinationFolderCache(DestinationFolderCache *destinationFolderCache);
+    /// \brief one slot is taken for each file sent, to block the listing when the transfer list is full
+    void setTransferSlot(QSemaphore *transferSlot);
     #ifdef ULTRACOPIER_PLUGIN_RSYNC
     void setRsync(const bool rsync);
     #endif
@@ -93,6 +98,13 @@ private:
     QString			firstRenamingRule;
     QString			otherRenamingRule;
     QStringList     blackList;
+    DestinationFolderCache *destinationFolderCache;
+    QSemaphore          *transferSlot;
+    /// \brief wait a free slot and send the file to the transfer list
+    void                sendFileTransfer(const QFileInfo &source,const QFileInfo &destination);
+    /** \brief return and reserve the first free renamed name of the folder
+     * \param withSuffix keep the complete suffix after the base name, else the renamed folder lose it */
+    QString         reserveRenamedName(const QFileInfo &destination,const bool &withSuffix);
     /** Parse the multiple wildcard source, it allow resolv multiple wildcard with Qt into their path
      * The string: /toto/f*a/yy*a/toto.mp3
      * Will give: /toto/f1a/yy*a/toto.mp3, /toto/f2a/yy*a/toto.mp3
@@ -0,0 +1,313 @@
+#include "TransferListFile.h"
+
+#include <string.h>
+
+//flush the write buffer into the file at this size
+#define TRANSFERLISTFILE_WRITE_BUFFER 1024*1024
+//size of the header: magic, version, mode, flags, reserved
+#define TRANSFERLISTFILE_HEADER_SIZE 12
+
+TransferListWriter::TransferListWriter()
+{
+    flags=0;
+    haveError=false;
+}
+
+bool TransferListWriter::open(const QString &fileName,const TransferListMode &mode,const quint8 &flags)
+{
+    file.setFileName(fileName);
+    if(!file.open(QIODevice::WriteOnly|QIODevice::Truncate))
+        return false;
+    this->flags=flags;
+    haveError=false;
+    previousSource.clear();
+    previousDestination.clear();
+    writeBuffer.clear();
+    writeBuffer.append(TRANSFERLISTFILE_MAGIC);
+    writeBuffer.append((char)TRANSFERLISTFILE_VERSION);
+    writeBuffer.append((char)mode);
+    writeBuffer.append((char)flags);
+    writeBuffer.append((char)0);
+    return true;
+}
+
+void TransferListWriter::writeVarint(quint64 value)
+{
+    while(value>=0x80)
+    {
+        writeBuffer.append((char)((value&0x7F)|0x80));
+        value>>=7;
+    }
+    writeBuffer.append((char)value);
+}
+
+void TransferListWriter::writePath(const QByteArray &path,QByteArray &previous)
+{
+    //the files of the same folder are next, then only the file name is written
+    int prefix=0;
+    const int maxPrefix=qMin(path.size(),previous.size());
+    const char *pathData=path.constData();
+    const char *previousData=previous.constData();
+    while(prefix<maxPrefix && pathData[prefix]==previousData[prefix])
+        prefix++;
+    writeVarint(prefix);
+    writeVarint(path.size()-prefix);
+    writeBuffer.append(pathData+prefix,path.size()-prefix);
+    previous=path;
+}
+
+bool TransferListWriter::write(const TransferListEntry &entry)
+{
+    if(haveError)
+        return false;
+    writeBuffer.append((char)entry.mode);
+    writePath(entry.source.toUtf8(),previousSource);
+    writePath(entry.destination.toUtf8(),previousDestination);
+    if(flags & TransferListFlag_Size)
+        writeVarint(entry.size);
+    if(flags & TransferListFlag_Mtime)
+        writeVarint(entry.mtime);
+    if(writeBuffer.size()>=TRANSFERLISTFILE_WRITE_BUFFER)
+    {
+        if(file.write(writeBuffer)!=writeBuffer.size())
+            haveError=true;
+        writeBuffer.clear();
+    }
+    return !haveError;
+}
+
+bool TransferListWriter::close()
+{
+    if(!haveError && !writeBuffer.isEmpty())
+        if(file.write(writeBuffer)!=writeBuffer.size())
+            haveError=true;
+    writeBuffer.clear();
+    file.close();
+    return !haveError;
+}
+
+QString TransferListWriter::errorString() const
+{
+    return file.errorString();
+}
+
+TransferListReader::TransferListReader()
+{
+    data=NULL;
+    size=0;
+    offset=0;
+    listMode=TransferListMode_Transfer;
+    listFlags=0;
+    haveError=false;
+    isText=false;
+    wrongLines=0;
+}
+
+TransferListReader::~TransferListReader()
+{
+    if(data!=NULL)
+        file.unmap(data);
+}
+
+bool TransferListReader::open(const QString &fileName)
+{
+    file.setFileName(fileName);
+    if(!file.open(QIODevice::ReadOnly))
+    {
+        error=file.errorString();
+        return false;
+    }
+    size=file.size();
+    if(size==0)
+    {
+        error=QStringLiteral("Problem reading file, or file-size is 0");
+        return false;
+    }
+    //all the file is mapped, the kernel read it when it's needed
+    data=file.map(0,size);
+    if(data==NULL)
+    {
+        error=file.errorString();
+        return false;
+    }
+    if(size<TRANSFERLISTFILE_HEADER_SIZE || memcmp(data,TRANSFERLISTFILE_MAGIC,sizeof(TRANSFERLISTFILE_MAGIC)-1)!=0)
+        return openText();
+    offset=sizeof(TRANSFERLISTFILE_MAGIC)-1;
+    const quint8 version=data[offset];
+    if(version!=TRANSFERLISTFILE_VERSION)
+    {
+        error=QStringLiteral("Unsupported version: %1").arg(version);
+        return false;
+    }
+    listMode=(TransferListMode)data[offset+1];
+    listFlags=data[offset+2];
+    if(listMode!=TransferListMode_Transfer && listMode!=TransferListMode_Copy && listMode!=TransferListMode_Move)
+    {
+        error=QStringLiteral("Wrong mode: %1").arg(listMode);
+        return false;
+    }
+    offset=TRANSFERLISTFILE_HEADER_SIZE;
+    return true;
+}
+
+bool TransferListReader::openText()
+{
+    isText=true;
+    offset=0;
+    QByteArray header;
+    readLine(header);
+    if(header=="Ultracopier;Transfer-list;Transfer;Ultracopier")
+        listMode=TransferListMode_Transfer;
+    else if(header=="Ultracopier;Transfer-list;Copy;Ultracopier")
+        listMode=TransferListMode_Copy;
+    else if(header=="Ultracopier;Transfer-list;Move;Ultracopier")
+        listMode=TransferListMode_Move;
+    else
+    {
+        error=QStringLiteral("Wrong header: \"%1\"").arg(QString::fromUtf8(header));
+        return false;
+    }
+    return true;
+}
+
+bool TransferListReader::readLine(QByteArray &line)
+{
+    if(offset>=size)
+        return false;
+    const char *start=reinterpret_cast<const char *>(data+offset);
+    const char *end=static_cast<const char *>(memchr(start,'\n',size-offset));
+    quint64 lineSize;
+    if(end==NULL)
+        lineSize=size-offset;
+    else
+        lineSize=end-start;
+    offset+=lineSize+1;
+    while(lineSize>0 && start[lineSize-1]=='\r')
+        lineSize--;
+    line=QByteArray(start,lineSize);
+    return true;
+}
+
+bool TransferListReader::nextText(TransferListEntry &entry)
+{
+    QByteArray line;
+    while(readLine(line))
+    {
+        if(line.isEmpty())
+            continue;
+        const QList<QByteArray> &args=line.split(';');
+        entry.size=0;
+        entry.mtime=0;
+        if(listMode==TransferListMode_Transfer)
+        {
+            if(args.size()==3 && (args.at(0)=="Copy" || args.at(0)=="Move") && !args.at(1).isEmpty() && !args.at(2).isEmpty())
+            {
+                if(args.at(0)=="Copy")
+                    entry.mode=Ultracopier::Copy;
+                else
+                    entry.mode=Ultracopier::Move;
+                entry.source=QString::fromUtf8(args.at(1));
+                entry.destination=QString::fromUtf8(args.at(2));
+                return true;
+            }
+        }
+        else if(args.size()==2 && !args.at(0).isEmpty() && !args.at(1).isEmpty())
+        {
+            if(listMode==TransferListMode_Copy)
+                entry.mode=Ultracopier::Copy;
+            else
+                entry.mode=Ultracopier::Move;
+            entry.source=QString::fromUtf8(args.at(0));
+            entry.destination=QString::fromUtf8(args.at(1));
+            return true;
+        }
+        wrongLines++;
+    }
+    return false;
+}
+
+TransferListMode TransferListReader::mode() const
+{
+    return listMode;
+}
+
+quint8 TransferListReader::flags() const
+{
+    return listFlags;
+}
+
+bool TransferListReader::readVarint(quint64 &value)
+{
+    value=0;
+    int shift=0;
+    while(offset<size && shift<64)
+    {
+        const uchar byte=data[offset];
+        offset++;
+        value|=(quint64)(byte&0x7F)<<shift;
+        if((byte&0x80)==0)
+            return true;
+        shift+=7;
+    }
+    haveError=true;
+    return false;
+}
+
+bool TransferListReader::readPath(QByteArray &previous)
+{
+    quint64 prefix,suffix;
+    if(!readVarint(prefix) || !readVarint(suffix))
+        return false;
+    if(prefix>(quint64)previous.size() || suffix>size-offset)
+    {
+        haveError=true;
+        return false;
+    }
+    previous.truncate(prefix);
+    previous.append(reinterpret_cast<const char *>(data+offset),suffix);
+    offset+=suffix;
+    return true;
+}
+
+bool TransferListReader::next(TransferListEntry &entry)
+{
+    if(data==NULL || haveError || offset>=size)
+        return false;
+    if(isText)
+        return nextText(entry);
+    const quint8 mode=data[offset];
+    offset++;
+    if(mode!=Ultracopier::Copy && mode!=Ultracopier::Move)
+    {
+        haveError=true;
+        return false;
+    }
+    if(!readPath(previousSource) || !readPath(previousDestination))
+        return false;
+    entry.mode=(Ultracopier::CopyMode)mode;
+    entry.source=QString::fromUtf8(previousSource);
+    entry.destination=QString::fromUtf8(previousDestination);
+    entry.size=0;
+    entry.mtime=0;
+    if(listFlags & TransferListFlag_Size)
+        if(!readVarint(entry.size))
+            return false;
+    if(listFlags & TransferListFlag_Mtime)
+        if(!readVarint(entry.mtime))
+            return false;
+    return true;
+}
+
+bool TransferListReader::hasError() const
+{
+    return haveError || wrongLines>0;
+}
+
+QString TransferListReader::errorString() const
+{
+    if(haveError)
+        return QStringLiteral("Truncated or corrupted file at the offset %1").arg(offset);
+    if(wrongLines>0)
+        return QStringLiteral("%1 lines with wrong syntax").arg(wrongLines);
+    return error;
+}
@@ -0,0 +1,107 @@
+/** \file TransferListFile.h
+\brief Transfer list file, binary to export and import big transfer list, text for the old lists
+\author alpha_one_x86
+\licence GPL3, see the file COPYING */
+
+#ifndef TRANSFERLISTFILE_H
+#define TRANSFERLISTFILE_H
+
+#include <QString>
+#include <QByteArray>
+#include <QFile>
+
+#include "Environment.h"
+
+/** \brief Format of the binary transfer list, all is in little endian
+ * Header: the magic "ULTRALST", quint8 version, quint8 TransferListMode, quint8 TransferListFlags, quint8 reserved
+ * Record: quint8 mode, source path, destination path, varint size if TransferListFlag_Size, varint mtime if TransferListFlag_Mtime
+ * Path: varint length of the prefix shared with the previous path of the same column, varint length of the suffix, UTF-8 suffix */
+#define TRANSFERLISTFILE_MAGIC "ULTRALST"
+#define TRANSFERLISTFILE_VERSION 1
+/// \brief the export use the binary format with this file suffix, the import detect it with the magic
+#define TRANSFERLISTFILE_SUFFIX ".ulst"
+
+/// \brief mode of the whole list, like the header of the text format
+enum TransferListMode
+{
+    TransferListMode_Transfer=0x00,///< copy and move mixed
+    TransferListMode_Copy=0x01,
+    TransferListMode_Move=0x02
+};
+
+/// \brief the optional fields of the record
+enum TransferListFlags
+{
+    TransferListFlag_Size=0x01,///< the import don't need stat() the source to have its size
+    TransferListFlag_Mtime=0x02///< the modification time of the source, in ms since the epoch
+};
+
+/// \brief one entry of the binary transfer list
+struct TransferListEntry
+{
+    QString source;
+    QString destination;
+    Ultracopier::CopyMode mode;
+    quint64 size;
+    quint64 mtime;
+};
+
+/// \brief Write the binary transfer list, the write are buffered
+class TransferListWriter
+{
+public:
+    explicit TransferListWriter();
+    bool open(const QString &fileName,const TransferListMode &mode,const quint8 &flags);
+    bool write(const TransferListEntry &entry);
+    bool close();
+    QString errorString() const;
+private:
+    void writeVarint(quint64 value);
+    void writePath(const QByteArray &path,QByteArray &previous);
+    QFile file;
+    QByteArray writeBuffer;
+    QByteArray previousSource;
+    QByteArray previousDestination;
+    quint8 flags;
+    bool haveError;
+};
+
+/** \brief Read the binary or the text transfer list, the file is mapped into the memory
+ * The entries are read one by one with next(), then the import can be done by block.
+ * The text format is the header "Ultracopier;Transfer-list;Transfer|Copy|Move;Ultracopier",
+ * then one line by entry: "source;destination", or "Copy|Move;source;destination" with Transfer. */
+class TransferListReader
+{
+public:
+    explicit TransferListReader();
+    ~TransferListReader();
+    bool open(const QString &fileName);
+    TransferListMode mode() const;
+    quint8 flags() const;
+    /// \brief read the next entry, return false at the end or on error, the text lines with wrong syntax are skipped
+    bool next(TransferListEntry &entry);
+    /// \brief true if the file is truncated or corrupted, or if a text line have wrong syntax
+    bool hasError() const;
+    QString errorString() const;
+private:
+    bool openText();
+    bool nextText(TransferListEntry &entry);
+    /// \brief the next line of the text format without the end of line, false at the end
+    bool readLine(QByteArray &line);
+    bool readVarint(quint64 &value);
+    bool readPath(QByteArray &previous);
+    QFile file;
+    uchar *data;
+    quint64 size;
+    quint64 offset;
+    QByteArray previousSource;
+    QByteArray previousDestination;
+    TransferListMode listMode;
+    quint8 listFlags;
+    bool haveError;
+    bool isText;
+    quint64 wrongLines;
+    QString error;
+};
+
+#endif // TRANSFERLISTFILE_H
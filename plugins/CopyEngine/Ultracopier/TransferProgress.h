@@ -0,0 +1,118 @@
+/** \file TransferProgress.h
+\brief Progression counters written by the copy threads and read by the list thread without lock
+\author alpha_one_x86
+\licence GPL3, see the file COPYING */
+
+#ifndef TRANSFERPROGRESS_H
+#define TRANSFERPROGRESS_H
+
+#include <QAtomicInteger>
+#include <QAtomicInt>
+#include <QtGlobal>
+
+#include "StructEnumDefinition_CopyEngine.h"
+
+/// \brief size of the cache line, the counters of two threads are not on the same line
+#define TRANSFERPROGRESS_CACHE_LINE 64
+
+/** \brief Byte counter with only one writer thread, usable like the integer it replace
+ * The owner thread read and write it relaxed, the other thread read it with loadAcquire() via value().
+ * It's aligned on a cache line, then the read and the write thread don't share the same line. The new of C++11
+ * don't follow this alignment, then a cache line of padding is before the counter too: it's alone on its line
+ * even into a TransferThread allocated on the heap. */
+template<class T>
+class alignas(TRANSFERPROGRESS_CACHE_LINE) TransferCounter
+{
+public:
+    TransferCounter() : counter(0) {}
+    TransferCounter(const T &value) : counter(value) {}
+    TransferCounter &operator=(const T &value)
+    {
+        counter.storeRelease(value);
+        return *this;
+    }
+    TransferCounter &operator+=(const T &value)
+    {
+        //only one writer, no need of fetchAndAdd
+        counter.storeRelease(counter.load()+value);
+        return *this;
+    }
+    operator T() const
+    {
+        return counter.load();
+    }
+    /// \brief to read it from an other thread
+    T value() const
+    {
+        return counter.loadAcquire();
+    }
+private:
+    Q_DISABLE_COPY(TransferCounter)
+    char paddingBefore[TRANSFERPROGRESS_CACHE_LINE];
+    QAtomicInteger<T> counter;
+    char paddingAfter[TRANSFERPROGRESS_CACHE_LINE-sizeof(QAtomicInteger<T>)];
+};
+
+/// \brief Transfer stat written by the transfer thread, read by the list thread
+class TransferStatAtomic
+{
+public:
+    TransferStatAtomic(const TransferStat &stat=TransferStat_Idle) : stat(stat) {}
+    TransferStatAtomic &operator=(const TransferStat &stat)
+    {
+        this->stat.storeRelease(stat);
+        return *this;
+    }
+    operator TransferStat() const
+    {
+        return (TransferStat)stat.loadAcquire();
+    }
+private:
+    Q_DISABLE_COPY(TransferStatAtomic)
+    QAtomicInt stat;
+};
+
+/** \brief General progression of the copy engine, published by the list thread and read by any thread
+ * It's a seqlock: the writer make the sequence odd during the update, the reader retry if the sequence is odd
+ * or have changed during its read. The writer never wait, the reader wait only during an update. */
+class ProgressSnapshot
+{
+public:
+    ProgressSnapshot() : sequence(0), current(0), total(0), realByteTransfered(0) {}
+    /// \brief only called by the list thread
+    void publish(const quint64 &current,const quint64 &total,const quint64 &realByteTransfered)
+    {
+        sequence.fetchAndAddOrdered(1);
+        this->current.store(current);
+        this->total.store(total);
+        this->realByteTransfered.store(realByteTransfered);
+        sequence.fetchAndAddOrdered(1);
+    }
+    void read(quint64 &current,quint64 &total,quint64 &realByteTransfered) const
+    {
+        int before,after;
+        do
+        {
+            before=sequence.loadAcquire();
+            current=this->current.load();
+            total=this->total.load();
+            realByteTransfered=this->realByteTransfered.load();
+            //read-modify-write to not have the previous load after it
+            after=sequence.fetchAndAddOrdered(0);
+        } while((before&1)!=0 || before!=after);
+    }
+    quint64 readRealByteTransfered() const
+    {
+        quint64 current,total,realByteTransfered;
+        read(current,total,realByteTransfered);
+        return realByteTransfered;
+    }
+private:
+    Q_DISABLE_COPY(ProgressSnapshot)
+    mutable QAtomicInt sequence;
+    QAtomicInteger<quint64> current;
+    QAtomicInteger<quint64> total;
+    QAtomicInteger<quint64> realByteTransfered;
+};
+
+#endif // TRANSFERPROGRESS_H
@@ -0,0 +1,425 @@
+/** \file TransferQueue.h
+\brief Ordered list of transfer indexed by id, position, id lookup and next ready item in O(log n)
+\author alpha_one_x86
+\licence GPL3, see the file COPYING */
+
+#ifndef TRANSFERQUEUE_H
+#define TRANSFERQUEUE_H
+
+#include <QHash>
+#include <QtGlobal>
+
+/** \brief Ordered list of item with an unique quint64 id member
+ * It's an implicit treap (balanced tree where the key is the position), each node know the size of its sub-tree,
+ * then at(), removeAt(), move() and indexOfId() are in O(log n). The sequential access (at(i) then at(i+1))
+ * is in O(1) because the last accessed node is kept.
+ * Each item can be blocked (running or waiting another item), each node know the number of not blocked item of
+ * its sub-tree, then nextReady() jump over the blocked items in O(log n). */
+template<class T>
+class TransferQueue
+{
+public:
+    TransferQueue();
+    ~TransferQueue();
+    int size() const;
+    bool isEmpty() const;
+    bool empty() const;
+    void clear();
+    const T &at(const int &position) const;
+    T &operator[](const int &position);
+    void append(const T &item);
+    TransferQueue &operator<<(const T &item);
+    void removeAt(const int &position);
+    /// \brief move the item at the position from to the position to, like QList::move()
+    void move(const int &from,const int &to);
+    void swap(const int &first,const int &second);
+    /// \brief return the current position of the item, -1 if not found
+    int indexOfId(const quint64 &id) const;
+    bool containsId(const quint64 &id) const;
+    /// \brief block or unblock the item with this id, a new item is not blocked
+    void setBlocked(const quint64 &id,const bool &blocked);
+    /// \brief return the position of the first not blocked item at or after the position, -1 if none
+    int nextReady(const int &position) const;
+private:
+    Q_DISABLE_COPY(TransferQueue)
+    struct Node
+    {
+        T value;
+        Node *left;
+        Node *right;
+        Node *parent;
+        quint32 priority;
+        int count;
+        int readyCount;///< number of not blocked item into the sub-tree
+        bool blocked;
+    };
+    Node *root;
+    QHash<quint64,Node *> idToNode;
+    quint32 seed;
+    //the last accessed node, to have sequential access without descend the tree
+    mutable Node *lastNode;
+    mutable int lastPosition;
+
+    static int count(const Node *node);
+    static int readyCount(const Node *node);
+    static void update(Node *node);
+    //first not blocked item of the sub-tree at or after the position k of the sub-tree
+    static int nextReady(const Node *node,const int &k);
+    //first k item into left, the other into right
+    static void split(Node *node,const int &k,Node *&left,Node *&right);
+    static Node *merge(Node *left,Node *right);
+    Node *nodeAt(const int &position) const;
+    int positionOf(const Node *node) const;
+    Node *detach(const int &position);
+    void insert(Node *node,const int &position);
+    quint32 nextPriority();
+};
+
+template<class T>
+TransferQueue<T>::TransferQueue()
+{
+    root=NULL;
+    seed=2463534242U;
+    lastNode=NULL;
+    lastPosition=-1;
+}
+
+template<class T>
+TransferQueue<T>::~TransferQueue()
+{
+    clear();
+}
+
+template<class T>
+int TransferQueue<T>::size() const
+{
+    return count(root);
+}
+
+template<class T>
+bool TransferQueue<T>::isEmpty() const
+{
+    return root==NULL;
+}
+
+template<class T>
+bool TransferQueue<T>::empty() const
+{
+    return root==NULL;
+}
+
+template<class T>
+void TransferQueue<T>::clear()
+{
+    //all the node are into the hash
+    typename QHash<quint64,Node *>::const_iterator i=idToNode.constBegin();
+    while(i!=idToNode.constEnd())
+    {
+        delete i.value();
+        ++i;
+    }
+    idToNode.clear();
+    root=NULL;
+    lastNode=NULL;
+    lastPosition=-1;
+}
+
+template<class T>
+const T &TransferQueue<T>::at(const int &position) const
+{
+    return nodeAt(position)->value;
+}
+
+template<class T>
+T &TransferQueue<T>::operator[](const int &position)
+{
+    return nodeAt(position)->value;
+}
+
+template<class T>
+void TransferQueue<T>::append(const T &item)
+{
+    Node *node=new Node;
+    node->value=item;
+    node->left=NULL;
+    node->right=NULL;
+    node->parent=NULL;
+    node->priority=nextPriority();
+    node->count=1;
+    node->readyCount=1;
+    node->blocked=false;
+    idToNode[item.id]=node;
+    root=merge(root,node);
+    root->parent=NULL;
+}
+
+template<class T>
+TransferQueue<T> &TransferQueue<T>::operator<<(const T &item)
+{
+    append(item);
+    return *this;
+}
+
+template<class T>
+void TransferQueue<T>::removeAt(const int &position)
+{
+    Node *node=detach(position);
+    idToNode.remove(node->value.id);
+    delete node;
+}
+
+template<class T>
+void TransferQueue<T>::move(const int &from,const int &to)
+{
+    if(from==to)
+        return;
+    insert(detach(from),to);
+}
+
+template<class T>
+void TransferQueue<T>::swap(const int &first,const int &second)
+{
+    if(first==second)
+        return;
+    Node *firstNode=nodeAt(first);
+    Node *secondNode=nodeAt(second);
+    qSwap(firstNode->value,secondNode->value);
+    idToNode[firstNode->value.id]=firstNode;
+    idToNode[secondNode->value.id]=secondNode;
+    //the blocked stat follow the item
+    if(firstNode->blocked!=secondNode->blocked)
+    {
+        setBlocked(firstNode->value.id,secondNode->blocked);
+        setBlocked(secondNode->value.id,!secondNode->blocked);
+    }
+}
+
+template<class T>
+int TransferQueue<T>::indexOfId(const quint64 &id) const
+{
+    const Node *node=idToNode.value(id,NULL);
+    if(node==NULL)
+        return -1;
+    return positionOf(node);
+}
+
+template<class T>
+bool TransferQueue<T>::containsId(const quint64 &id) const
+{
+    return idToNode.contains(id);
+}
+
+template<class T>
+void TransferQueue<T>::setBlocked(const quint64 &id,const bool &blocked)
+{
+    Node *node=idToNode.value(id,NULL);
+    if(node==NULL || node->blocked==blocked)
+        return;
+    node->blocked=blocked;
+    while(node!=NULL)
+    {
+        if(blocked)
+            node->readyCount--;
+        else
+            node->readyCount++;
+        node=node->parent;
+    }
+}
+
+template<class T>
+int TransferQueue<T>::nextReady(const int &position) const
+{
+    if(position<0)
+        return nextReady(root,0);
+    return nextReady(root,position);
+}
+
+template<class T>
+int TransferQueue<T>::nextReady(const Node *node,const int &k)
+{
+    //the sub-tree without ready item or before the position is not walked
+    if(node==NULL || node->readyCount==0 || k>=node->count)
+        return -1;
+    const int leftCount=count(node->left);
+    if(k<leftCount)
+    {
+        const int position=nextReady(node->left,k);
+        if(position>=0)
+            return position;
+    }
+    if(k<=leftCount && !node->blocked)
+        return leftCount;
+    int rightK=k-leftCount-1;
+    if(rightK<0)
+        rightK=0;
+    const int position=nextReady(node->right,rightK);
+    if(position<0)
+        return -1;
+    return leftCount+1+position;
+}
+
+template<class T>
+int TransferQueue<T>::count(const Node *node)
+{
+    if(node==NULL)
+        return 0;
+    return node->count;
+}
+
+template<class T>
+int TransferQueue<T>::readyCount(const Node *node)
+{
+    if(node==NULL)
+        return 0;
+    return node->readyCount;
+}
+
+template<class T>
+void TransferQueue<T>::update(Node *node)
+{
+    node->count=1+count(node->left)+count(node->right);
+    node->readyCount=(node->blocked?0:1)+readyCount(node->left)+readyCount(node->right);
+    if(node->left!=NULL)
+        node->left->parent=node;
+    if(node->right!=NULL)
+        node->right->parent=node;
+}
+
+template<class T>
+void TransferQueue<T>::split(Node *node,const int &k,Node *&left,Node *&right)
+{
+    if(node==NULL)
+    {
+        left=NULL;
+        right=NULL;
+        return;
+    }
+    if(count(node->left)<k)
+    {
+        split(node->right,k-count(node->left)-1,node->right,right);
+        left=node;
+    }
+    else
+    {
+        split(node->left,k,left,node->left);
+        right=node;
+    }
+    update(node);
+}
+
+template<class T>
+typename TransferQueue<T>::Node *TransferQueue<T>::merge(Node *left,Node *right)
+{
+    if(left==NULL)
+        return right;
+    if(right==NULL)
+        return left;
+    if(left->priority>right->priority)
+    {
+        left->right=merge(left->right,right);
+        update(left);
+        return left;
+    }
+    else
+    {
+        right->left=merge(left,right->left);
+        update(right);
+        return right;
+    }
+}
+
+template<class T>
+typename TransferQueue<T>::Node *TransferQueue<T>::nodeAt(const int &position) const
+{
+    Q_ASSERT(position>=0 && position<count(root));
+    if(lastNode!=NULL)
+    {
+        if(position==lastPosition)
+            return lastNode;
+        //next node into the in-order walk, amortized O(1)
+        if(position==lastPosition+1)
+        {
+            Node *node=lastNode;
+            if(node->right!=NULL)
+            {
+                node=node->right;
+                while(node->left!=NULL)
+                    node=node->left;
+            }
+            else
+            {
+                while(node->parent!=NULL && node->parent->right==node)
+                    node=node->parent;
+                node=node->parent;
+            }
+            lastNode=node;
+            lastPosition=position;
+            return node;
+        }
+    }
+    Node *node=root;
+    int k=position;
+    while(count(node->left)!=k)
+    {
+        if(k<count(node->left))
+            node=node->left;
+        else
+        {
+            k-=count(node->left)+1;
+            node=node->right;
+        }
+    }
+    lastNode=node;
+    lastPosition=position;
+    return node;
+}
+
+template<class T>
+int TransferQueue<T>::positionOf(const Node *node) const
+{
+    int position=count(node->left);
+    while(node->parent!=NULL)
+    {
+        if(node->parent->right==node)
+            position+=count(node->parent->left)+1;
+        node=node->parent;
+    }
+    return position;
+}
+
+template<class T>
+typename TransferQueue<T>::Node *TransferQueue<T>::detach(const int &position)
+{
+    Q_ASSERT(position>=0 && position<count(root));
+    Node *left,*middle,*right;
+    split(root,position,left,middle);
+    split(middle,1,middle,right);
+    root=merge(left,right);
+    if(root!=NULL)
+        root->parent=NULL;
+    middle->parent=NULL;
+    lastNode=NULL;
+    return middle;
+}
+
+template<class T>
+void TransferQueue<T>::insert(Node *node,const int &position)
+{
+    Node *left,*right;
+    split(root,position,left,right);
+    root=merge(merge(left,node),right);
+    root->parent=NULL;
+    lastNode=NULL;
+}
+
+template<class T>
+quint32 TransferQueue<T>::nextPriority()
+{
+    //xorshift, enough to balance the tree
+    seed^=seed<<13;
+    seed^=seed>>17;
+    seed^=seed<<5;
+    return seed;
+}
+
+#endif // TRANSFERQUEUE_H
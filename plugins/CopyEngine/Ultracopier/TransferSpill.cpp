@@ -0,0 +1,166 @@
+#include "TransferSpill.h"
+
+#include <QDir>
+#include <QtEndian>
+
+//flush the write buffer into the file at this size
+#define TRANSFERSPILL_WRITE_BUFFER 1024*1024
+//minimal size of the mapped window
+#define TRANSFERSPILL_MAP_WINDOW 16*1024*1024
+
+TransferSpill::TransferSpill()
+{
+    fileSize=0;
+    readOffset=0;
+    recordCount=0;
+    mapData=NULL;
+    mapOffset=0;
+    mapSize=0;
+    file.setFileTemplate(QDir::tempPath()+QStringLiteral("/ultracopier-transfer-XXXXXX"));
+}
+
+TransferSpill::~TransferSpill()
+{
+    unmap();
+}
+
+bool TransferSpill::open()
+{
+    if(file.isOpen())
+        return true;
+    return file.open();
+}
+
+bool TransferSpill::append(const QByteArray &record)
+{
+    if(!open())
+        return false;
+    uchar size[4];
+    qToLittleEndian<quint32>(record.size(),size);
+    writeBuffer.append(reinterpret_cast<const char *>(size),sizeof(size));
+    writeBuffer.append(record);
+    recordCount++;
+    if(writeBuffer.size()>=TRANSFERSPILL_WRITE_BUFFER)
+        if(!flush())
+        {
+            //the caller keep this record into the memory, the previous are flushed at the next try
+            writeBuffer.chop(sizeof(size)+record.size());
+            recordCount--;
+            return false;
+        }
+    return true;
+}
+
+bool TransferSpill::flush()
+{
+    if(writeBuffer.isEmpty())
+        return true;
+    if(!file.seek(fileSize))
+        return false;
+    if(file.write(writeBuffer)!=writeBuffer.size())
+        return false;
+    fileSize+=writeBuffer.size();
+    writeBuffer.clear();
+    return true;
+}
+
+void TransferSpill::unmap()
+{
+    if(mapData!=NULL)
+    {
+        file.unmap(mapData);
+        mapData=NULL;
+    }
+    mapOffset=0;
+    mapSize=0;
+}
+
+const uchar *TransferSpill::data(const quint64 &offset,const quint64 &size)
+{
+    //the end is still into the write buffer
+    if(offset>=fileSize)
+    {
+        if(offset-fileSize+size>(quint64)writeBuffer.size())
+            return NULL;
+        return reinterpret_cast<const uchar *>(writeBuffer.constData())+(offset-fileSize);
+    }
+    if(offset+size>fileSize)
+    {
+        //the record is across the file and the write buffer
+        if(!flush())
+            return NULL;
+    }
+    if(mapData==NULL || offset<mapOffset || offset+size>mapOffset+mapSize)
+    {
+        unmap();
+        quint64 newSize=TRANSFERSPILL_MAP_WINDOW;
+        if(newSize<size)
+            newSize=size;
+        if(offset+newSize>fileSize)
+            newSize=fileSize-offset;
+        mapData=file.map(offset,newSize);
+        if(mapData==NULL)
+            return NULL;
+        mapOffset=offset;
+        mapSize=newSize;
+    }
+    return mapData+(offset-mapOffset);
+}
+
+quint64 TransferSpill::firstOffset() const
+{
+    return readOffset;
+}
+
+bool TransferSpill::readAt(quint64 &offset,QByteArray &record)
+{
+    if(offset>=fileSize+writeBuffer.size())
+        return false;
+    const uchar *sizeData=data(offset,sizeof(quint32));
+    if(sizeData==NULL)
+        return false;
+    const quint32 size=qFromLittleEndian<quint32>(sizeData);
+    const uchar *recordData=data(offset+sizeof(quint32),size);
+    if(recordData==NULL)
+        return false;
+    record=QByteArray(reinterpret_cast<const char *>(recordData),size);
+    offset+=sizeof(quint32)+size;
+    return true;
+}
+
+bool TransferSpill::takeFirst(QByteArray &record)
+{
+    if(!readAt(readOffset,record))
+        return false;
+    recordCount--;
+    //all is read, drop the file content
+    if(recordCount==0)
+        clear();
+    return true;
+}
+
+bool TransferSpill::isEmpty() const
+{
+    return recordCount==0;
+}
+
+quint64 TransferSpill::count() const
+{
+    return recordCount;
+}
+
+QString TransferSpill::errorString() const
+{
+    return file.errorString();
+}
+
+void TransferSpill::clear()
+{
+    unmap();
+    if(file.isOpen())
+        file.resize(0);
+    writeBuffer.clear();
+    fileSize=0;
+    readOffset=0;
+    recordCount=0;
+}
@@ -0,0 +1,48 @@
+/** \file TransferSpill.h
+\brief Tail of the transfer list written into a temporary file, for the job bigger than the memory
+\author alpha_one_x86
+\licence GPL3, see the file COPYING */
+
+#ifndef TRANSFERSPILL_H
+#define TRANSFERSPILL_H
+
+#include <QByteArray>
+#include <QTemporaryFile>
+
+/** \brief Append only file of record, read back in the same order
+ * The write are buffered, the read is done by mapping a window of the file into the memory.
+ * When all the record are read, the file is truncated. */
+class TransferSpill
+{
+public:
+    explicit TransferSpill();
+    ~TransferSpill();
+    /// \brief add the record at the end, return false if the temporary file can't be used, then the record is not added
+    bool append(const QByteArray &record);
+    /// \brief read and remove the first record, return false if empty or if the temporary file can't be read (then isEmpty() is false)
+    bool takeFirst(QByteArray &record);
+    /// \brief offset of the first record, to read all the record without remove it
+    quint64 firstOffset() const;
+    /// \brief read the record at this offset and set the offset on the next record, return false at the end
+    bool readAt(quint64 &offset,QByteArray &record);
+    bool isEmpty() const;
+    quint64 count() const;
+    void clear();
+    QString errorString() const;
+private:
+    bool open();
+    bool flush();
+    //map the file to have [offset,offset+size[ into the memory
+    const uchar *data(const quint64 &offset,const quint64 &size);
+    void unmap();
+    QTemporaryFile file;
+    QByteArray writeBuffer;
+    quint64 fileSize;///< size written into the file, the write buffer is after
+    quint64 readOffset;
+    quint64 recordCount;
+    uchar *mapData;
+    quint64 mapOffset;
+    quint64 mapSize;
+};
+
+#endif // TRANSFERSPILL_H
@@ -5,6 +5,10 @@
 #ifdef Q_OS_WIN32
 #include <windows.h>
 #endif
+#ifdef Q_OS_UNIX
+#include <errno.h>
+#include <string.h>
+#endif
 
 #ifdef Q_OS_WIN32
     #ifndef ULTRACOPIER_PLUGIN_SET_TIME_UNIX_WAY
@@ -45,6 +49,8 @@ TransferThread::TransferThread() :
     #endif
 
     minTime=QDateTime(QDate(ULTRACOPIER_PLUGIN_MINIMALYEAR,1,1));
+    destinationFolderCache=NULL;
+    latencyStats=NULL;
 }
 
 TransferThread::~TransferThread()
@@ -169,6 +175,9 @@ bool TransferThread::setFiles(const QFileInfo& source,const qint64 &size,const Q
     sended_state_preOperationStopped= false;
     canBeMovedDirectlyVariable      = false;
     canBeCopiedDirectlyVariable     = false;
+    hardLinkedVariable              = false;
+    succeededDestination.clear();
+    reservedDestination.clear();
     fileContentError                = false;
     real_doChecksum                 = false;
     writeError                      = false;
@@ -240,6 +249,8 @@ void TransferThread::setFileRename(const QString &nameForRename)
             emit errorOnFile(destinationFile,destinationFile.errorString());
             return;
         }
+        if(destinationFolderCache!=NULL)
+            destinationFolderCache->rename(tempDestination,destination.absolutePath()+QDir::separator()+nameForRename);
         if(source.absoluteFilePath()==destination.absoluteFilePath())
             source.setFile(destination.absolutePath()+QDir::separator()+nameForRename);
         destination.setFile(tempDestination);
@@ -364,6 +375,15 @@ void TransferThread::preOperation()
         writeThread.fakeOpen();
         return;
     }
+    if(tryHardLink())
+    {
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("[")+QString::number(id)+QStringLiteral("] ")+QStringLiteral("hard linked: %1 to %2").arg(hardLinkTarget).arg(destination.absoluteFilePath()));
+        canBeCopiedDirectlyVariable=true;
+        hardLinkedVariable=true;
+        readThread.fakeOpen();
+        writeThread.fakeOpen();
+        return;
+    }
     if(canBeCopiedDirectly())
     {
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("[")+QString::number(id)+QStringLiteral("] ")+QStringLiteral("need copied directly: %1 to %2").arg(source.absoluteFilePath()).arg(destination.absoluteFilePath()));
@@ -399,7 +419,10 @@ void TransferThread::tryOpen()
         if(!readIsOpeningVariable)
         {
             readError=false;
-            readThread.open(source.absoluteFilePath(),mode);
+            if(latencyStats!=NULL)
+                readThread.open(source.absoluteFilePath(),mode,latencyStats->job(),latencyStats->device(driveManagement.getDrive(source.absoluteFilePath())));
+            else
+                readThread.open(source.absoluteFilePath(),mode);
             readIsOpeningVariable=true;
         }
         else
@@ -419,10 +442,17 @@ void TransferThread::tryOpen()
             else
                 ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("[")+QString::number(id)+QStringLiteral("] transferAlgorithm==TransferAlgorithm_Parallel"));
             writeError=false;
+            LatencyStages *latencyJob=NULL,*destinationDevice=NULL;
+            if(latencyStats!=NULL)
+            {
+                latencyJob=latencyStats->job();
+                destinationDevice=latencyStats->device(driveManagement.getDrive(destination.absoluteFilePath()));
+            }
+            metadataLatency.set(latencyJob,destinationDevice);
             if(transferAlgorithm==TransferAlgorithm_Sequential)
-                writeThread.open(destination.absoluteFilePath(),size,osBuffer && (!osBufferLimited || (osBufferLimited && size<osBufferLimit)),sequentialBuffer,true);
+                writeThread.open(destination.absoluteFilePath(),size,osBuffer && (!osBufferLimited || (osBufferLimited && size<osBufferLimit)),sequentialBuffer,true,latencyJob,destinationDevice);
             else
-                writeThread.open(destination.absoluteFilePath(),size,osBuffer && (!osBufferLimited || (osBufferLimited && size<osBufferLimit)),parallelBuffer,false);
+                writeThread.open(destination.absoluteFilePath(),size,osBuffer && (!osBufferLimited || (osBufferLimited && size<osBufferLimit)),parallelBuffer,false,latencyJob,destinationDevice);
             writeIsOpeningVariable=true;
         }
         else
@@ -435,6 +465,53 @@ void TransferThread::tryOpen()
     }
 }
 
+/** \brief link() the destination on the destination of the first transfer of the same source inode
+ * \return false if not hard link or if not possible (other file system, ...), then do normal copy */
+bool TransferThread::tryHardLink()
+{
+    #ifdef Q_OS_UNIX
+    if(hardLinkTarget.isEmpty() || source.isSymLink())
+        return false;
+    {
+        QDir dir(destination.absolutePath());
+        mkpathTransfer->acquire();
+        if(destinationFolderCache==NULL || !destinationFolderCache->folderExists(destination.absolutePath()))
+            if(!dir.exists())
+            {
+                dir.mkpath(destination.absolutePath());
+                if(destinationFolderCache!=NULL)
+                    destinationFolderCache->add(destination.absolutePath());
+            }
+        mkpathTransfer->release();
+    }
+    if(::link(QFile::encodeName(hardLinkTarget).constData(),QFile::encodeName(destination.absoluteFilePath()).constData())!=0)
+    {
+        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("[")+QString::number(id)+QStringLiteral("] ")+QStringLiteral("unable to hard link %1 to %2: %3, do normal copy").arg(hardLinkTarget).arg(destination.absoluteFilePath()).arg(QString::fromLocal8Bit(strerror(errno))));
+        return false;
+    }
+    if(destinationFolderCache!=NULL)
+        destinationFolderCache->add(destination.absoluteFilePath());
+    return true;
+    #else
+    return false;
+    #endif
+}
+
+void TransferThread::setHardLinkTarget(const QString &hardLinkTarget)
+{
+    this->hardLinkTarget=hardLinkTarget;
+}
+
+QString TransferThread::getSucceededDestination() const
+{
+    return succeededDestination;
+}
+
+QString TransferThread::getReservedDestination() const
+{
+    return reservedDestination;
+}
+
 bool TransferThread::isSame()
 {
     //check if source and destination is not the same
@@ -482,8 +559,21 @@ bool TransferThread::destinationExists()
         return false;
     bool destinationExists;
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("[")+QString::number(id)+QStringLiteral("] time to first FS access"));
-    destination.refresh();
-    destinationExists=destination.exists();
+    if(destinationFolderCache!=NULL)
+    {
+        //the destination folder is listed one time, only the found entry is checked on the file system
+        destinationExists=destinationFolderCache->exists(destination.absoluteFilePath());
+        if(destinationExists)
+        {
+            destination.refresh();
+            destinationExists=destination.exists();
+        }
+    }
+    else
+    {
+        destination.refresh();
+        destinationExists=destination.exists();
+    }
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("[")+QString::number(id)+QStringLiteral("] finish first FS access"));
     if(destinationExists)
     {
@@ -622,34 +712,59 @@ bool TransferThread::checkAlwaysRename()
             fileName.replace(renameRegex,QStringLiteral("\\1"));
         }
         //resolv the new name
-        int num=1;
-        do
+        if(destinationFolderCache!=NULL)
         {
-            if(num==1)
+            //one pass on the destination folder listing, and the name is reserved for this transfer
+            QString firstFileName,otherFileName;
+            if(firstRenamingRule.isEmpty())
+                firstFileName=tr("%1 - copy").arg(fileName);
+            else
             {
-                if(firstRenamingRule.isEmpty())
-                    newFileName=tr("%1 - copy").arg(fileName);
-                else
-                {
-                    newFileName=firstRenamingRule;
-                    newFileName.replace(QStringLiteral("%name%"),fileName);
-                }
+                firstFileName=firstRenamingRule;
+                firstFileName.replace(QStringLiteral("%name%"),fileName);
             }
+            if(otherRenamingRule.isEmpty())
+                otherFileName=tr("%1 - copy (%2)").arg(fileName,QStringLiteral("%number%"));
             else
             {
-                if(otherRenamingRule.isEmpty())
-                    newFileName=tr("%1 - copy (%2)").arg(fileName).arg(num);
+                otherFileName=otherRenamingRule;
+                otherFileName.replace(QStringLiteral("%name%"),fileName);
+            }
+            newFileName=destinationFolderCache->reserveFreeName(newDestination.absolutePath(),firstFileName+suffix,otherFileName+suffix);
+            newDestination.setFile(newDestination.absolutePath()+QDir::separator()+newFileName);
+            reservedDestination=newDestination.absoluteFilePath();
+        }
+        else
+        {
+            int num=1;
+            do
+            {
+                if(num==1)
+                {
+                    if(firstRenamingRule.isEmpty())
+                        newFileName=tr("%1 - copy").arg(fileName);
+                    else
+                    {
+                        newFileName=firstRenamingRule;
+                        newFileName.replace(QStringLiteral("%name%"),fileName);
+                    }
+                }
                 else
                 {
-                    newFileName=otherRenamingRule;
-                    newFileName.replace(QStringLiteral("%name%"),fileName);
-                    newFileName.replace(QStringLiteral("%number%"),QString::number(num));
+                    if(otherRenamingRule.isEmpty())
+                        newFileName=tr("%1 - copy (%2)").arg(fileName).arg(num);
+                    else
+                    {
+                        newFileName=otherRenamingRule;
+                        newFileName.replace(QStringLiteral("%name%"),fileName);
+                        newFileName.replace(QStringLiteral("%number%"),QString::number(num));
+                    }
                 }
+                newDestination.setFile(newDestination.absolutePath()+QDir::separator()+newFileName+suffix);
+                num++;
             }
-            newDestination.setFile(newDestination.absolutePath()+QDir::separator()+newFileName+suffix);
-            num++;
+            while(newDestination.exists());
         }
-        while(newDestination.exists());
         if(!renameTheOriginalDestination)
             destination=newDestination;
         else
@@ -670,6 +785,8 @@ bool TransferThread::checkAlwaysRename()
                 emit errorOnFile(destinationFile,destinationFile.errorString());
                 return true;
             }
+            if(destinationFolderCache!=NULL)
+                destinationFolderCache->rename(destination.absoluteFilePath(),newDestination.absoluteFilePath());
         }
         return true;
     }
@@ -713,8 +830,13 @@ void TransferThread::tryMoveDirectly()
     QDir dir(destination.absolutePath());
     {
         mkpathTransfer->acquire();
-        if(!dir.exists())
-            dir.mkpath(destination.absolutePath());
+        if(destinationFolderCache==NULL || !destinationFolderCache->folderExists(destination.absolutePath()))
+            if(!dir.exists())
+            {
+                dir.mkpath(destination.absolutePath());
+                if(destinationFolderCache!=NULL)
+                    destinationFolderCache->add(destination.absolutePath());
+            }
         mkpathTransfer->release();
     }
     #ifdef Q_OS_WIN32
@@ -746,6 +868,8 @@ void TransferThread::tryMoveDirectly()
         emit errorOnFile(sourceFile,sourceFile.errorString());
         return;
     }
+    if(destinationFolderCache!=NULL)
+        destinationFolderCache->rename(source.absoluteFilePath(),destination.absoluteFilePath());
     readThread.fakeReadIsStarted();
     writeThread.fakeWriteIsStarted();
     readThread.fakeReadIsStopped();
@@ -764,6 +888,15 @@ void TransferThread::tryCopyDirectly()
     writeIsFinishVariable		= false;
     readIsClosedVariable		= false;
     writeIsClosedVariable		= false;
+    //already done by link() at the pre-operation
+    if(hardLinkedVariable)
+    {
+        readThread.fakeReadIsStarted();
+        writeThread.fakeWriteIsStarted();
+        readThread.fakeReadIsStopped();
+        writeThread.fakeWriteIsStopped();
+        return;
+    }
     //move if on same mount point
     QFile sourceFile(source.absoluteFilePath());
     QFile destinationFile(destination.absoluteFilePath());
@@ -789,8 +922,13 @@ void TransferThread::tryCopyDirectly()
     QDir dir(destination.absolutePath());
     {
         mkpathTransfer->acquire();
-        if(!dir.exists())
-            dir.mkpath(destination.absolutePath());
+        if(destinationFolderCache==NULL || !destinationFolderCache->folderExists(destination.absolutePath()))
+            if(!dir.exists())
+            {
+                dir.mkpath(destination.absolutePath());
+                if(destinationFolderCache!=NULL)
+                    destinationFolderCache->add(destination.absolutePath());
+            }
         mkpathTransfer->release();
     }
     /** on windows, symLink is normal file, can be copied
@@ -833,6 +971,8 @@ void TransferThread::tryCopyDirectly()
         emit errorOnFile(sourceFile,sourceFile.errorString());
         return;
     }
+    if(destinationFolderCache!=NULL)
+        destinationFolderCache->add(destination.absoluteFilePath());
     readThread.fakeReadIsStarted();
     writeThread.fakeWriteIsStarted();
     readThread.fakeReadIsStopped();
@@ -1263,6 +1403,7 @@ void TransferThread::postOperation()
             else
                 ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,QStringLiteral("[")+QString::number(id)+QStringLiteral("] try remove source but destination not exists!"));
         }
+        succeededDestination=destination.absoluteFilePath();
     }
     else//do difference skip a file and skip this error case
     {
@@ -1306,6 +1447,8 @@ bool TransferThread::doFilePostOperation()
     }
     else
     {
+        QElapsedTimer metadataTime;
+        metadataTime.start();
         if(doTheDateTransfer)
         {
             if(!writeFileDateTime(destination))
@@ -1360,6 +1503,7 @@ bool TransferThread::doFilePostOperation()
                 }
             }
         }
+        metadataLatency.record(LatencyStage_Metadata,metadataTime);
     }
     if(stopIt)
         return false;
@@ -1984,6 +2128,17 @@ void TransferThread::setMkpathTransfer(QSemaphore *mkpathTransfer)
     writeThread.setMkpathTransfer(mkpathTransfer);
 }
 
+void TransferThread::setLatencyStats(LatencyStats *latencyStats)
+{
+    this->latencyStats=latencyStats;
+}
+
+void TransferThread::setDestinationFolderCache(DestinationFolderCache *destinationFolderCache)
+{
+    this->destinationFolderCache=destinationFolderCache;
+    writeThread.setDestinationFolderCache(destinationFolderCache);
+}
+
 void TransferThread::set_doChecksum(bool doChecksum)
 {
     this->doChecksum=doChecksum;
@@ -35,6 +35,9 @@
 #include "WriteThread.h"
 #include "Environment.h"
 #include "DriveManagement.h"
+#include "DestinationFolderCache.h"
+#include "TransferProgress.h"
+#include "LatencyHistogram.h"
 #include "StructEnumDefinition_CopyEngine.h"
 
 /// \brief Thread changed to manage the inode operation, the signals, canceling, pre and post operations
@@ -56,6 +59,10 @@ public:
     #endif
     /// \brief to have semaphore, and try create just one by one
     void setMkpathTransfer(QSemaphore *mkpathTransfer);
+    /// \brief to have the listing of the destination folders, shared by all the transfer thread
+    void setDestinationFolderCache(DestinationFolderCache *destinationFolderCache);
+    /// \brief to record the latency of the stages, shared by all the transfer thread
+    void setLatencyStats(LatencyStats *latencyStats);
     /// \brief to store the transfer id
     quint64			transferId;
     /// \brief to store the transfer size
@@ -78,6 +85,12 @@ public:
     QFileInfo getSourceInode() const;
     QFileInfo getDestinationInode() const;
     Ultracopier::CopyMode getMode() const;
+    /// \brief set the destination of the first transfer of the same source inode, to do link() on it, empty if not hard link
+    void setHardLinkTarget(const QString &hardLinkTarget);
+    /// \brief return the destination if the last transfer have correctly finished, else empty
+    QString getSucceededDestination() const;
+    /// \brief return the destination name reserved into the destination folder cache by the auto rename, else empty
+    QString getReservedDestination() const;
 protected:
     void run();
 signals:
@@ -185,7 +198,7 @@ private:
         MoveReturn_moved=1,
         MoveReturn_error=2
     };
-    TransferStat	transfer_stat;
+    TransferStatAtomic	transfer_stat;///< read by the list thread without lock
     ReadThread		readThread;
     WriteThread		writeThread;
     /*QString			source;
@@ -209,6 +222,10 @@ private:
     bool			readIsClosedVariable;
     bool			writeIsClosedVariable;
     bool			canBeMovedDirectlyVariable,canBeCopiedDirectlyVariable;
+    bool			hardLinkedVariable;
+    QString			hardLinkTarget;
+    QString			succeededDestination;
+    QString			reservedDestination;
     DriveManagement driveManagement;
     QByteArray		sourceChecksum,destinationChecksum;
     volatile bool	stopIt;
@@ -223,6 +240,9 @@ private:
     QDateTime		minTime;
     int             id;
     QSemaphore		*mkpathTransfer;
+    DestinationFolderCache *destinationFolderCache;
+    LatencyStats	*latencyStats;
+    LatencyTarget	metadataLatency;///< on the destination device
     bool			doChecksum,real_doChecksum;
     bool			checksumIgnoreIfImpossible;
     bool			checksumOnlyOnError;
@@ -258,6 +278,7 @@ private:
     #endif
     //different pre-operation
     bool isSame();
+    bool tryHardLink();
     bool destinationExists();
     bool checkAlwaysRename();///< return true if has been renamed
     bool canBeMovedDirectly() const;
@@ -8,6 +8,8 @@
 
 //Un-comment this next line to put ultracopier plugin in debug mode
 #define ULTRACOPIER_PLUGIN_DEBUG
+//Comment this next line to remove the notice at the compilation, their arguments are not evaluated
+#define ULTRACOPIER_PLUGIN_DEBUG_NOTICE
 //#define ULTRACOPIER_PLUGIN_DEBUG_SCHEDULER
 #define ULTRACOPIER_PLUGIN_DEBUG_WINDOW
 #define ULTRACOPIER_PLUGIN_DEBUG_WINDOW_TIMER		150
@@ -35,6 +37,19 @@
 #define ULTRACOPIER_PLUGIN_TIME_UPDATE_PROGRESSION 200
 #define ULTRACOPIER_PLUGIN_TIME_UPDATE_MOUNT_MS 60*1000
 
+/** \brief Number of transfer kept into the memory, the next are written into a temporary file */
+#define ULTRACOPIER_PLUGIN_MAX_TRANSFER_IN_MEMORY 1000000
+/** \brief Number of transfer into the temporary file before block the listing */
+#define ULTRACOPIER_PLUGIN_MAX_TRANSFER_SPILLED 200000000
+/** \brief Number of entry of the binary transfer list imported before let the list thread do the other events */
+#define ULTRACOPIER_PLUGIN_TRANSFER_LIST_IMPORT_BLOCK 10000
+/** \brief Number of thread to create and remove the folders, the independent sub-trees are done in parallel */
+#define ULTRACOPIER_PLUGIN_MKPATH_THREADS 8
+/** \brief Number of transfer at the top of the list sorted by physical offset, the next keep the list order */
+#define ULTRACOPIER_PLUGIN_PHYSICAL_ORDER_MAX_TRANSFER 20000
+/** \brief Size in bytes of the file name buffer of the transfer list before drop the names of the finished transfers */
+#define ULTRACOPIER_PLUGIN_NAME_ARENA_COMPACT_SIZE 1024*1024
+
 //#define ULTRACOPIER_PLUGIN_SET_TIME_UNIX_WAY
 
 #endif // VARIABLE_H
@@ -14,6 +14,9 @@ WriteThread::WriteThread()
     moveToThread(this);
     setObjectName(QStringLiteral("write"));
     //this->mkpathTransfer            = mkpathTransfer;
+    destinationFolderCache          = NULL;
+    openLatencyJob                  = NULL;
+    openLatencyDevice               = NULL;
     #ifdef ULTRACOPIER_PLUGIN_DEBUG
     stat                            = Idle;
     #endif
@@ -107,6 +110,8 @@ bool WriteThread::internalOpen()
     //mkpath check if exists and return true if already exists
     QFileInfo destinationInfo(file);
     QDir destinationFolder;
+    //the folder listing is already into the cache by TransferThread::destinationExists(), then no file system access
+    if(destinationFolderCache==NULL || !destinationFolderCache->folderExists(destinationInfo.absolutePath()))
     {
         mkpathTransfer->acquire();
         if(!destinationFolder.exists(destinationInfo.absolutePath()))
@@ -130,6 +135,8 @@ bool WriteThread::internalOpen()
                     return false;
                 }
             }
+            if(destinationFolderCache!=NULL)
+                destinationFolderCache->add(destinationInfo.absolutePath());
         }
         mkpathTransfer->release();
     }
@@ -157,8 +164,15 @@ bool WriteThread::internalOpen()
         }
     }
     bool fileWasExists=file.exists();
+    //the previous file is closed, its latency is no longer recorded
+    latency.set(openLatencyJob,openLatencyDevice);
+    QElapsedTimer openTime;
+    openTime.start();
     if(file.open(flags))
     {
+        latency.record(LatencyStage_Open,openTime);
+        if(destinationFolderCache!=NULL && !fileWasExists)
+            destinationFolderCache->add(file.fileName());
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("[")+QString::number(id)+QStringLiteral("] after the open"));
         {
             QMutexLocker lock_mutex(&accessList);
@@ -260,7 +274,7 @@ bool WriteThread::internalOpen()
     }
 }
 
-void WriteThread::open(const QFileInfo &file,const quint64 &startSize,const bool &buffer,const int &numberOfBlock,const bool &sequential)
+void WriteThread::open(const QFileInfo &file,const quint64 &startSize,const bool &buffer,const int &numberOfBlock,const bool &sequential,LatencyStages *latencyJob,LatencyStages *latencyDevice)
 {
     if(!isRunning())
     {
@@ -294,6 +308,8 @@ void WriteThread::open(const QFileInfo &file,const quint64 &startSize,const bool
     this->startSize=startSize;
     this->buffer=buffer;
     this->sequential=sequential;
+    openLatencyJob=latencyJob;
+    openLatencyDevice=latencyDevice;
     endDetected=false;
     writeFullBlocked=false;
     emit internalStartOpen();
@@ -489,6 +505,8 @@ void WriteThread::internalClose(bool emitSignal)
     {
         if(file.isOpen())
         {
+            QElapsedTimer closeTime;
+            closeTime.start();
             if(!needRemoveTheFile)
             {
                 if(startSize!=lastGoodPosition)
@@ -505,13 +523,18 @@ void WriteThread::internalClose(bool emitSignal)
                     }
             }
             file.close();
+            latency.record(LatencyStage_Close,closeTime);
             if(needRemoveTheFile || stopIt)
             {
                 if(deletePartiallyTransferredFiles)
                 {
                     if(!file.remove())
+                    {
                         if(emitSignal)
                             ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("[")+QString::number(id)+QStringLiteral("] unable to remove the destination file"));
+                    }
+                    else if(destinationFolderCache!=NULL)
+                        destinationFolderCache->remove(file.fileName());
                 }
             }
             //here and not after, because the transferThread don't need try close if not open
@@ -618,7 +641,7 @@ bool WriteThread::setBlockSize(const int blockSize)
 /// \brief get the last good position
 qint64 WriteThread::getLastGoodPosition() const
 {
-    return lastGoodPosition;
+    return lastGoodPosition.value();
 }
 
 void WriteThread::flushAndSeekToZero()
@@ -633,6 +656,8 @@ void WriteThread::checkSum()
 {
     //QByteArray blockArray;
     QCryptographicHash hash(QCryptographicHash::Sha1);
+    QElapsedTimer checksumTime;
+    checksumTime.start();
     endDetected=false;
     lastGoodPosition=0;
     #ifdef ULTRACOPIER_PLUGIN_SPEED_SUPPORT
@@ -705,6 +730,7 @@ void WriteThread::checkSum()
         stopIt=false;
         return;
     }
+    latency.record(LatencyStage_Checksum,checksumTime);
     emit checksumFinish(hash.result());
     ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("[")+QString::number(id)+QStringLiteral("] stop the read"));
 }
@@ -723,11 +749,17 @@ void WriteThread::internalFlushAndSeekToZero()
     emit flushedAndSeekedToZero();
 }
 
+
 void WriteThread::setMkpathTransfer(QSemaphore *mkpathTransfer)
 {
     this->mkpathTransfer=mkpathTransfer;
 }
 
+void WriteThread::setDestinationFolderCache(DestinationFolderCache *destinationFolderCache)
+{
+    this->destinationFolderCache=destinationFolderCache;
+}
+
 void WriteThread::setDeletePartiallyTransferredFiles(const bool &deletePartiallyTransferredFiles)
 {
     this->deletePartiallyTransferredFiles=deletePartiallyTransferredFiles;
@@ -934,7 +966,9 @@ void WriteThread::internalWrite()
         #ifdef ULTRACOPIER_PLUGIN_DEBUG
         stat=Write;
         #endif
+        blockTime.start();
         bytesWriten=file.write(blockArray);
+        latency.record(LatencyStage_WriteBlock,blockTime);
         #ifdef ULTRACOPIER_PLUGIN_DEBUG
         stat=Idle;
         #endif
@@ -12,10 +12,14 @@
 #include <QMutex>
 #include <QSemaphore>
 #include <QCryptographicHash>
+#include <QElapsedTimer>
 
 #include "Environment.h"
 #include "StructEnumDefinition_CopyEngine.h"
 #include "AvancedQFile.h"
+#include "DestinationFolderCache.h"
+#include "TransferProgress.h"
+#include "LatencyHistogram.h"
 
 /// \brief Thread changed to open/close and write the destination file
 class WriteThread : public QThread
@@ -26,11 +30,13 @@ public:
     ~WriteThread();
     /// \brief to have semaphore to do mkpath one by one
     void setMkpathTransfer(QSemaphore *mkpathTransfer);
+    /// \brief to have the listing of the destination folders
+    void setDestinationFolderCache(DestinationFolderCache *destinationFolderCache);
 protected:
     void run();
 public:
-    /// \brief open the destination to open it
-    void open(const QFileInfo &file,const quint64 &startSize,const bool &buffer,const int &numberOfBlock,const bool &sequential);
+    /// \brief open the destination to open it, the latency of this file is recorded into latencyJob and latencyDevice
+    void open(const QFileInfo &file,const quint64 &startSize,const bool &buffer,const int &numberOfBlock,const bool &sequential,LatencyStages *latencyJob=NULL,LatencyStages *latencyDevice=NULL);
     /// \brief to return the error string
     QString errorString() const;
     /// \brief to stop all
@@ -62,7 +68,7 @@ public:
     void startCheckSum();
     /// \brief set block size in KB
     bool setBlockSize(const int blockSize);
-    /// \brief get the last good position
+    /// \brief get the last good position, can be called from an other thread
     qint64 getLastGoodPosition() const;
     /// \brief buffer is empty
     bool bufferIsEmpty();
@@ -132,18 +138,22 @@ private:
     QSemaphore          pauseMutex;
     volatile bool		putInPause;
     QList<QByteArray>	theBlockList;		///< Store the block list
-    quint64             lastGoodPosition;
+    TransferCounter<quint64> lastGoodPosition;///< read by the transfer and list thread without lock
     QByteArray          blockArray;		///< temp data for block writing, the data
     qint64              bytesWriten;		///< temp data for block writing, the bytes writen
     int                 id;
     volatile bool       endDetected;
     quint64             startSize;
     QSemaphore          *mkpathTransfer;
+    DestinationFolderCache *destinationFolderCache;
     bool                fakeMode;
     bool                buffer;
     bool                needRemoveTheFile;
     volatile bool       sequential;
     bool                deletePartiallyTransferredFiles;
+    LatencyTarget       latency;
+    LatencyStages       *openLatencyJob,*openLatencyDevice;///< given by open(), set into latency by internalOpen()
+    QElapsedTimer       blockTime;
     #ifdef ULTRACOPIER_PLUGIN_SPEED_SUPPORT
     volatile int        multiForBigSpeed;           ///< Multiple for count the number of block needed
     #endif
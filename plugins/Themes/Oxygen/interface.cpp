@@ -135,15 +135,12 @@ Themes::Themes(const bool &alwaysOnTop,
 
     //setup the search part
     closeTheSearchBox();
-    TimerForSearch  = new QTimer(this);
-    TimerForSearch->setInterval(500);
-    TimerForSearch->setSingleShot(true);
     searchShortcut  = new QShortcut(QKeySequence(QKeySequence::Find),this);
     searchShortcut2 = new QShortcut(QKeySequence(QKeySequence::FindNext),this);
     searchShortcut3 = new QShortcut(QKeySequence(Qt::Key_Escape),this);
 
     //connect the search part
-    connect(TimerForSearch,			&QTimer::timeout,	this,	&Themes::hilightTheSearchSlot);
+    connect(&transferModel,			&TransferModel::searchFinished,	this,	&Themes::hilightTheSearchSlot);
     connect(searchShortcut,			&QShortcut::activated,	this,	&Themes::searchBoxShortcut);
     connect(searchShortcut2,		&QShortcut::activated,	this,	&Themes::on_pushButtonSearchNext_clicked);
     connect(ui->pushButtonCloseSearch,	&QPushButton::clicked,	this,	&Themes::closeTheSearchBox);
@@ -502,17 +499,16 @@ void Themes::setGeneralProgression(const quint64 &current,const quint64 &total)
 
 void Themes::setFileProgression(const QList<Ultracopier::ProgressionItem> &progressionList)
 {
-    QList<Ultracopier::ProgressionItem> progressionListBis=progressionList;
-    transferModel.setFileProgression(progressionListBis);
+    transferModel.setFileProgression(progressionList);
     updateCurrentFileInformation();
 }
 
 //edit the transfer list
 /// \todo check and re-enable to selection
-void Themes::getActionOnList(const QList<Ultracopier::ReturnActionOnCopyList> &returnActions)
+void Themes::getCopyListEvents(const Ultracopier::CopyListEvents &events)
 {
-    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("start, returnActions.size(): ")+QString::number(returnActions.size()));
-    QList<quint64> returnValue=transferModel.synchronizeItems(returnActions);
+    ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Notice,QStringLiteral("start, events.size(): ")+QString::number(events.size()));
+    QList<quint64> returnValue=transferModel.synchronizeItems(events);
     totalFile+=returnValue.first();
     totalSize+=returnValue.at(1);
     currentFile+=returnValue.last();
@@ -1018,7 +1014,14 @@ void Themes::searchBoxShortcut()
 //hilight the search
 void Themes::hilightTheSearch(bool searchNext)
 {
-    int result=transferModel.search(ui->lineEditSearch->text(),searchNext);
+    //the result of a new text is received later, then searchFinished() call it again
+    if(ui->lineEditSearch->text()!=transferModel.searchText())
+    {
+        transferModel.setSearchText(ui->lineEditSearch->text());
+        if(!ui->lineEditSearch->text().isEmpty())
+            return;
+    }
+    int result=transferModel.search(searchNext);
     if(ui->lineEditSearch->text().isEmpty())
         ui->lineEditSearch->setStyleSheet("");
     else
@@ -1040,7 +1043,12 @@ void Themes::hilightTheSearchSlot()
 
 void Themes::on_pushButtonSearchPrev_clicked()
 {
-    int result=transferModel.searchPrev(ui->lineEditSearch->text());
+    if(ui->lineEditSearch->text()!=transferModel.searchText())
+    {
+        hilightTheSearch();
+        return;
+    }
+    int result=transferModel.searchPrev();
     if(ui->lineEditSearch->text().isEmpty())
         ui->lineEditSearch->setStyleSheet("");
     else
@@ -1067,13 +1075,9 @@ void Themes::on_lineEditSearch_returnPressed()
 
 void Themes::on_lineEditSearch_textChanged(QString text)
 {
-    if(text=="")
-    {
-        TimerForSearch->stop();
-        hilightTheSearch();
-    }
-    else
-        TimerForSearch->start();
+    Q_UNUSED(text);
+    //the search is done into a thread, then it's started at each change
+    hilightTheSearch();
 }
 
 void Themes::on_moreButton_toggled(bool checked)
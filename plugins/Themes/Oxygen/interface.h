@@ -93,7 +93,7 @@ public:
     void setTransferListOperation(const Ultracopier::TransferListOperation &transferListOperation);
     //edit the transfer list
     /// \brief get action on the transfer list (add/move/remove)
-    void getActionOnList(const QList<Ultracopier::ReturnActionOnCopyList> &returnActions);
+    void getCopyListEvents(const Ultracopier::CopyListEvents &events);
     /** \brief set if the order is external (like file manager copy)
      * to notify the interface, which can hide add folder/filer button */
     void haveExternalOrder();
@@ -185,7 +185,6 @@ private:
     QShortcut *searchShortcut;
     QShortcut *searchShortcut2;
     QShortcut *searchShortcut3;
-    QTimer *TimerForSearch;
     int currentIndexSearch;		///< Current index search in starting at the end
     FacilityInterface * facilityEngine;
     QItemSelectionModel *selectionModel;
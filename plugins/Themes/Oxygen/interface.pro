@@ -14,9 +14,13 @@ HEADERS         = ThemesFactory.h \
     ../../../interface/FacilityInterface.h \
     ../../../interface/OptionInterface.h \
     TransferModel.h \
+    ../../../lib/transfer-model/TransferListModel.h \
+    ../../../lib/transfer-model/TransferSearch.h \
     interface.h
 SOURCES         = ThemesFactory.cpp \
     TransferModel.cpp \
+    ../../../lib/transfer-model/TransferListModel.cpp \
+    ../../../lib/transfer-model/TransferSearch.cpp \
     interface.cpp
 TARGET          = $$qtLibraryTarget(interface)
 TRANSLATIONS += Languages/ar/translation.ts \
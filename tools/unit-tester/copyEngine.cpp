@@ -24,7 +24,6 @@ copyEngine::copyEngine(const QString &path,const QList<SupportedTest> &tests)
     alwaysDoThisActionForFileError	= FileError_NotSet;
     checkDestinationFolderExists	= false;
     stopIt				= false;
-    size_for_speed			= 0;
     forcedMode			= false;
 
     //implement the SingleShot in this class
@@ -104,8 +103,6 @@ void copyEngine::connectTheSignalsSlots()
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,"unable to connect mkPathErrorOnFolder()");
     if(!connect(listThread,&ListThread::rmPathErrorOnFolder,					this,&copyEngine::rmPathErrorOnFolderSlot,				Qt::QueuedConnection))
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,"unable to connect rmPathErrorOnFolder()");
-    if(!connect(listThread,&ListThread::send_realBytesTransfered,					this,&copyEngine::get_realBytesTransfered,				Qt::QueuedConnection))
-        ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,"unable to connect send_realBytesTransfered()");
 
     if(!connect(this,&copyEngine::tryCancel,						listThread,&ListThread::tryCancel,				Qt::QueuedConnection))
         ULTRACOPIER_DEBUGCONSOLE(Ultracopier::DebugLevel_Critical,"unable to connect tryCancel()");
@@ -296,10 +293,10 @@ void copyEngine::newTransferList(const QString &file)
     emit signal_importTransferList(file);
 }
 
-//because direct access to list thread into the main thread can't be do
+//read without lock the progression published by the list thread
 quint64 copyEngine::realByteTransfered()
 {
-    return size_for_speed;
+    return listThread->getRealByteTransfered();
 }
 
 //speed limitation
@@ -776,11 +773,6 @@ void copyEngine::showRenamingRules()
     renamingRules->exec();
 }
 
-void copyEngine::get_realBytesTransfered(quint64 realBytesTransfered)
-{
-    size_for_speed=realBytesTransfered;
-}
-
 void copyEngine::newActionInProgess(EngineActionInProgress action)
 {
     if(action==Idle)
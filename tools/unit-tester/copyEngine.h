@@ -77,7 +77,6 @@ private slots:
     void showFilterDialog();
     void sendNewRenamingRules(QString firstRenamingRule,QString otherRenamingRule);
     void showRenamingRules();
-    void get_realBytesTransfered(quint64 realBytesTransfered);
     void newActionInProgess(EngineActionInProgress);
     void updateBufferCheckbox();
 public:
@@ -19,10 +19,17 @@ SOURCES += main.cpp \
     ../../plugins/CopyEngine/Ultracopier/ReadThread.cpp \
     ../../plugins/CopyEngine/Ultracopier/AvancedQFile.cpp \
     ../../plugins/CopyEngine/Ultracopier/WriteThread.cpp \
+    ../../plugins/CopyEngine/Ultracopier/DestinationFolderCache.cpp \
+    ../../plugins/CopyEngine/Ultracopier/LatencyHistogram.cpp \
+    ../../plugins/CopyEngine/Ultracopier/FolderTable.cpp \
+    ../../plugins/CopyEngine/Ultracopier/NameArena.cpp \
+    ../../plugins/CopyEngine/Ultracopier/TransferSpill.cpp \
+    ../../plugins/CopyEngine/Ultracopier/TransferListFile.cpp \
     ../../plugins/CopyEngine/Ultracopier/TransferThread.cpp \
-    ../../plugins/CopyEngine/Ultracopier/ListThread_InodeAction.cpp \
     ../../plugins/CopyEngine/Ultracopier/ListThread.cpp \
     ../../plugins/CopyEngine/Ultracopier/MkPath.cpp \
+    ../../plugins/CopyEngine/Ultracopier/MkPathWorker.cpp \
+    ../../plugins/CopyEngine/Ultracopier/PhysicalOrder.cpp \
     ../../plugins/CopyEngine/Ultracopier/scanFileOrFolder.cpp \
     ../../plugins/CopyEngine/Ultracopier/RmPath.cpp \
     copyEngineUnitTester.cpp \
@@ -33,9 +40,19 @@ HEADERS += \
     ../../plugins/CopyEngine/Ultracopier/AvancedQFile.h \
     ../../plugins/CopyEngine/Ultracopier/Variable.h \
     ../../plugins/CopyEngine/Ultracopier/WriteThread.h \
+    ../../plugins/CopyEngine/Ultracopier/DestinationFolderCache.h \
+    ../../plugins/CopyEngine/Ultracopier/LatencyHistogram.h \
+    ../../plugins/CopyEngine/Ultracopier/TransferQueue.h \
+    ../../plugins/CopyEngine/Ultracopier/FolderTable.h \
+    ../../plugins/CopyEngine/Ultracopier/NameArena.h \
+    ../../plugins/CopyEngine/Ultracopier/TransferSpill.h \
+    ../../plugins/CopyEngine/Ultracopier/TransferListFile.h \
+    ../../plugins/CopyEngine/Ultracopier/TransferProgress.h \
     ../../plugins/CopyEngine/Ultracopier/TransferThread.h \
     ../../plugins/CopyEngine/Ultracopier/ListThread.h \
     ../../plugins/CopyEngine/Ultracopier/MkPath.h \
+    ../../plugins/CopyEngine/Ultracopier/MkPathWorker.h \
+    ../../plugins/CopyEngine/Ultracopier/PhysicalOrder.h \
     ../../plugins/CopyEngine/Ultracopier/scanFileOrFolder.h \
     ../../plugins/CopyEngine/Ultracopier/RmPath.h \
     copyEngineUnitTester.h \
@@ -53,6 +53,14 @@ HEADERS += \
     plugins/CopyEngine/Ultracopier/DebugEngineMacro.h \
     plugins/CopyEngine/Ultracopier/DiskSpace.h \
     plugins/CopyEngine/Ultracopier/DriveManagement.h \
+    plugins/CopyEngine/Ultracopier/DestinationFolderCache.h \
+    plugins/CopyEngine/Ultracopier/LatencyHistogram.h \
+    plugins/CopyEngine/Ultracopier/TransferQueue.h \
+    plugins/CopyEngine/Ultracopier/FolderTable.h \
+    plugins/CopyEngine/Ultracopier/NameArena.h \
+    plugins/CopyEngine/Ultracopier/TransferSpill.h \
+    plugins/CopyEngine/Ultracopier/TransferListFile.h \
+    plugins/CopyEngine/Ultracopier/TransferProgress.h \
     plugins/CopyEngine/Ultracopier/Environment.h \
     plugins/CopyEngine/Ultracopier/CopyEngineFactory.h \
     plugins/CopyEngine/Ultracopier/FileErrorDialog.h \
@@ -62,6 +70,8 @@ HEADERS += \
     plugins/CopyEngine/Ultracopier/Filters.h \
     plugins/CopyEngine/Ultracopier/FolderExistsDialog.h \
     plugins/CopyEngine/Ultracopier/MkPath.h \
+    plugins/CopyEngine/Ultracopier/MkPathWorker.h \
+    plugins/CopyEngine/Ultracopier/PhysicalOrder.h \
     plugins/CopyEngine/Ultracopier/ListThread.h \
     plugins/CopyEngine/Ultracopier/ReadThread.h \
     plugins/CopyEngine/Ultracopier/RenamingRules.h \
@@ -86,6 +96,8 @@ HEADERS += \
     plugins/Themes/Oxygen/interface.h \
     plugins/Themes/Oxygen/Variable.h \
     plugins/Themes/Oxygen/TransferModel.h \
+    lib/transfer-model/TransferListModel.h \
+    lib/transfer-model/TransferSearch.h \
     plugins/Themes/Oxygen/StructEnumDefinition.h
 
 SOURCES += \
@@ -95,6 +107,12 @@ SOURCES += \
     plugins/CopyEngine/Ultracopier/DebugDialog.cpp \
     plugins/CopyEngine/Ultracopier/DiskSpace.cpp \
     plugins/CopyEngine/Ultracopier/DriveManagement.cpp \
+    plugins/CopyEngine/Ultracopier/DestinationFolderCache.cpp \
+    plugins/CopyEngine/Ultracopier/LatencyHistogram.cpp \
+    plugins/CopyEngine/Ultracopier/FolderTable.cpp \
+    plugins/CopyEngine/Ultracopier/NameArena.cpp \
+    plugins/CopyEngine/Ultracopier/TransferSpill.cpp \
+    plugins/CopyEngine/Ultracopier/TransferListFile.cpp \
     plugins/CopyEngine/Ultracopier/CopyEngineFactory.cpp \
     plugins/CopyEngine/Ultracopier/FileErrorDialog.cpp \
     plugins/CopyEngine/Ultracopier/FileExistsDialog.cpp \
@@ -102,8 +120,9 @@ SOURCES += \
     plugins/CopyEngine/Ultracopier/FilterRules.cpp \
     plugins/CopyEngine/Ultracopier/Filters.cpp \
     plugins/CopyEngine/Ultracopier/FolderExistsDialog.cpp \
-    plugins/CopyEngine/Ultracopier/ListThread_InodeAction.cpp \
     plugins/CopyEngine/Ultracopier/MkPath.cpp \
+    plugins/CopyEngine/Ultracopier/MkPathWorker.cpp \
+    plugins/CopyEngine/Ultracopier/PhysicalOrder.cpp \
     plugins/CopyEngine/Ultracopier/ReadThread.cpp \
     plugins/CopyEngine/Ultracopier/RenamingRules.cpp \
     plugins/CopyEngine/Ultracopier/ScanFileOrFolder.cpp \
@@ -116,4 +135,6 @@ SOURCES += \
     plugins/Listener/catchcopy-v0002/catchcopy-api-0002/ServerCatchcopy.cpp \
     plugins/Themes/Oxygen/ThemesFactory.cpp \
     plugins/Themes/Oxygen/interface.cpp \
-    plugins/Themes/Oxygen/TransferModel.cpp
+    plugins/Themes/Oxygen/TransferModel.cpp \
+    lib/transfer-model/TransferListModel.cpp \
+    lib/transfer-model/TransferSearch.cpp
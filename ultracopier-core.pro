@@ -119,6 +119,7 @@ SOURCES += ThemesManager.cpp \
     LogThread.cpp \
     OSSpecific.cpp \
     DebugModel.cpp \
+    DebugTrace.cpp \
     InternetUpdater.cpp
 INCLUDEPATH += lib/qt-tar-xz/
 